@@ -0,0 +1,24 @@
+#ifndef __PLASP_APP__BATCH_H
+#define __PLASP_APP__BATCH_H
+
+#include <colorlog/Logger.h>
+
+#include <plasp-app/OptionGroups.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Batch
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Translates the tasks listed in the batch manifest with a pool of threads, writing one output file
+// per task and a summary to the output directory. Each line of the manifest lists the input files of
+// one task (a SAS file, or a PDDL domain and problem) relative to the manifest. Failing tasks do not
+// affect the others, and parsed PDDL domains are shared by the tasks using them
+int translateBatch(const OptionGroupBasic &basicOptions, const OptionGroupOutput &outputOptions,
+	const OptionGroupParser &parserOptions, const OptionGroupTranslation &translationOptions,
+	const OptionGroupBatch &batchOptions, colorlog::Logger &logger);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif
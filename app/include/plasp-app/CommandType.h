@@ -6,8 +6,13 @@
 
 #include <plasp-app/commands/CommandBeautify.h>
 #include <plasp-app/commands/CommandCheckSyntax.h>
+#include <plasp-app/commands/CommandConvert.h>
+#include <plasp-app/commands/CommandDecodeSymbols.h>
+#include <plasp-app/commands/CommandCompress.h>
+#include <plasp-app/commands/CommandGround.h>
 #include <plasp-app/commands/CommandHelp.h>
 #include <plasp-app/commands/CommandNormalize.h>
+#include <plasp-app/commands/CommandServe.h>
 #include <plasp-app/commands/CommandTranslate.h>
 #include <plasp-app/commands/CommandVersion.h>
 
@@ -25,7 +30,12 @@ enum class CommandType
 	Requirements,
 	Beautify,
 	Normalize,
-	Translate
+	Translate,
+	Ground,
+	Convert,
+	DecodeSymbols,
+	Compress,
+	Serve
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -43,6 +53,11 @@ static const std::map<std::string, CommandType> commandNames =
 		{"beautify", CommandType::Beautify},
 		{"normalize", CommandType::Normalize},
 		{"translate", CommandType::Translate},
+		{"ground", CommandType::Ground},
+		{"convert", CommandType::Convert},
+		{"decode-symbols", CommandType::DecodeSymbols},
+		{"compress", CommandType::Compress},
+		{"serve", CommandType::Serve},
 	};
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -60,7 +75,7 @@ const auto parseCommandType =
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-using AvailableCommands = std::tuple<CommandTranslate, CommandNormalize, CommandCheckSyntax, CommandBeautify, CommandHelp, CommandVersion>;
+using AvailableCommands = std::tuple<CommandTranslate, CommandGround, CommandConvert, CommandDecodeSymbols, CommandCompress, CommandServe, CommandNormalize, CommandCheckSyntax, CommandBeautify, CommandHelp, CommandVersion>;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -0,0 +1,36 @@
+#ifndef __PLASP_APP__COMPRESSED_OUTPUT_H
+#define __PLASP_APP__COMPRESSED_OUTPUT_H
+
+#include <iostream>
+
+#include <lz/CompressingStreamBuffer.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Compressed Output
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Compresses everything written to a stream by intercepting its stream buffer. On destruction, the
+// compressed stream is finished and the stream buffer is restored
+class CompressedOutput
+{
+	public:
+		explicit CompressedOutput(std::ostream &stream);
+		~CompressedOutput();
+
+		CompressedOutput(const CompressedOutput &other) = delete;
+		CompressedOutput &operator=(const CompressedOutput &other) = delete;
+
+		// Writes the end of the compressed stream, returning whether all output was written
+		bool finish();
+
+	private:
+		std::ostream &m_stream;
+		std::streambuf *m_streamBuffer;
+		lz::CompressingStreamBuffer m_compressingStreamBuffer;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif
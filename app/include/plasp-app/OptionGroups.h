@@ -10,6 +10,7 @@
 #include <pddl/Mode.h>
 
 #include <plasp/Language.h>
+#include <plasp/sas/Relevance.h>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 //
@@ -66,4 +67,128 @@ struct OptionGroupParser
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+struct OptionGroupTranslation
+{
+	enum class OutputFormat
+	{
+		ASP,
+		Aspif
+	};
+
+	static constexpr const auto Name = "translation";
+
+	void addTo(cxxopts::Options &options);
+	void read(const cxxopts::ParseResult &parseResult);
+
+	size_t numberOfThreads = 1;
+	std::string symbolTableFile;
+	bool compileStaticPredicates = false;
+	bool synthesizeMutexGroups = false;
+	bool useMultiValuedVariables = false;
+	plasp::sas::PruningMode pruningMode = plasp::sas::PruningMode::None;
+	OutputFormat outputFormat = OutputFormat::ASP;
+	size_t horizon = 1;
+	bool stream = false;
+	bool compress = false;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct OptionGroupBatch
+{
+	static constexpr const auto Name = "batch";
+
+	void addTo(cxxopts::Options &options);
+	void read(const cxxopts::ParseResult &parseResult);
+
+	std::string manifestFile;
+	size_t numberOfJobs = 0;
+	std::string outputDirectory;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct OptionGroupWatch
+{
+	static constexpr const auto Name = "watch";
+
+	void addTo(cxxopts::Options &options);
+	void read(const cxxopts::ParseResult &parseResult);
+
+	std::string outputFile;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct OptionGroupStatistics
+{
+	static constexpr const auto Name = "statistics";
+
+	void addTo(cxxopts::Options &options);
+	void read(const cxxopts::ParseResult &parseResult);
+
+	bool printStatistics = false;
+	std::string statisticsJSONFile;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct OptionGroupConversion
+{
+	enum class TargetFormat
+	{
+		SASBinary
+	};
+
+	static constexpr const auto Name = "conversion";
+
+	void addTo(cxxopts::Options &options);
+	void read(const cxxopts::ParseResult &parseResult);
+
+	TargetFormat targetFormat = TargetFormat::SASBinary;
+	std::string outputFile;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct OptionGroupServer
+{
+	static constexpr const auto Name = "server";
+
+	void addTo(cxxopts::Options &options);
+	void read(const cxxopts::ParseResult &parseResult);
+
+	std::string socketPath;
+	size_t numberOfJobs = 0;
+	size_t cacheCapacity = 16;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct OptionGroupSymbolDecoding
+{
+	static constexpr const auto Name = "decoding";
+
+	void addTo(cxxopts::Options &options);
+	void read(const cxxopts::ParseResult &parseResult);
+
+	std::vector<std::string> inputFiles;
+	std::string symbolTableFile;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct OptionGroupCompression
+{
+	static constexpr const auto Name = "compression";
+
+	void addTo(cxxopts::Options &options);
+	void read(const cxxopts::ParseResult &parseResult);
+
+	std::vector<std::string> inputFiles;
+	bool decompress = false;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 #endif
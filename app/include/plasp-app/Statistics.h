@@ -0,0 +1,30 @@
+#ifndef __PLASP_APP__STATISTICS_H
+#define __PLASP_APP__STATISTICS_H
+
+#include <cstddef>
+
+#include <plasp/Statistics.h>
+
+#include <plasp-app/OptionGroups.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Statistics
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Starts counting the allocations made with operator new, which are not counted by default to keep
+// allocating cheap
+void countAllocations();
+
+// Number of allocations made with operator new since counting started
+std::size_t numberOfAllocations();
+
+// Prints the statistics to stderr and writes them to a JSON file as requested by the options, along
+// with the number of allocations and the output sizes (if the output was counted)
+void reportStatistics(plasp::Statistics &statistics, const plasp::OutputCounter *outputCounter,
+	const OptionGroupStatistics &statisticsOptions);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif
@@ -0,0 +1,31 @@
+#ifndef __PLASP_APP__TRANSLATION_H
+#define __PLASP_APP__TRANSLATION_H
+
+#include <functional>
+
+#include <colorlog/Logger.h>
+
+#include <plasp/Language.h>
+
+#include <plasp-app/OptionGroups.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Translation
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Translates the input files (or the standard input) to the standard output. With ground set, PDDL
+// problems are grounded first, translating only the actions and facts reachable from the initial
+// state. The help is printed if the input language cannot be detected
+int translate(const OptionGroupBasic &basicOptions, const OptionGroupOutput &outputOptions,
+	const OptionGroupParser &parserOptions, const OptionGroupTranslation &translationOptions,
+	const OptionGroupStatistics &statisticsOptions, bool ground, const std::function<void()> &printHelp);
+
+// Warns about the translation options that have no effect on input of the given language
+void warnAboutIgnoredOptions(const OptionGroupTranslation &translationOptions, plasp::Language::Type language,
+	colorlog::Logger &logger);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif
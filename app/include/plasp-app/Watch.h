@@ -0,0 +1,22 @@
+#ifndef __PLASP_APP__WATCH_H
+#define __PLASP_APP__WATCH_H
+
+#include <colorlog/Logger.h>
+
+#include <plasp-app/OptionGroups.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Watch
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Translates the PDDL input files to the output file of the watch options and translates them again
+// whenever they change until interrupted. Only the parts of the description that changed are parsed
+// and translated again, and the previous output is kept while the input files fail to parse
+int translateWatched(const OptionGroupParser &parserOptions, const OptionGroupTranslation &translationOptions,
+	const OptionGroupWatch &watchOptions, colorlog::Logger &logger);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif
@@ -0,0 +1,25 @@
+#ifndef __PLASP_APP__COMMANDS__COMMAND_COMPRESS_H
+#define __PLASP_APP__COMMANDS__COMMAND_COMPRESS_H
+
+#include <plasp-app/Command.h>
+#include <plasp-app/OptionGroups.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Command Compress
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class CommandCompress : public Command<CommandCompress, OptionGroupBasic, OptionGroupOutput, OptionGroupCompression>
+{
+	public:
+		static constexpr auto Name = "compress";
+		static constexpr auto Description = "Compress input files for plasp or decompress output written with --compress";
+
+	public:
+		int run(int argc, char **argv);
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif
@@ -0,0 +1,25 @@
+#ifndef __PLASP_APP__COMMANDS__COMMAND_CONVERT_H
+#define __PLASP_APP__COMMANDS__COMMAND_CONVERT_H
+
+#include <plasp-app/Command.h>
+#include <plasp-app/OptionGroups.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Command Convert
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class CommandConvert : public Command<CommandConvert, OptionGroupBasic, OptionGroupOutput, OptionGroupParser, OptionGroupConversion>
+{
+	public:
+		static constexpr auto Name = "convert";
+		static constexpr auto Description = "Convert SAS to a binary format that loads without parsing";
+
+	public:
+		int run(int argc, char **argv);
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif
@@ -0,0 +1,25 @@
+#ifndef __PLASP_APP__COMMANDS__COMMAND_DECODE_SYMBOLS_H
+#define __PLASP_APP__COMMANDS__COMMAND_DECODE_SYMBOLS_H
+
+#include <plasp-app/Command.h>
+#include <plasp-app/OptionGroups.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Command Decode Symbols
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class CommandDecodeSymbols : public Command<CommandDecodeSymbols, OptionGroupBasic, OptionGroupOutput, OptionGroupSymbolDecoding>
+{
+	public:
+		static constexpr auto Name = "decode-symbols";
+		static constexpr auto Description = "Map integer symbol IDs in answer sets back to names";
+
+	public:
+		int run(int argc, char **argv);
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif
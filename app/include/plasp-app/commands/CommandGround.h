@@ -0,0 +1,25 @@
+#ifndef __PLASP_APP__COMMANDS__COMMAND_GROUND_H
+#define __PLASP_APP__COMMANDS__COMMAND_GROUND_H
+
+#include <plasp-app/Command.h>
+#include <plasp-app/OptionGroups.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Command Ground
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class CommandGround : public Command<CommandGround, OptionGroupBasic, OptionGroupOutput, OptionGroupParser, OptionGroupTranslation, OptionGroupStatistics>
+{
+	public:
+		static constexpr auto Name = "ground";
+		static constexpr auto Description = "Translate PDDL to ASP facts with only the reachable actions and variables";
+
+	public:
+		int run(int argc, char **argv);
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif
@@ -0,0 +1,25 @@
+#ifndef __PLASP_APP__COMMANDS__COMMAND_SERVE_H
+#define __PLASP_APP__COMMANDS__COMMAND_SERVE_H
+
+#include <plasp-app/Command.h>
+#include <plasp-app/OptionGroups.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Command Serve
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class CommandServe : public Command<CommandServe, OptionGroupBasic, OptionGroupOutput, OptionGroupParser, OptionGroupTranslation, OptionGroupServer>
+{
+	public:
+		static constexpr auto Name = "serve";
+		static constexpr auto Description = "Translate and normalize PDDL requests on a Unix domain socket, keeping parsed domains in memory";
+
+	public:
+		int run(int argc, char **argv);
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif
@@ -10,7 +10,7 @@
 //
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-class CommandTranslate : public Command<CommandTranslate, OptionGroupBasic, OptionGroupOutput, OptionGroupParser>
+class CommandTranslate : public Command<CommandTranslate, OptionGroupBasic, OptionGroupOutput, OptionGroupParser, OptionGroupTranslation, OptionGroupBatch, OptionGroupWatch, OptionGroupStatistics>
 {
 	public:
 		static constexpr auto Name = "translate";
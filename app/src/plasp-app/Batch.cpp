@@ -0,0 +1,481 @@
+#include <plasp-app/Batch.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <experimental/filesystem>
+#include <experimental/optional>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include <colorlog/ColorStream.h>
+#include <colorlog/Priority.h>
+
+#include <pddl/AST.h>
+#include <pddl/Exception.h>
+#include <pddl/Normalize.h>
+#include <pddl/Parse.h>
+#include <pddl/Tokenizer.h>
+
+#include <plasp/LanguageDetection.h>
+#include <plasp/ParallelTranslation.h>
+#include <plasp/Statistics.h>
+#include <plasp/TranslatorException.h>
+
+#include <plasp/pddl/DomainCache.h>
+#include <plasp/pddl/TranslatorASP.h>
+#include <plasp/sas/Description.h>
+#include <plasp/sas/TranslatorASP.h>
+#include <plasp/sas/TranslatorAspif.h>
+
+#include <plasp-app/CompressedOutput.h>
+#include <plasp-app/Translation.h>
+
+namespace filesystem = std::experimental::filesystem;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Batch
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct Task
+{
+	std::vector<filesystem::path> inputFiles;
+	std::string outputFileName;
+	std::uintmax_t inputSize;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct TaskResult
+{
+	bool isSuccessful = false;
+	std::chrono::steady_clock::duration duration;
+	std::string messages;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::string readFile(const filesystem::path &path)
+{
+	std::ifstream stream(path.string(), std::ios::in);
+
+	if (!stream)
+		throw std::runtime_error("could not read “" + path.string() + "”");
+
+	std::stringstream content;
+	content << stream.rdbuf();
+
+	return content.str();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::vector<Task> readManifest(const filesystem::path &manifestFile, const std::string &outputExtension)
+{
+	std::ifstream manifestStream(manifestFile.string(), std::ios::in);
+
+	if (!manifestStream)
+		throw std::runtime_error("could not read batch manifest “" + manifestFile.string() + "”");
+
+	const auto baseDirectory = manifestFile.parent_path();
+
+	std::vector<Task> tasks;
+	std::set<std::string> outputFileNames;
+	std::string line;
+
+	for (size_t lineNumber = 1; std::getline(manifestStream, line); lineNumber++)
+	{
+		std::istringstream lineStream(line);
+		std::string inputFile;
+		Task task;
+		task.inputSize = 0;
+
+		while (lineStream >> inputFile)
+		{
+			// Comments extend to the end of the line
+			if (inputFile.front() == '#')
+				break;
+
+			task.inputFiles.emplace_back(baseDirectory / inputFile);
+		}
+
+		if (task.inputFiles.empty())
+			continue;
+
+		if (task.inputFiles.size() > 2)
+			throw std::runtime_error(manifestFile.string() + ":" + std::to_string(lineNumber)
+				+ ": expected a SAS file or a PDDL domain and problem");
+
+		// Missing input files are reported when the task is run
+		for (const auto &path : task.inputFiles)
+		{
+			std::error_code errorCode;
+			const auto fileSize = filesystem::file_size(path, errorCode);
+
+			if (!errorCode)
+				task.inputSize += fileSize;
+		}
+
+		// Outputs are named after the last input file, with suffixes if several share the same name
+		const auto stem = task.inputFiles.back().stem().string();
+		task.outputFileName = stem + outputExtension;
+
+		for (size_t i = 2; outputFileNames.count(task.outputFileName) > 0; i++)
+			task.outputFileName = stem + "-" + std::to_string(i) + outputExtension;
+
+		outputFileNames.insert(task.outputFileName);
+		tasks.emplace_back(std::move(task));
+	}
+
+	return tasks;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int translateBatch(const OptionGroupBasic &basicOptions, const OptionGroupOutput &outputOptions,
+	const OptionGroupParser &parserOptions, const OptionGroupTranslation &translationOptions,
+	const OptionGroupBatch &batchOptions, colorlog::Logger &logger)
+{
+	if (!parserOptions.inputFiles.empty())
+	{
+		logger.log(colorlog::Priority::Error, "the input files of a batch are listed in its manifest, no input files expected");
+		return EXIT_FAILURE;
+	}
+
+	if (!translationOptions.symbolTableFile.empty())
+	{
+		logger.log(colorlog::Priority::Error, "symbol tables are not supported for batches");
+		return EXIT_FAILURE;
+	}
+
+	if (translationOptions.stream)
+		logger.log(colorlog::Priority::Warning, "tasks of a batch are not streamed, ignoring --stream");
+
+	const auto startTime = std::chrono::steady_clock::now();
+	const auto isAspifOutput = (translationOptions.outputFormat == OptionGroupTranslation::OutputFormat::Aspif);
+	const filesystem::path outputDirectory(batchOptions.outputDirectory);
+
+	std::vector<Task> tasks;
+
+	try
+	{
+		// Compressed outputs must not be mistaken for plain ones by their names
+		const std::string outputExtension = std::string(isAspifOutput ? ".aspif" : ".lp")
+			+ (translationOptions.compress ? ".plz" : "");
+
+		tasks = readManifest(batchOptions.manifestFile, outputExtension);
+		filesystem::create_directories(outputDirectory);
+	}
+	catch (const std::exception &e)
+	{
+		logger.log(colorlog::Priority::Error, e.what());
+		return EXIT_FAILURE;
+	}
+
+	// Domains are read once and parsed once per thread at most
+	std::map<filesystem::path, std::string> domains;
+
+	for (const auto &task : tasks)
+		if (task.inputFiles.size() == 2 && domains.count(task.inputFiles.front()) == 0)
+		{
+			try
+			{
+				domains.emplace(task.inputFiles.front(), readFile(task.inputFiles.front()));
+			}
+			catch (const std::exception &)
+			{
+				// Reported by the tasks using the domain
+			}
+		}
+
+	plasp::pddl::DomainCache domainCache(std::max(domains.size(), static_cast<size_t>(1)));
+
+	const auto translatePDDLDescription =
+		[&](const pddl::normalizedAST::Description &description, colorlog::ColorStream &outputStream)
+		{
+			if (isAspifOutput)
+				throw plasp::TranslatorException("aspif output is only supported for SAS input");
+
+			auto translator = plasp::pddl::TranslatorASP(description, outputStream);
+			translator.setNumberOfThreads(translationOptions.numberOfThreads);
+
+			if (translationOptions.compileStaticPredicates)
+				translator.compileStaticPredicates();
+
+			if (translationOptions.synthesizeMutexGroups)
+				translator.synthesizeMutexGroups();
+
+			if (translationOptions.useMultiValuedVariables)
+				translator.useMultiValuedVariables();
+
+			translator.translate();
+		};
+
+	const auto translateSASDescription =
+		[&](const plasp::sas::Description &description, colorlog::ColorStream &outputStream)
+		{
+			if (isAspifOutput)
+			{
+				auto translator = plasp::sas::TranslatorAspif(description, outputStream);
+				translator.setHorizon(translationOptions.horizon);
+				translator.translate();
+				return;
+			}
+
+			auto translator = plasp::sas::TranslatorASP(description, outputStream);
+			translator.setNumberOfThreads(translationOptions.numberOfThreads);
+
+			if (translationOptions.pruningMode != plasp::sas::PruningMode::None)
+				translator.prune(translationOptions.pruningMode);
+
+			translator.translate();
+		};
+
+	const auto translateTask =
+		[&](const Task &task, colorlog::Logger &taskLogger)
+		{
+			const auto logWarning =
+				[&](const auto &location, const auto &warning)
+				{
+					taskLogger.log(colorlog::Priority::Warning, location, warning);
+				};
+
+			auto &outputStream = taskLogger.outputStream();
+
+			// PDDL problems are parsed against the shared domain
+			if (task.inputFiles.size() == 2)
+			{
+				const auto domain = domains.find(task.inputFiles.front());
+
+				if (domain == domains.end())
+					throw std::runtime_error("could not read “" + task.inputFiles.front().string() + "”");
+
+				auto lease = domainCache.lease(domain->second, parserOptions.parsingMode, logWarning, domain->first.string());
+
+				pddl::Context context(pddl::Tokenizer(), logWarning, parserOptions.parsingMode);
+				context.tokenizer.read(task.inputFiles.back().string());
+
+				warnAboutIgnoredOptions(translationOptions, plasp::Language::Type::PDDL, taskLogger);
+				translatePDDLDescription(lease.parseProblem(context), outputStream);
+				return;
+			}
+
+			const auto &inputFile = task.inputFiles.front().string();
+
+			if (plasp::sas::Description::isBinaryFile(inputFile))
+			{
+				warnAboutIgnoredOptions(translationOptions, plasp::Language::Type::SAS, taskLogger);
+				translateSASDescription(plasp::sas::Description::fromBinaryFile(inputFile), outputStream);
+				return;
+			}
+
+			tokenize::Tokenizer<tokenize::CaseInsensitiveTokenizerPolicy> tokenizer;
+			tokenizer.read(inputFile);
+
+			switch (plasp::detectLanguage(tokenizer))
+			{
+				case plasp::Language::Type::PDDL:
+				{
+					warnAboutIgnoredOptions(translationOptions, plasp::Language::Type::PDDL, taskLogger);
+
+					pddl::Context context(std::move(tokenizer), logWarning, parserOptions.parsingMode);
+					translatePDDLDescription(pddl::normalize(pddl::parseDescription(context)), outputStream);
+					return;
+				}
+
+				case plasp::Language::Type::SAS:
+				{
+					warnAboutIgnoredOptions(translationOptions, plasp::Language::Type::SAS, taskLogger);
+					translateSASDescription(plasp::sas::Description::fromTokenizer(std::move(tokenizer)), outputStream);
+					return;
+				}
+
+				default:
+					throw std::runtime_error("unknown input language");
+			}
+		};
+
+	const auto runTask =
+		[&](const Task &task)
+		{
+			TaskResult result;
+			const auto taskStartTime = std::chrono::steady_clock::now();
+
+			std::ofstream outputFileStream((outputDirectory / task.outputFileName).string(), std::ios::out);
+			std::stringstream messageStream;
+
+			std::experimental::optional<CompressedOutput> compressedOutput;
+
+			if (translationOptions.compress)
+				compressedOutput.emplace(outputFileStream);
+
+			{
+				colorlog::Logger taskLogger{colorlog::ColorStream(outputFileStream), colorlog::ColorStream(messageStream)};
+				taskLogger.setColorPolicy(colorlog::ColorStream::ColorPolicy::Never);
+				taskLogger.setLogPriority(outputOptions.logPriority);
+				taskLogger.outputStream().enableOutputBuffer();
+
+				if (basicOptions.warningsAsErrors)
+					taskLogger.setAbortPriority(colorlog::Priority::Warning);
+
+				try
+				{
+					if (!outputFileStream)
+						throw std::runtime_error("could not write to “" + (outputDirectory / task.outputFileName).string() + "”");
+
+					translateTask(task, taskLogger);
+
+					taskLogger.outputStream().flush();
+					result.isSuccessful = (!compressedOutput || compressedOutput->finish())
+						&& static_cast<bool>(outputFileStream.flush());
+				}
+				catch (const tokenize::TokenizerException &e)
+				{
+					taskLogger.log(colorlog::Priority::Error, e.location(), e.message().c_str());
+				}
+				catch (const pddl::ParserException &e)
+				{
+					if (e.location())
+						taskLogger.log(colorlog::Priority::Error, e.location().value(), e.message().c_str());
+					else
+						taskLogger.log(colorlog::Priority::Error, e.message().c_str());
+				}
+				catch (const std::exception &e)
+				{
+					taskLogger.log(colorlog::Priority::Error, e.what());
+				}
+			}
+
+			// Incomplete outputs of failed tasks are removed
+			if (!result.isSuccessful)
+			{
+				// The compressor writes the end of the compressed stream and must not outlive the file
+				compressedOutput = std::experimental::nullopt;
+				outputFileStream.close();
+
+				std::error_code errorCode;
+				filesystem::remove(outputDirectory / task.outputFileName, errorCode);
+			}
+
+			result.duration = std::chrono::steady_clock::now() - taskStartTime;
+			result.messages = messageStream.str();
+
+			return result;
+		};
+
+	// Starting with the largest tasks keeps threads from idling at the end, and threads pick the next
+	// task as soon as they are done, so that they stay busy when tasks vary in size
+	std::vector<size_t> schedule(tasks.size());
+
+	for (size_t i = 0; i < schedule.size(); i++)
+		schedule[i] = i;
+
+	std::stable_sort(schedule.begin(), schedule.end(),
+		[&](const auto &lhs, const auto &rhs)
+		{
+			return tasks[lhs].inputSize > tasks[rhs].inputSize;
+		});
+
+	std::vector<TaskResult> results(tasks.size());
+	std::atomic<size_t> nextScheduledTask{0};
+
+	const auto runTasks =
+		[&]()
+		{
+			for (auto i = nextScheduledTask++; i < schedule.size(); i = nextScheduledTask++)
+				results[schedule[i]] = runTask(tasks[schedule[i]]);
+		};
+
+	const auto numberOfThreads = std::min(plasp::resolveNumberOfThreads(batchOptions.numberOfJobs),
+		std::max(tasks.size(), static_cast<size_t>(1)));
+
+	std::vector<std::thread> threads;
+	threads.reserve(numberOfThreads - 1);
+
+	for (size_t i = 1; i < numberOfThreads; i++)
+		threads.emplace_back(runTasks);
+
+	runTasks();
+
+	for (auto &thread : threads)
+		thread.join();
+
+	const auto toSeconds =
+		[](auto duration)
+		{
+			return std::chrono::duration<double>(duration).count();
+		};
+
+	size_t numberOfFailedTasks = 0;
+
+	for (size_t i = 0; i < tasks.size(); i++)
+		if (!results[i].isSuccessful)
+		{
+			numberOfFailedTasks++;
+
+			const auto &messages = results[i].messages;
+			logger.log(colorlog::Priority::Warning, "task “" + tasks[i].outputFileName + "” failed: "
+				+ messages.substr(0, messages.find('\n')));
+		}
+
+	const auto summaryFile = (outputDirectory / "summary.json").string();
+	std::ofstream summaryStream(summaryFile, std::ios::out);
+
+	summaryStream << std::fixed << std::setprecision(6);
+	summaryStream << "{" << std::endl;
+	summaryStream << "  \"time\": " << toSeconds(std::chrono::steady_clock::now() - startTime) << "," << std::endl;
+	summaryStream << "  \"jobs\": " << numberOfThreads << "," << std::endl;
+	summaryStream << "  \"tasks\": " << tasks.size() << "," << std::endl;
+	summaryStream << "  \"failed tasks\": " << numberOfFailedTasks << "," << std::endl;
+	summaryStream << "  \"results\": [";
+
+	for (size_t i = 0; i < tasks.size(); i++)
+	{
+		summaryStream << (i > 0 ? "," : "") << std::endl << "    {\"inputs\": [";
+
+		for (size_t j = 0; j < tasks[i].inputFiles.size(); j++)
+		{
+			summaryStream << (j > 0 ? ", " : "");
+			plasp::printJSONString(summaryStream, tasks[i].inputFiles[j].string());
+		}
+
+		summaryStream << "], \"output\": ";
+		plasp::printJSONString(summaryStream, tasks[i].outputFileName);
+		summaryStream << ", \"status\": \"" << (results[i].isSuccessful ? "ok" : "error") << "\"";
+		summaryStream << ", \"time\": " << toSeconds(results[i].duration);
+		summaryStream << ", \"messages\": ";
+		plasp::printJSONString(summaryStream, results[i].messages);
+		summaryStream << "}";
+	}
+
+	summaryStream << std::endl << "  ]" << std::endl << "}" << std::endl;
+
+	if (!summaryStream)
+	{
+		logger.log(colorlog::Priority::Error, "could not write summary to “" + summaryFile + "”");
+		return EXIT_FAILURE;
+	}
+
+	logger.log(colorlog::Priority::Info, "translated " + std::to_string(tasks.size() - numberOfFailedTasks) + " of "
+		+ std::to_string(tasks.size()) + " task(s), summary written to “" + summaryFile + "”");
+
+	return (numberOfFailedTasks == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
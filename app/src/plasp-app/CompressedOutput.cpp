@@ -0,0 +1,30 @@
+#include <plasp-app/CompressedOutput.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Compressed Output
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+CompressedOutput::CompressedOutput(std::ostream &stream)
+:	m_stream(stream),
+	m_streamBuffer{stream.rdbuf()},
+	m_compressingStreamBuffer(m_streamBuffer)
+{
+	m_stream.rdbuf(&m_compressingStreamBuffer);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+CompressedOutput::~CompressedOutput()
+{
+	m_compressingStreamBuffer.finish();
+	m_stream.rdbuf(m_streamBuffer);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool CompressedOutput::finish()
+{
+	return m_compressingStreamBuffer.finish();
+}
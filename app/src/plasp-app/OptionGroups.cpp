@@ -106,3 +106,251 @@ void OptionGroupParser::read(const cxxopts::ParseResult &parseResult)
 	if (language == plasp::Language::Type::Unknown)
 		throw OptionException("unknown input language “" + languageName + "”");
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Nasty workaround needed for GCC prior to version 7
+constexpr decltype(OptionGroupTranslation::Name) OptionGroupTranslation::Name;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void OptionGroupTranslation::addTo(cxxopts::Options &options)
+{
+	options.add_options(Name)
+		("threads", "Number of threads used for translation (0: one per CPU core)", cxxopts::value<size_t>()->default_value("1"))
+		("symbol-table", "Print integer symbol IDs instead of names and write the symbol table to this file", cxxopts::value<std::string>())
+		("compile-static-predicates", "Translate predicates not modified by actions as static facts instead of variables (PDDL only)")
+		("synthesize-mutex-groups", "Find invariants and translate them as mutex groups (PDDL only)")
+		("multi-valued-variables", "Merge mutually exclusive atoms into multi-valued variables (PDDL only)")
+		("prune", "Omit actions, variables, and values irrelevant for the goal (forward, backward, both; SAS only)", cxxopts::value<std::string>())
+		("output-format", "Output format (asp: facts, aspif: ground sequential planning program; aspif for SAS only)", cxxopts::value<std::string>()->default_value("asp"))
+		("horizon", "Number of time steps of the ground planning program (aspif output only)", cxxopts::value<size_t>()->default_value("1"))
+		("stream", "Translate the input while parsing it and write the output incrementally")
+		("compress", "Compress the output (read directly by plasp, decompressed by plasp compress -d)");
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void OptionGroupTranslation::read(const cxxopts::ParseResult &parseResult)
+{
+	numberOfThreads = parseResult["threads"].as<size_t>();
+
+	if (parseResult.count("symbol-table"))
+		symbolTableFile = parseResult["symbol-table"].as<std::string>();
+
+	compileStaticPredicates = (parseResult.count("compile-static-predicates") > 0);
+	synthesizeMutexGroups = (parseResult.count("synthesize-mutex-groups") > 0);
+	useMultiValuedVariables = (parseResult.count("multi-valued-variables") > 0);
+
+	if (parseResult.count("prune"))
+	{
+		const auto pruningModeString = parseResult["prune"].as<std::string>();
+
+		if (pruningModeString == "forward")
+			pruningMode = plasp::sas::PruningMode::Forward;
+		else if (pruningModeString == "backward")
+			pruningMode = plasp::sas::PruningMode::Backward;
+		else if (pruningModeString == "both")
+			pruningMode = plasp::sas::PruningMode::Both;
+		else
+			throw OptionException("unknown pruning mode “" + pruningModeString + "”");
+	}
+
+	const auto outputFormatString = parseResult["output-format"].as<std::string>();
+
+	if (outputFormatString == "aspif")
+		outputFormat = OutputFormat::Aspif;
+	else if (outputFormatString != "asp")
+		throw OptionException("unknown output format “" + outputFormatString + "”");
+
+	horizon = parseResult["horizon"].as<size_t>();
+	stream = (parseResult.count("stream") > 0);
+	compress = (parseResult.count("compress") > 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Nasty workaround needed for GCC prior to version 7
+constexpr decltype(OptionGroupBatch::Name) OptionGroupBatch::Name;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void OptionGroupBatch::addTo(cxxopts::Options &options)
+{
+	options.add_options(Name)
+		("batch", "Translate the inputs listed in this manifest file (one task per line: a SAS file or a PDDL domain and problem)", cxxopts::value<std::string>())
+		("jobs", "Number of tasks translated concurrently (0: one per CPU core)", cxxopts::value<size_t>()->default_value("0"))
+		("output-dir", "Directory for the output files and the summary of a batch", cxxopts::value<std::string>());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void OptionGroupBatch::read(const cxxopts::ParseResult &parseResult)
+{
+	if (parseResult.count("batch"))
+		manifestFile = parseResult["batch"].as<std::string>();
+
+	numberOfJobs = parseResult["jobs"].as<size_t>();
+
+	if (parseResult.count("output-dir"))
+		outputDirectory = parseResult["output-dir"].as<std::string>();
+
+	if (!manifestFile.empty() && outputDirectory.empty())
+		throw OptionException("batches require an output directory (--output-dir)");
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Nasty workaround needed for GCC prior to version 7
+constexpr decltype(OptionGroupWatch::Name) OptionGroupWatch::Name;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void OptionGroupWatch::addTo(cxxopts::Options &options)
+{
+	options.add_options(Name)
+		("watch", "Keep translating the PDDL input files whenever they change, writing the output to this file", cxxopts::value<std::string>());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void OptionGroupWatch::read(const cxxopts::ParseResult &parseResult)
+{
+	if (parseResult.count("watch"))
+		outputFile = parseResult["watch"].as<std::string>();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Nasty workaround needed for GCC prior to version 7
+constexpr decltype(OptionGroupStatistics::Name) OptionGroupStatistics::Name;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void OptionGroupStatistics::addTo(cxxopts::Options &options)
+{
+	options.add_options(Name)
+		("stats", "Print the time spent per phase, peak memory usage, and output sizes to stderr")
+		("stats-json", "Write the statistics to this file in JSON format", cxxopts::value<std::string>());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void OptionGroupStatistics::read(const cxxopts::ParseResult &parseResult)
+{
+	printStatistics = (parseResult.count("stats") > 0);
+
+	if (parseResult.count("stats-json"))
+		statisticsJSONFile = parseResult["stats-json"].as<std::string>();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Nasty workaround needed for GCC prior to version 7
+constexpr decltype(OptionGroupConversion::Name) OptionGroupConversion::Name;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void OptionGroupConversion::addTo(cxxopts::Options &options)
+{
+	options.add_options(Name)
+		("to", "Target format (sas-bin: binary SAS description, which translate and ground load directly)", cxxopts::value<std::string>()->default_value("sas-bin"))
+		("o,output", "Output file (default: standard output)", cxxopts::value<std::string>());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void OptionGroupConversion::read(const cxxopts::ParseResult &parseResult)
+{
+	const auto targetFormatString = parseResult["to"].as<std::string>();
+
+	if (targetFormatString == "sas-bin")
+		targetFormat = TargetFormat::SASBinary;
+	else
+		throw OptionException("unknown target format “" + targetFormatString + "”");
+
+	if (parseResult.count("output"))
+		outputFile = parseResult["output"].as<std::string>();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Nasty workaround needed for GCC prior to version 7
+constexpr decltype(OptionGroupServer::Name) OptionGroupServer::Name;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void OptionGroupServer::addTo(cxxopts::Options &options)
+{
+	options.add_options(Name)
+		("socket", "Path of the Unix domain socket to listen on", cxxopts::value<std::string>())
+		("jobs", "Number of requests handled concurrently (0: one per CPU core)", cxxopts::value<size_t>()->default_value("0"))
+		("cache-size", "Number of parsed domains kept in memory", cxxopts::value<size_t>()->default_value("16"));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void OptionGroupServer::read(const cxxopts::ParseResult &parseResult)
+{
+	if (parseResult.count("socket"))
+		socketPath = parseResult["socket"].as<std::string>();
+
+	numberOfJobs = parseResult["jobs"].as<size_t>();
+	cacheCapacity = parseResult["cache-size"].as<size_t>();
+
+	if (cacheCapacity == 0)
+		throw OptionException("cache size must be positive");
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Nasty workaround needed for GCC prior to version 7
+constexpr decltype(OptionGroupSymbolDecoding::Name) OptionGroupSymbolDecoding::Name;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void OptionGroupSymbolDecoding::addTo(cxxopts::Options &options)
+{
+	options.add_options(Name)
+		("i,input", "Input files (answer sets of translations with integer symbol IDs)", cxxopts::value<std::vector<std::string>>())
+		("s,symbol-table", "Symbol table written by plasp translate --symbol-table", cxxopts::value<std::string>());
+	options.parse_positional("input");
+	options.positional_help("[<input file...>]");
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void OptionGroupSymbolDecoding::read(const cxxopts::ParseResult &parseResult)
+{
+	if (parseResult.count("input"))
+		inputFiles = parseResult["input"].as<std::vector<std::string>>();
+
+	if (parseResult.count("symbol-table"))
+		symbolTableFile = parseResult["symbol-table"].as<std::string>();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Nasty workaround needed for GCC prior to version 7
+constexpr decltype(OptionGroupCompression::Name) OptionGroupCompression::Name;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void OptionGroupCompression::addTo(cxxopts::Options &options)
+{
+	options.add_options(Name)
+		("i,input", "Input files", cxxopts::value<std::vector<std::string>>())
+		("d,decompress", "Decompress input files written with --compress or plasp compress");
+	options.parse_positional("input");
+	options.positional_help("[<input file...>]");
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void OptionGroupCompression::read(const cxxopts::ParseResult &parseResult)
+{
+	if (parseResult.count("input"))
+		inputFiles = parseResult["input"].as<std::vector<std::string>>();
+
+	decompress = (parseResult.count("decompress") > 0);
+}
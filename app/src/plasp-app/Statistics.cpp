@@ -0,0 +1,167 @@
+#include <plasp-app/Statistics.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Statistics
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Allocations are only counted with statistics enabled. Each thread counts its own allocations to
+// keep threads from competing for a shared counter, and the counters are summed when reporting
+static std::atomic<bool> isCountingAllocations{false};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class ThreadAllocationCounter;
+
+static std::mutex allocationCountersMutex;
+static ThreadAllocationCounter *allocationCounters = nullptr;
+// Allocations of threads that have finished already
+static std::size_t retiredAllocations = 0;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class ThreadAllocationCounter
+{
+	public:
+		ThreadAllocationCounter()
+		{
+			std::lock_guard<std::mutex> lock(allocationCountersMutex);
+
+			m_next = allocationCounters;
+			allocationCounters = this;
+		}
+
+		~ThreadAllocationCounter()
+		{
+			std::lock_guard<std::mutex> lock(allocationCountersMutex);
+
+			retiredAllocations += numberOfAllocations();
+
+			auto **counter = &allocationCounters;
+
+			while (*counter != this)
+				counter = &(*counter)->m_next;
+
+			*counter = m_next;
+		}
+
+		void count()
+		{
+			// Only this thread writes the counter, so no atomic read-modify-write is needed
+			m_numberOfAllocations.store(numberOfAllocations() + 1, std::memory_order_relaxed);
+		}
+
+		std::size_t numberOfAllocations() const
+		{
+			return m_numberOfAllocations.load(std::memory_order_relaxed);
+		}
+
+		const ThreadAllocationCounter *next() const
+		{
+			return m_next;
+		}
+
+	private:
+		std::atomic<std::size_t> m_numberOfAllocations{0};
+		ThreadAllocationCounter *m_next = nullptr;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Replaces the global allocation function to count allocations. Like the default allocation
+// function, it allocates with malloc, so the default deallocation functions still apply. The aligned
+// and nothrow allocation functions are not replaced, so their allocations are not counted
+void *operator new(std::size_t size)
+{
+	if (isCountingAllocations.load(std::memory_order_relaxed))
+	{
+		// Registering the counter of a thread does not allocate with operator new
+		thread_local ThreadAllocationCounter threadAllocationCounter;
+		threadAllocationCounter.count();
+	}
+
+	if (size == 0)
+		size = 1;
+
+	while (true)
+	{
+		auto *data = std::malloc(size);
+
+		if (data)
+			return data;
+
+		const auto newHandler = std::get_new_handler();
+
+		if (!newHandler)
+			throw std::bad_alloc();
+
+		newHandler();
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void *operator new[](std::size_t size)
+{
+	return operator new(size);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void countAllocations()
+{
+	isCountingAllocations.store(true, std::memory_order_relaxed);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t numberOfAllocations()
+{
+	std::lock_guard<std::mutex> lock(allocationCountersMutex);
+
+	auto allocations = retiredAllocations;
+
+	for (const auto *counter = allocationCounters; counter; counter = counter->next())
+		allocations += counter->numberOfAllocations();
+
+	return allocations;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void reportStatistics(plasp::Statistics &statistics, const plasp::OutputCounter *outputCounter,
+	const OptionGroupStatistics &statisticsOptions)
+{
+	if (!statisticsOptions.printStatistics && statisticsOptions.statisticsJSONFile.empty())
+		return;
+
+	if (outputCounter)
+	{
+		statistics.count("facts", outputCounter->numberOfFacts());
+		statistics.count("output bytes", outputCounter->numberOfBytes());
+	}
+
+	statistics.count("allocations", numberOfAllocations());
+
+	if (statisticsOptions.printStatistics)
+		statistics.print(std::cerr);
+
+	if (statisticsOptions.statisticsJSONFile.empty())
+		return;
+
+	std::ofstream statisticsStream(statisticsOptions.statisticsJSONFile, std::ios::out);
+
+	if (!statisticsStream)
+		throw std::runtime_error("could not write statistics to “" + statisticsOptions.statisticsJSONFile + "”");
+
+	statistics.printJSON(statisticsStream);
+}
@@ -0,0 +1,348 @@
+#include <plasp-app/Translation.h>
+
+#include <experimental/optional>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include <colorlog/ColorStream.h>
+#include <colorlog/Logger.h>
+#include <colorlog/Priority.h>
+#include <colorlog/SymbolTable.h>
+
+#include <pddl/AST.h>
+#include <pddl/Exception.h>
+#include <pddl/Mode.h>
+#include <pddl/Normalize.h>
+#include <pddl/NormalizedASTOutput.h>
+#include <pddl/Parse.h>
+#include <pddl/detail/normalization/Reduction.h>
+
+#include <plasp/LanguageDetection.h>
+#include <plasp/Statistics.h>
+#include <plasp/Symbols.h>
+#include <plasp/TranslatorException.h>
+
+#include <plasp/pddl/StreamingTranslatorASP.h>
+#include <plasp/pddl/TranslatorASP.h>
+#include <plasp/sas/Description.h>
+#include <plasp/sas/StreamingTranslatorASP.h>
+#include <plasp/sas/TranslatorASP.h>
+#include <plasp/sas/TranslatorAspif.h>
+
+#include <plasp-app/CompressedOutput.h>
+#include <plasp-app/Statistics.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Translation
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int translate(const OptionGroupBasic &basicOptions, const OptionGroupOutput &outputOptions,
+	const OptionGroupParser &parserOptions, const OptionGroupTranslation &translationOptions,
+	const OptionGroupStatistics &statisticsOptions, bool ground, const std::function<void()> &printHelp)
+{
+	// The output is only intercepted to compress it and to count facts if requested. Both outlive the
+	// logger, whose output may still be written by a separate thread until it is destroyed, and facts
+	// are counted before compression
+	std::experimental::optional<CompressedOutput> compressedOutput;
+	std::experimental::optional<plasp::OutputCounter> outputCounter;
+
+	colorlog::Logger logger;
+	logger.setColorPolicy(outputOptions.colorPolicy);
+	logger.setLogPriority(outputOptions.logPriority);
+
+	if (basicOptions.warningsAsErrors)
+		logger.setAbortPriority(colorlog::Priority::Warning);
+
+	// Uncolored output (for instance, when not writing to a terminal) takes the fast buffered path,
+	// with full buffers written on a separate thread while translating continues
+	if (!logger.outputStream().supportsColor())
+		logger.outputStream().enableAsynchronousOutput();
+
+	plasp::Statistics statistics;
+
+	if (translationOptions.compress)
+		compressedOutput.emplace(std::cout);
+
+	if (statisticsOptions.printStatistics || !statisticsOptions.statisticsJSONFile.empty())
+	{
+		countAllocations();
+		outputCounter.emplace(std::cout);
+	}
+
+	const auto finish =
+		[&]()
+		{
+			logger.outputStream().flush();
+			reportStatistics(statistics, outputCounter ? &outputCounter.value() : nullptr, statisticsOptions);
+
+			return EXIT_SUCCESS;
+		};
+
+	const auto printCompatibilityInfo =
+		[&]()
+		{
+			if (parserOptions.parsingMode != pddl::Mode::Compatibility)
+				logger.log(colorlog::Priority::Info, "try using --parsing-mode=compatibility for extended legacy feature support");
+		};
+
+	// With a symbol table file, names are replaced with integer symbol IDs in the output
+	const auto enableSymbolIDs =
+		[&](const auto &translator, plasp::Language::Type language)
+		{
+			if (translationOptions.symbolTableFile.empty())
+				return;
+
+			auto symbolTable = std::make_shared<colorlog::SymbolTable>();
+			translator.collectSymbols(*symbolTable);
+
+			std::ofstream symbolTableStream(translationOptions.symbolTableFile, std::ios::out);
+
+			if (!symbolTableStream)
+				throw std::runtime_error("could not write symbol table to “" + translationOptions.symbolTableFile + "”");
+
+			plasp::printSymbolTable(symbolTableStream, *symbolTable, language);
+			logger.outputStream().setSymbolTable(std::move(symbolTable));
+		};
+
+	const auto translateSASDescription =
+		[&](const plasp::sas::Description &description)
+		{
+			if (translationOptions.outputFormat == OptionGroupTranslation::OutputFormat::Aspif)
+			{
+				auto translator = plasp::sas::TranslatorAspif(description, logger.outputStream());
+				translator.setHorizon(translationOptions.horizon);
+				statistics.measure("translation", [&](){translator.translate();});
+				translator.collectStatistics(statistics);
+				return;
+			}
+
+			auto translator = plasp::sas::TranslatorASP(description, logger.outputStream());
+			translator.setNumberOfThreads(translationOptions.numberOfThreads);
+
+			if (translationOptions.pruningMode != plasp::sas::PruningMode::None)
+				statistics.measure("pruning", [&](){translator.prune(translationOptions.pruningMode);});
+
+			enableSymbolIDs(translator, plasp::Language::Type::SAS);
+			statistics.measure("translation", [&](){translator.translate();});
+			translator.collectStatistics(statistics);
+		};
+
+	try
+	{
+		// Binary SAS descriptions are mapped into memory instead of being parsed
+		if (parserOptions.inputFiles.size() == 1 && plasp::sas::Description::isBinaryFile(parserOptions.inputFiles.front()))
+		{
+			if (ground)
+				logger.log(colorlog::Priority::Info, "SAS input is ground already, translating all operators and variables");
+
+			if (translationOptions.stream)
+				logger.log(colorlog::Priority::Warning, "binary SAS descriptions are loaded at once, ignoring --stream");
+
+			warnAboutIgnoredOptions(translationOptions, plasp::Language::Type::SAS, logger);
+
+			const auto description = statistics.measure("loading",
+				[&](){return plasp::sas::Description::fromBinaryFile(parserOptions.inputFiles.front());});
+
+			translateSASDescription(description);
+			return finish();
+		}
+
+		tokenize::Tokenizer<tokenize::CaseInsensitiveTokenizerPolicy> tokenizer;
+
+		statistics.measure("reading",
+			[&]()
+			{
+				if (!parserOptions.inputFiles.empty())
+					std::for_each(parserOptions.inputFiles.cbegin(), parserOptions.inputFiles.cend(),
+						[&](const auto &inputFile)
+						{
+							tokenizer.read(inputFile);
+						});
+				else
+				{
+					logger.log(colorlog::Priority::Info, "reading from stdin");
+					tokenizer.read("std::cin", std::cin);
+				}
+			});
+
+		const auto detectLanguage =
+			[&]()
+			{
+				if (parserOptions.language == plasp::Language::Type::Automatic)
+					return plasp::detectLanguage(tokenizer);
+
+				return parserOptions.language;
+			};
+
+		switch (detectLanguage())
+		{
+			case plasp::Language::Type::Automatic:
+			case plasp::Language::Type::Unknown:
+			{
+				logger.log(colorlog::Priority::Error, "unknown input language");
+				std::cout << std::endl;
+				printHelp();
+				return EXIT_FAILURE;
+			}
+
+			// TODO: get rid of unknown language type, use exception instead
+			case plasp::Language::Type::PDDL:
+			{
+				if (translationOptions.outputFormat == OptionGroupTranslation::OutputFormat::Aspif)
+					throw plasp::TranslatorException("aspif output is only supported for SAS input");
+
+				const auto logWarning =
+					[&](const auto &location, const auto &warning)
+					{
+						logger.log(colorlog::Priority::Warning, location, warning);
+					};
+
+				auto context = pddl::Context(std::move(tokenizer), logWarning);
+				context.mode = parserOptions.parsingMode;
+				context.phaseCallback =
+					[&](const char *phase, auto duration)
+					{
+						statistics.addPhase(phase, duration);
+					};
+
+				warnAboutIgnoredOptions(translationOptions, plasp::Language::Type::PDDL, logger);
+
+				if (translationOptions.stream && ground)
+					logger.log(colorlog::Priority::Warning, "grounding requires the complete problem, ignoring --stream");
+				else if (translationOptions.stream)
+				{
+					// These options analyze the complete problem before anything is translated
+					const auto requiresCompleteProblem = !translationOptions.symbolTableFile.empty()
+						|| translationOptions.compileStaticPredicates
+						|| translationOptions.synthesizeMutexGroups
+						|| translationOptions.useMultiValuedVariables;
+
+					if (!requiresCompleteProblem)
+					{
+						auto translator = plasp::pddl::StreamingTranslatorASP(context, logger.outputStream());
+						statistics.measure("parsing and translation", [&](){translator.translate();});
+						translator.collectStatistics(statistics);
+						return finish();
+					}
+
+					logger.log(colorlog::Priority::Warning, "streaming is not supported with the selected translation options, ignoring --stream");
+				}
+
+				auto description = statistics.measure("parsing", [&](){return pddl::parseDescription(context);});
+				auto normalizedDescription = statistics.measure("normalization",
+					[&](){return pddl::normalize(std::move(description));});
+				auto translator = plasp::pddl::TranslatorASP(std::move(normalizedDescription), logger.outputStream());
+				translator.setNumberOfThreads(translationOptions.numberOfThreads);
+
+				if (translationOptions.compileStaticPredicates)
+					statistics.measure("compiling static predicates", [&](){translator.compileStaticPredicates();});
+
+				if (translationOptions.synthesizeMutexGroups)
+					statistics.measure("synthesizing mutex groups", [&](){translator.synthesizeMutexGroups();});
+
+				if (translationOptions.useMultiValuedVariables)
+					statistics.measure("selecting multi-valued variables", [&](){translator.useMultiValuedVariables();});
+
+				if (ground)
+					statistics.measure("grounding", [&](){translator.ground();});
+
+				enableSymbolIDs(translator, plasp::Language::Type::PDDL);
+				statistics.measure("translation", [&](){translator.translate();});
+				translator.collectStatistics(statistics);
+				return finish();
+			}
+
+			case plasp::Language::Type::SAS:
+			{
+				// SAS descriptions are ground already
+				if (ground)
+					logger.log(colorlog::Priority::Info, "SAS input is ground already, translating all operators and variables");
+
+				warnAboutIgnoredOptions(translationOptions, plasp::Language::Type::SAS, logger);
+
+				if (translationOptions.stream)
+				{
+					// These options analyze the complete description before anything is translated
+					const auto requiresCompleteDescription = !translationOptions.symbolTableFile.empty()
+						|| translationOptions.pruningMode != plasp::sas::PruningMode::None
+						|| translationOptions.outputFormat == OptionGroupTranslation::OutputFormat::Aspif;
+
+					if (!requiresCompleteDescription)
+					{
+						auto translator = plasp::sas::StreamingTranslatorASP(std::move(tokenizer), logger.outputStream());
+						statistics.measure("parsing and translation", [&](){translator.translate();});
+						translator.collectStatistics(statistics);
+						return finish();
+					}
+
+					logger.log(colorlog::Priority::Warning, "streaming is not supported with the selected translation options, ignoring --stream");
+				}
+
+				const auto description = statistics.measure("parsing",
+					[&](){return plasp::sas::Description::fromTokenizer(std::move(tokenizer), translationOptions.numberOfThreads);});
+
+				translateSASDescription(description);
+				return finish();
+			}
+		}
+	}
+	catch (const tokenize::TokenizerException &e)
+	{
+		logger.log(colorlog::Priority::Error, e.location(), e.message().c_str());
+
+		printCompatibilityInfo();
+
+		return EXIT_FAILURE;
+	}
+	catch (const pddl::ParserException &e)
+	{
+		if (e.location())
+			logger.log(colorlog::Priority::Error, e.location().value(), e.message().c_str());
+		else
+			logger.log(colorlog::Priority::Error, e.message().c_str());
+
+		printCompatibilityInfo();
+
+		return EXIT_FAILURE;
+	}
+	catch (const plasp::TranslatorException &e)
+	{
+		logger.log(colorlog::Priority::Error, e.what());
+		return EXIT_FAILURE;
+	}
+	catch (const std::exception &e)
+	{
+		logger.log(colorlog::Priority::Error, e.what());
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void warnAboutIgnoredOptions(const OptionGroupTranslation &translationOptions, plasp::Language::Type language,
+	colorlog::Logger &logger)
+{
+	if (language == plasp::Language::Type::PDDL)
+	{
+		if (translationOptions.pruningMode != plasp::sas::PruningMode::None)
+			logger.log(colorlog::Priority::Warning, "pruning is only supported for SAS input, ignoring --prune");
+
+		return;
+	}
+
+	if (translationOptions.compileStaticPredicates)
+		logger.log(colorlog::Priority::Warning, "compiling static predicates is only supported for PDDL input, ignoring --compile-static-predicates");
+
+	if (translationOptions.synthesizeMutexGroups)
+		logger.log(colorlog::Priority::Warning, "synthesizing mutex groups is only supported for PDDL input, ignoring --synthesize-mutex-groups");
+
+	if (translationOptions.useMultiValuedVariables)
+		logger.log(colorlog::Priority::Warning, "multi-valued variables are only supported for PDDL input, ignoring --multi-valued-variables");
+}
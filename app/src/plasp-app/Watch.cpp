@@ -0,0 +1,275 @@
+#include <plasp-app/Watch.h>
+
+#include <algorithm>
+#include <chrono>
+#include <csignal>
+#include <experimental/filesystem>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include <colorlog/Priority.h>
+
+#include <tokenize/Tokenizer.h>
+
+#include <pddl/Exception.h>
+#include <pddl/Context.h>
+
+#include <plasp/LanguageDetection.h>
+#include <plasp/TranslatorException.h>
+
+#include <plasp/pddl/IncrementalTranslatorASP.h>
+
+namespace filesystem = std::experimental::filesystem;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Watch
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// How often the input files are checked for changes
+constexpr auto PollingInterval = std::chrono::milliseconds(50);
+
+// Set by SIGINT and SIGTERM
+volatile std::sig_atomic_t isInterrupted = 0;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void handleSignal(int)
+{
+	isInterrupted = 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct InputFileState
+{
+	bool operator==(const InputFileState &other) const
+	{
+		return exists == other.exists && modificationTime == other.modificationTime && size == other.size;
+	}
+
+	bool exists;
+	filesystem::file_time_type modificationTime;
+	std::uintmax_t size;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::vector<InputFileState> inputFileStates(const std::vector<std::string> &inputFiles)
+{
+	std::vector<InputFileState> states;
+	states.reserve(inputFiles.size());
+
+	for (const auto &inputFile : inputFiles)
+	{
+		std::error_code errorCode;
+		InputFileState state{true, filesystem::last_write_time(inputFile, errorCode), 0};
+
+		if (!errorCode)
+			state.size = filesystem::file_size(inputFile, errorCode);
+
+		// Editors may replace files while saving them, so missing files are waited for
+		if (errorCode)
+			state = {false, {}, 0};
+
+		states.emplace_back(state);
+	}
+
+	return states;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::string formatDuration(std::chrono::steady_clock::duration duration)
+{
+	std::stringstream stream;
+	stream << std::fixed << std::setprecision(1)
+		<< std::chrono::duration<double, std::milli>(duration).count() << " ms";
+
+	return stream.str();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int translateWatched(const OptionGroupParser &parserOptions, const OptionGroupTranslation &translationOptions,
+	const OptionGroupWatch &watchOptions, colorlog::Logger &logger)
+{
+	if (parserOptions.inputFiles.empty())
+	{
+		logger.log(colorlog::Priority::Error, "watching requires input files");
+		return EXIT_FAILURE;
+	}
+
+	// These options analyze the complete problem, which changes with every action
+	if (!translationOptions.symbolTableFile.empty()
+		|| translationOptions.compileStaticPredicates
+		|| translationOptions.synthesizeMutexGroups
+		|| translationOptions.useMultiValuedVariables)
+	{
+		logger.log(colorlog::Priority::Error, "watching is not supported with the selected translation options");
+		return EXIT_FAILURE;
+	}
+
+	if (translationOptions.stream)
+		logger.log(colorlog::Priority::Warning, "watched inputs are not streamed, ignoring --stream");
+
+	if (translationOptions.compress)
+		logger.log(colorlog::Priority::Warning, "the watched output is not compressed, ignoring --compress");
+
+	const auto readInputFiles =
+		[&]()
+		{
+			tokenize::Tokenizer<tokenize::CaseInsensitiveTokenizerPolicy> tokenizer;
+
+			for (const auto &inputFile : parserOptions.inputFiles)
+				tokenizer.read(inputFile);
+
+			return tokenizer;
+		};
+
+	try
+	{
+		auto tokenizer = readInputFiles();
+
+		const auto language = (parserOptions.language == plasp::Language::Type::Automatic)
+			? plasp::detectLanguage(tokenizer)
+			: parserOptions.language;
+
+		if (language != plasp::Language::Type::PDDL)
+		{
+			logger.log(colorlog::Priority::Error, "watching is only supported for PDDL input");
+			return EXIT_FAILURE;
+		}
+
+		if (translationOptions.outputFormat == OptionGroupTranslation::OutputFormat::Aspif)
+			throw plasp::TranslatorException("aspif output is only supported for SAS input");
+	}
+	catch (const std::exception &e)
+	{
+		logger.log(colorlog::Priority::Error, e.what());
+		return EXIT_FAILURE;
+	}
+
+	const auto logWarning =
+		[&](const auto &location, const auto &warning)
+		{
+			logger.log(colorlog::Priority::Warning, location, warning);
+		};
+
+	plasp::pddl::IncrementalTranslatorASP translator;
+
+	const auto writeOutput =
+		[&]()
+		{
+			// The output file is replaced at once, so that it is never read while partially written
+			const auto temporaryFile = watchOptions.outputFile + ".tmp";
+
+			{
+				std::ofstream outputStream(temporaryFile, std::ios::out);
+
+				if (!outputStream)
+					throw std::runtime_error("could not write output file “" + temporaryFile + "”");
+
+				translator.write(outputStream);
+			}
+
+			filesystem::rename(temporaryFile, watchOptions.outputFile);
+		};
+
+	const auto translate =
+		[&]()
+		{
+			const auto startTime = std::chrono::steady_clock::now();
+
+			pddl::Context context(readInputFiles(), logWarning, parserOptions.parsingMode);
+			const auto update = translator.update(context);
+			writeOutput();
+
+			std::string parsedParts;
+
+			if (update.isComplete)
+				parsedParts = "parsed everything";
+			else
+			{
+				parsedParts = "parsed " + std::to_string(update.numberOfParsedActions) + " of "
+					+ std::to_string(translator.numberOfActions()) + " actions";
+
+				if (update.isProblemParsed)
+					parsedParts += " and the problem";
+			}
+
+			logger.log(colorlog::Priority::Info, "translated to “" + watchOptions.outputFile + "” in "
+				+ formatDuration(std::chrono::steady_clock::now() - startTime) + " (" + parsedParts + ")");
+		};
+
+	// Parser errors are reported, and the previous output is kept until the input files are fixed
+	const auto tryTranslating =
+		[&]()
+		{
+			try
+			{
+				translate();
+			}
+			catch (const tokenize::TokenizerException &e)
+			{
+				logger.log(colorlog::Priority::Error, e.location(), e.message().c_str());
+			}
+			catch (const pddl::ParserException &e)
+			{
+				if (e.location())
+					logger.log(colorlog::Priority::Error, e.location().value(), e.message().c_str());
+				else
+					logger.log(colorlog::Priority::Error, e.message().c_str());
+			}
+			catch (const std::exception &e)
+			{
+				logger.log(colorlog::Priority::Error, e.what());
+			}
+		};
+
+	std::signal(SIGINT, handleSignal);
+	std::signal(SIGTERM, handleSignal);
+
+	auto previousInputFileStates = inputFileStates(parserOptions.inputFiles);
+	tryTranslating();
+
+	logger.log(colorlog::Priority::Info, "watching the input files for changes");
+
+	while (!isInterrupted)
+	{
+		std::this_thread::sleep_for(PollingInterval);
+
+		const auto currentInputFileStates = inputFileStates(parserOptions.inputFiles);
+
+		if (currentInputFileStates == previousInputFileStates)
+			continue;
+
+		previousInputFileStates = currentInputFileStates;
+
+		const auto allInputFilesExist = std::all_of(currentInputFileStates.cbegin(), currentInputFileStates.cend(),
+			[](const auto &state)
+			{
+				return state.exists;
+			});
+
+		if (allInputFilesExist)
+			tryTranslating();
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,140 @@
+#include <plasp-app/commands/CommandCompress.h>
+
+#include <algorithm>
+#include <experimental/optional>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+
+#include <cxxopts.hpp>
+
+#include <colorlog/Logger.h>
+#include <colorlog/Priority.h>
+
+#include <lz/Decompressor.h>
+#include <lz/Format.h>
+
+#include <plasp-app/CompressedOutput.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Command Compress
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void compress(std::istream &inputStream, std::ostream &outputStream)
+{
+	std::copy(std::istreambuf_iterator<char>(inputStream), std::istreambuf_iterator<char>(),
+		std::ostreambuf_iterator<char>(outputStream));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void decompress(const std::string &inputName, std::istream &inputStream, std::ostream &outputStream)
+{
+	char magic[lz::MagicSize];
+	inputStream.read(magic, lz::MagicSize);
+
+	if (!lz::isMagic(magic, static_cast<std::size_t>(inputStream.gcount())))
+		throw std::runtime_error("“" + inputName + "” is not compressed");
+
+	lz::Decompressor decompressor(inputStream);
+	std::string block;
+
+	try
+	{
+		while (decompressor.readBlock(block))
+		{
+			outputStream.write(block.data(), static_cast<std::streamsize>(block.size()));
+			block.clear();
+		}
+	}
+	catch (const lz::FormatException &e)
+	{
+		throw std::runtime_error("could not decompress “" + inputName + "”: " + e.what());
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int CommandCompress::run(int argc, char **argv)
+{
+	parseOptions(argc, argv);
+
+	const auto &basicOptions = std::get<OptionGroupBasic>(m_optionGroups);
+	const auto &outputOptions = std::get<OptionGroupOutput>(m_optionGroups);
+	const auto &compressionOptions = std::get<OptionGroupCompression>(m_optionGroups);
+
+	if (basicOptions.help)
+	{
+		printHelp();
+		return EXIT_SUCCESS;
+	}
+
+	if (basicOptions.version)
+	{
+		printVersion();
+		return EXIT_SUCCESS;
+	}
+
+	colorlog::Logger logger;
+	logger.setColorPolicy(outputOptions.colorPolicy);
+	logger.setLogPriority(outputOptions.logPriority);
+
+	if (basicOptions.warningsAsErrors)
+		logger.setAbortPriority(colorlog::Priority::Warning);
+
+	try
+	{
+		// All input files are compressed into one stream, just like plasp reads them as one
+		std::experimental::optional<CompressedOutput> compressedOutput;
+
+		if (!compressionOptions.decompress)
+			compressedOutput.emplace(std::cout);
+
+		const auto process =
+			[&](const std::string &inputName, std::istream &inputStream)
+			{
+				if (compressionOptions.decompress)
+					decompress(inputName, inputStream, std::cout);
+				else
+					compress(inputStream, std::cout);
+			};
+
+		if (compressionOptions.inputFiles.empty())
+		{
+			logger.log(colorlog::Priority::Info, "reading from stdin");
+			process("std::cin", std::cin);
+		}
+
+		for (const auto &inputFile : compressionOptions.inputFiles)
+		{
+			std::ifstream inputStream(inputFile, std::ios::in | std::ios::binary);
+
+			if (!inputStream)
+				throw std::runtime_error("File does not exist: “" + inputFile + "”");
+
+			process(inputFile, inputStream);
+		}
+
+		if ((compressedOutput && !compressedOutput->finish()) || !std::cout.flush())
+			throw std::runtime_error("could not write output");
+	}
+	catch (const std::exception &e)
+	{
+		logger.log(colorlog::Priority::Error, e.what());
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
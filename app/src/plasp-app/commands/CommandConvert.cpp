@@ -0,0 +1,114 @@
+#include <plasp-app/commands/CommandConvert.h>
+
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include <cxxopts.hpp>
+
+#include <colorlog/Logger.h>
+#include <colorlog/Priority.h>
+
+#include <tokenize/TokenizerException.h>
+
+#include <plasp/LanguageDetection.h>
+#include <plasp/TranslatorException.h>
+
+#include <plasp/sas/Description.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Command Convert
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int CommandConvert::run(int argc, char **argv)
+{
+	parseOptions(argc, argv);
+
+	const auto &basicOptions = std::get<OptionGroupBasic>(m_optionGroups);
+	const auto &outputOptions = std::get<OptionGroupOutput>(m_optionGroups);
+	const auto &parserOptions = std::get<OptionGroupParser>(m_optionGroups);
+	const auto &conversionOptions = std::get<OptionGroupConversion>(m_optionGroups);
+
+	if (basicOptions.help)
+	{
+		printHelp();
+		return EXIT_SUCCESS;
+	}
+
+	if (basicOptions.version)
+	{
+		printVersion();
+		return EXIT_SUCCESS;
+	}
+
+	colorlog::Logger logger;
+	logger.setColorPolicy(outputOptions.colorPolicy);
+	logger.setLogPriority(outputOptions.logPriority);
+
+	if (basicOptions.warningsAsErrors)
+		logger.setAbortPriority(colorlog::Priority::Warning);
+
+	try
+	{
+		if (parserOptions.inputFiles.size() == 1 && plasp::sas::Description::isBinaryFile(parserOptions.inputFiles.front()))
+			throw plasp::TranslatorException("input is a binary SAS description already");
+
+		tokenize::Tokenizer<tokenize::CaseInsensitiveTokenizerPolicy> tokenizer;
+
+		if (!parserOptions.inputFiles.empty())
+			std::for_each(parserOptions.inputFiles.cbegin(), parserOptions.inputFiles.cend(),
+				[&](const auto &inputFile)
+				{
+					tokenizer.read(inputFile);
+				});
+		else
+		{
+			logger.log(colorlog::Priority::Info, "reading from stdin");
+			tokenizer.read("std::cin", std::cin);
+		}
+
+		const auto language = (parserOptions.language == plasp::Language::Type::Automatic)
+			? plasp::detectLanguage(tokenizer)
+			: parserOptions.language;
+
+		if (language != plasp::Language::Type::SAS)
+			throw plasp::TranslatorException("only SAS input can be converted to the binary SAS format");
+
+		const auto description = plasp::sas::Description::fromTokenizer(std::move(tokenizer));
+
+		if (conversionOptions.outputFile.empty())
+		{
+			description.writeBinary(std::cout);
+			return EXIT_SUCCESS;
+		}
+
+		std::ofstream outputStream(conversionOptions.outputFile, std::ios::out | std::ios::binary);
+
+		if (!outputStream)
+			throw std::runtime_error("could not write to “" + conversionOptions.outputFile + "”");
+
+		description.writeBinary(outputStream);
+
+		if (!outputStream)
+			throw std::runtime_error("could not write to “" + conversionOptions.outputFile + "”");
+	}
+	catch (const tokenize::TokenizerException &e)
+	{
+		logger.log(colorlog::Priority::Error, e.location(), e.message().c_str());
+		return EXIT_FAILURE;
+	}
+	catch (const plasp::TranslatorException &e)
+	{
+		logger.log(colorlog::Priority::Error, e.what());
+		return EXIT_FAILURE;
+	}
+	catch (const std::exception &e)
+	{
+		logger.log(colorlog::Priority::Error, e.what());
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,91 @@
+#include <plasp-app/commands/CommandDecodeSymbols.h>
+
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include <cxxopts.hpp>
+
+#include <colorlog/Logger.h>
+#include <colorlog/Priority.h>
+
+#include <tokenize/TokenizerException.h>
+
+#include <plasp/Symbols.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Command Decode Symbols
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int CommandDecodeSymbols::run(int argc, char **argv)
+{
+	parseOptions(argc, argv);
+
+	const auto &basicOptions = std::get<OptionGroupBasic>(m_optionGroups);
+	const auto &outputOptions = std::get<OptionGroupOutput>(m_optionGroups);
+	const auto &decodingOptions = std::get<OptionGroupSymbolDecoding>(m_optionGroups);
+
+	if (basicOptions.help)
+	{
+		printHelp();
+		return EXIT_SUCCESS;
+	}
+
+	if (basicOptions.version)
+	{
+		printVersion();
+		return EXIT_SUCCESS;
+	}
+
+	colorlog::Logger logger;
+	logger.setColorPolicy(outputOptions.colorPolicy);
+	logger.setLogPriority(outputOptions.logPriority);
+
+	if (basicOptions.warningsAsErrors)
+		logger.setAbortPriority(colorlog::Priority::Warning);
+
+	if (decodingOptions.symbolTableFile.empty())
+	{
+		logger.log(colorlog::Priority::Error, "no symbol table specified");
+		std::cout << std::endl;
+		printHelp();
+		return EXIT_FAILURE;
+	}
+
+	try
+	{
+		const auto symbolDecoder = plasp::SymbolDecoder::fromFile(decodingOptions.symbolTableFile);
+
+		if (decodingOptions.inputFiles.empty())
+		{
+			logger.log(colorlog::Priority::Info, "reading from stdin");
+			symbolDecoder.decode(std::cin, std::cout);
+
+			return EXIT_SUCCESS;
+		}
+
+		for (const auto &inputFile : decodingOptions.inputFiles)
+		{
+			std::ifstream inputStream(inputFile, std::ios::in);
+
+			if (!inputStream)
+				throw std::runtime_error("File does not exist: “" + inputFile + "”");
+
+			symbolDecoder.decode(inputStream, std::cout);
+		}
+	}
+	catch (const tokenize::TokenizerException &e)
+	{
+		logger.log(colorlog::Priority::Error, e.location(), e.message().c_str());
+		return EXIT_FAILURE;
+	}
+	catch (const std::exception &e)
+	{
+		logger.log(colorlog::Priority::Error, e.what());
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
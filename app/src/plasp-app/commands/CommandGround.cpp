@@ -0,0 +1,35 @@
+#include <plasp-app/commands/CommandGround.h>
+
+#include <plasp-app/Translation.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Command Ground
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int CommandGround::run(int argc, char **argv)
+{
+	parseOptions(argc, argv);
+
+	const auto &basicOptions = std::get<OptionGroupBasic>(m_optionGroups);
+	const auto &outputOptions = std::get<OptionGroupOutput>(m_optionGroups);
+	const auto &parserOptions = std::get<OptionGroupParser>(m_optionGroups);
+	const auto &translationOptions = std::get<OptionGroupTranslation>(m_optionGroups);
+	const auto &statisticsOptions = std::get<OptionGroupStatistics>(m_optionGroups);
+
+	if (basicOptions.help)
+	{
+		printHelp();
+		return EXIT_SUCCESS;
+	}
+
+	if (basicOptions.version)
+	{
+		printVersion();
+		return EXIT_SUCCESS;
+	}
+
+	return translate(basicOptions, outputOptions, parserOptions, translationOptions, statisticsOptions,
+		true, [&](){printHelp();});
+}
@@ -28,6 +28,26 @@ int CommandHelp::run(int argc, char **argv)
 					CommandTranslate().printHelp();
 					return EXIT_SUCCESS;
 
+				case CommandType::Ground:
+					CommandGround().printHelp();
+					return EXIT_SUCCESS;
+
+				case CommandType::Convert:
+					CommandConvert().printHelp();
+					return EXIT_SUCCESS;
+
+				case CommandType::DecodeSymbols:
+					CommandDecodeSymbols().printHelp();
+					return EXIT_SUCCESS;
+
+				case CommandType::Compress:
+					CommandCompress().printHelp();
+					return EXIT_SUCCESS;
+
+				case CommandType::Serve:
+					CommandServe().printHelp();
+					return EXIT_SUCCESS;
+
 				case CommandType::Normalize:
 					CommandNormalize().printHelp();
 					return EXIT_SUCCESS;
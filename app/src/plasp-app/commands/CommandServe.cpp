@@ -0,0 +1,690 @@
+#include <plasp-app/commands/CommandServe.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cxxopts.hpp>
+
+#include <colorlog/ColorStream.h>
+#include <colorlog/Logger.h>
+#include <colorlog/Priority.h>
+
+#include <pddl/Exception.h>
+#include <pddl/Mode.h>
+#include <pddl/NormalizedASTOutput.h>
+#include <pddl/Tokenizer.h>
+
+#include <plasp/ParallelTranslation.h>
+#include <plasp/TranslatorException.h>
+
+#include <plasp/pddl/DomainCache.h>
+#include <plasp/pddl/TranslatorASP.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Command Serve
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// How often blocking socket operations check whether the server is shutting down
+constexpr int ShutdownPollingInterval = 100;
+// Clients stalling within a request for longer are disconnected, releasing the worker
+constexpr int RequestTimeout = 30 * 1000;
+constexpr std::size_t ConnectionBufferSize = 64 * 1024;
+constexpr std::size_t MaximumHeaderLength = 256;
+// Larger domains or problems are rejected before any memory is allocated for them
+constexpr std::size_t MaximumRequestBodySize = 256 * 1024 * 1024;
+
+// Set by SIGINT and SIGTERM and on errors, and read by the workers (lock-free, so that the signal
+// handler may set it)
+std::atomic<bool> isShuttingDown{false};
+
+static_assert(std::atomic<bool>::is_always_lock_free, "signal handlers require lock-free atomics");
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void handleSignal(int)
+{
+	isShuttingDown = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::runtime_error systemError(const std::string &message)
+{
+	return std::runtime_error(message + ": " + std::strerror(errno));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Waits until the file descriptor is readable, returning false if the server shuts down meanwhile
+bool waitUntilReadable(int fileDescriptor)
+{
+	pollfd pollFileDescriptor{fileDescriptor, POLLIN, 0};
+
+	for (int waitingTime = 0; !isShuttingDown; waitingTime += ShutdownPollingInterval)
+	{
+		if (waitingTime >= RequestTimeout)
+			throw std::runtime_error("request timed out");
+
+		const auto result = poll(&pollFileDescriptor, 1, ShutdownPollingInterval);
+
+		if (result > 0)
+			return true;
+
+		if (result < 0 && errno != EINTR)
+			throw systemError("could not poll socket");
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Buffered reading and writing on an accepted client connection, which is closed on destruction
+class Connection
+{
+	public:
+		explicit Connection(int fileDescriptor)
+		:	m_fileDescriptor{fileDescriptor},
+			m_buffer(ConnectionBufferSize),
+			m_begin{0},
+			m_end{0}
+		{
+		}
+
+		Connection(const Connection &other) = delete;
+		Connection &operator=(const Connection &other) = delete;
+
+		~Connection()
+		{
+			close(m_fileDescriptor);
+		}
+
+		int fileDescriptor() const
+		{
+			return m_fileDescriptor;
+		}
+
+		// Whether the client already sent (part of) the next request
+		bool hasBufferedData() const
+		{
+			return m_begin < m_end;
+		}
+
+		// Returns false if the client closed the connection before sending another line
+		bool readLine(std::string &line)
+		{
+			line.clear();
+
+			while (true)
+			{
+				if (m_begin == m_end && !fill())
+				{
+					if (line.empty())
+						return false;
+
+					throw std::runtime_error("connection closed within request header");
+				}
+
+				const auto begin = m_buffer.begin() + m_begin;
+				const auto end = m_buffer.begin() + m_end;
+				const auto newline = std::find(begin, end, '\n');
+
+				line.append(begin, newline);
+				m_begin = newline - m_buffer.begin();
+
+				if (newline != end)
+				{
+					m_begin++;
+					return true;
+				}
+
+				if (line.size() > MaximumHeaderLength)
+					throw std::runtime_error("request header too long");
+			}
+		}
+
+		void read(std::string &data, std::size_t size)
+		{
+			data.clear();
+			data.reserve(size);
+
+			while (data.size() < size)
+			{
+				if (m_begin == m_end && !fill())
+					throw std::runtime_error("connection closed within request body");
+
+				const auto length = std::min(m_end - m_begin, size - data.size());
+
+				data.append(m_buffer.data() + m_begin, length);
+				m_begin += length;
+			}
+		}
+
+		void write(const std::string &data)
+		{
+			for (std::size_t position = 0; position < data.size();)
+			{
+				const auto result = send(m_fileDescriptor, data.data() + position, data.size() - position, MSG_NOSIGNAL);
+
+				if (result < 0)
+				{
+					if (errno == EINTR)
+						continue;
+
+					throw systemError("could not send response");
+				}
+
+				position += result;
+			}
+		}
+
+	private:
+		bool fill()
+		{
+			while (waitUntilReadable(m_fileDescriptor))
+			{
+				const auto result = recv(m_fileDescriptor, m_buffer.data(), m_buffer.size(), 0);
+
+				if (result < 0)
+				{
+					if (errno == EINTR)
+						continue;
+
+					throw systemError("could not receive request");
+				}
+
+				m_begin = 0;
+				m_end = result;
+
+				return (result > 0);
+			}
+
+			return false;
+		}
+
+		int m_fileDescriptor;
+		std::vector<char> m_buffer;
+		std::size_t m_begin;
+		std::size_t m_end;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int listenOnSocket(const std::string &socketPath)
+{
+	sockaddr_un address;
+	std::memset(&address, 0, sizeof(address));
+	address.sun_family = AF_UNIX;
+
+	if (socketPath.size() >= sizeof(address.sun_path))
+		throw std::runtime_error("socket path “" + socketPath + "” too long");
+
+	std::strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+
+	const auto fileDescriptor = socket(AF_UNIX, SOCK_STREAM, 0);
+
+	if (fileDescriptor < 0)
+		throw systemError("could not create socket");
+
+	// Sockets left behind by servers that did not shut down properly are replaced
+	struct stat status;
+
+	if (stat(socketPath.c_str(), &status) == 0 && S_ISSOCK(status.st_mode))
+	{
+		if (connect(fileDescriptor, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) == 0)
+		{
+			close(fileDescriptor);
+			throw std::runtime_error("socket “" + socketPath + "” is already in use");
+		}
+
+		unlink(socketPath.c_str());
+	}
+
+	// Only the user running the server may connect to it
+	const auto previousFileModeMask = umask(S_IRWXG | S_IRWXO);
+	const auto bindResult = bind(fileDescriptor, reinterpret_cast<const sockaddr *>(&address), sizeof(address));
+	umask(previousFileModeMask);
+
+	if (bindResult < 0 || listen(fileDescriptor, SOMAXCONN) < 0)
+	{
+		const auto error = systemError("could not listen on socket “" + socketPath + "”");
+		close(fileDescriptor);
+		throw error;
+	}
+
+	return fileDescriptor;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int CommandServe::run(int argc, char **argv)
+{
+	parseOptions(argc, argv);
+
+	const auto &basicOptions = std::get<OptionGroupBasic>(m_optionGroups);
+	const auto &outputOptions = std::get<OptionGroupOutput>(m_optionGroups);
+	const auto &parserOptions = std::get<OptionGroupParser>(m_optionGroups);
+	const auto &translationOptions = std::get<OptionGroupTranslation>(m_optionGroups);
+	const auto &serverOptions = std::get<OptionGroupServer>(m_optionGroups);
+
+	if (basicOptions.help)
+	{
+		printHelp();
+		return EXIT_SUCCESS;
+	}
+
+	if (basicOptions.version)
+	{
+		printVersion();
+		return EXIT_SUCCESS;
+	}
+
+	colorlog::Logger logger;
+	logger.setColorPolicy(outputOptions.colorPolicy);
+	logger.setLogPriority(outputOptions.logPriority);
+
+	if (serverOptions.socketPath.empty())
+	{
+		logger.log(colorlog::Priority::Error, "no socket specified (--socket)");
+		return EXIT_FAILURE;
+	}
+
+	if (!parserOptions.inputFiles.empty())
+	{
+		logger.log(colorlog::Priority::Error, "plasp serve reads its input from the socket, no input files expected");
+		return EXIT_FAILURE;
+	}
+
+	if (parserOptions.language == plasp::Language::Type::SAS
+		|| translationOptions.outputFormat == OptionGroupTranslation::OutputFormat::Aspif
+		|| !translationOptions.symbolTableFile.empty())
+	{
+		logger.log(colorlog::Priority::Error, "plasp serve only supports PDDL input and ASP output without symbol tables");
+		return EXIT_FAILURE;
+	}
+
+	if (translationOptions.pruningMode != plasp::sas::PruningMode::None)
+		logger.log(colorlog::Priority::Warning, "pruning is only supported for SAS input, ignoring --prune");
+
+	if (translationOptions.stream)
+		logger.log(colorlog::Priority::Warning, "responses are sent as a whole, ignoring --stream");
+
+	if (translationOptions.compress)
+		logger.log(colorlog::Priority::Warning, "responses are not compressed, ignoring --compress");
+
+	plasp::pddl::DomainCache domainCache(serverOptions.cacheCapacity);
+
+	// Requests consist of a header line “<command> <domain size> <problem size>” followed by the
+	// domain and the problem, and responses of a header line “<status> <output size> <log size>”
+	// followed by the output and the log messages (status: ok or error)
+	const auto handleRequest =
+		[&](const std::string &command, const std::string &domain, const std::string &problem)
+		{
+			std::stringstream output;
+			std::stringstream log;
+			bool isSuccessful = false;
+
+			{
+				colorlog::Logger requestLogger{colorlog::ColorStream(output), colorlog::ColorStream(log)};
+				requestLogger.setColorPolicy(colorlog::ColorStream::ColorPolicy::Never);
+				requestLogger.setLogPriority(outputOptions.logPriority);
+				requestLogger.outputStream().enableOutputBuffer();
+
+				if (basicOptions.warningsAsErrors)
+					requestLogger.setAbortPriority(colorlog::Priority::Warning);
+
+				const auto logWarning =
+					[&](const auto &location, const auto &warning)
+					{
+						requestLogger.log(colorlog::Priority::Warning, location, warning);
+					};
+
+				try
+				{
+					if (command != "translate" && command != "normalize")
+						throw std::runtime_error("unknown command “" + command + "”");
+
+					auto lease = domainCache.lease(domain, parserOptions.parsingMode, logWarning);
+
+					if (!problem.empty())
+					{
+						std::istringstream problemStream(problem);
+
+						pddl::Context context(pddl::Tokenizer(), logWarning, parserOptions.parsingMode);
+						context.tokenizer.read("problem", problemStream);
+						lease.parseProblem(context);
+					}
+
+					if (command == "normalize")
+						requestLogger.outputStream() << lease.description();
+					else
+					{
+						auto translator = plasp::pddl::TranslatorASP(lease.description(), requestLogger.outputStream());
+						translator.setNumberOfThreads(translationOptions.numberOfThreads);
+
+						if (translationOptions.compileStaticPredicates)
+							translator.compileStaticPredicates();
+
+						if (translationOptions.synthesizeMutexGroups)
+							translator.synthesizeMutexGroups();
+
+						if (translationOptions.useMultiValuedVariables)
+							translator.useMultiValuedVariables();
+
+						translator.translate();
+					}
+
+					requestLogger.outputStream().flush();
+					isSuccessful = true;
+				}
+				catch (const tokenize::TokenizerException &e)
+				{
+					requestLogger.log(colorlog::Priority::Error, e.location(), e.message().c_str());
+				}
+				catch (const pddl::ParserException &e)
+				{
+					if (e.location())
+						requestLogger.log(colorlog::Priority::Error, e.location().value(), e.message().c_str());
+					else
+						requestLogger.log(colorlog::Priority::Error, e.message().c_str());
+				}
+				catch (const std::exception &e)
+				{
+					requestLogger.log(colorlog::Priority::Error, e.what());
+				}
+			}
+
+			const auto outputString = isSuccessful ? output.str() : std::string();
+			const auto logString = log.str();
+
+			return std::string(isSuccessful ? "ok " : "error ") + std::to_string(outputString.size()) + " "
+				+ std::to_string(logString.size()) + "\n" + outputString + logString;
+		};
+
+	const auto writeError =
+		[](Connection &connection, const std::string &message)
+		{
+			connection.write("error 0 " + std::to_string(message.size()) + "\n" + message);
+		};
+
+	// Clients may send any number of requests over one connection, each of which is handled on its
+	// own, returning false if the connection is to be closed
+	const auto handleNextRequest =
+		[&](Connection &connection)
+		{
+			try
+			{
+				std::string header;
+
+				if (!connection.readLine(header))
+					return false;
+
+				std::istringstream headerStream(header);
+				std::string command;
+				std::size_t domainSize;
+				std::size_t problemSize;
+
+				if (!(headerStream >> command >> domainSize >> problemSize))
+				{
+					writeError(connection, "malformed request header\n");
+					return false;
+				}
+
+				// The connection is closed, as the oversized body cannot be skipped reliably
+				if (domainSize > MaximumRequestBodySize || problemSize > MaximumRequestBodySize)
+				{
+					writeError(connection, "request too large (at most "
+						+ std::to_string(MaximumRequestBodySize) + " bytes per domain and problem)\n");
+					return false;
+				}
+
+				std::string domain;
+				std::string problem;
+
+				connection.read(domain, domainSize);
+				connection.read(problem, problemSize);
+				connection.write(handleRequest(command, domain, problem));
+
+				return true;
+			}
+			catch (const std::exception &)
+			{
+				// The client went away or stalled, nobody is left to be notified
+				return false;
+			}
+		};
+
+	int wakeUpPipe[2];
+
+	if (pipe2(wakeUpPipe, O_NONBLOCK | O_CLOEXEC) < 0)
+	{
+		logger.log(colorlog::Priority::Error, systemError("could not create pipe").what());
+		return EXIT_FAILURE;
+	}
+
+	// Connections with a request to be handled wait for a worker, and workers return connections to
+	// the main thread between requests, so that idle clients do not occupy workers
+	std::deque<std::unique_ptr<Connection>> pendingConnections;
+	std::deque<std::unique_ptr<Connection>> returnedConnections;
+	std::mutex mutex;
+	std::condition_variable connectionPending;
+
+	const auto wakeUpMainThread =
+		[&]()
+		{
+			const char byte = 0;
+
+			// If the pipe is full, the main thread is woken up anyway
+			if (write(wakeUpPipe[1], &byte, 1) < 0)
+				return;
+		};
+
+	const auto handleConnections =
+		[&]()
+		{
+			while (true)
+			{
+				std::unique_ptr<Connection> connection;
+
+				{
+					std::unique_lock<std::mutex> lock(mutex);
+					connectionPending.wait_for(lock, std::chrono::milliseconds(ShutdownPollingInterval),
+						[&](){return !pendingConnections.empty() || isShuttingDown;});
+
+					if (pendingConnections.empty())
+					{
+						if (isShuttingDown)
+							return;
+
+						continue;
+					}
+
+					connection = std::move(pendingConnections.front());
+					pendingConnections.pop_front();
+				}
+
+				// Closed connections are destroyed here
+				if (!handleNextRequest(*connection))
+					continue;
+
+				std::lock_guard<std::mutex> lock(mutex);
+
+				// Requests that were already (partly) received are handled right away
+				if (connection->hasBufferedData())
+				{
+					pendingConnections.push_back(std::move(connection));
+					connectionPending.notify_one();
+					continue;
+				}
+
+				returnedConnections.push_back(std::move(connection));
+				wakeUpMainThread();
+			}
+		};
+
+	int listeningFileDescriptor;
+
+	try
+	{
+		listeningFileDescriptor = listenOnSocket(serverOptions.socketPath);
+	}
+	catch (const std::exception &e)
+	{
+		logger.log(colorlog::Priority::Error, e.what());
+		close(wakeUpPipe[0]);
+		close(wakeUpPipe[1]);
+		return EXIT_FAILURE;
+	}
+
+	std::signal(SIGINT, handleSignal);
+	std::signal(SIGTERM, handleSignal);
+
+	const auto numberOfJobs = plasp::resolveNumberOfThreads(serverOptions.numberOfJobs);
+
+	std::vector<std::thread> workers;
+	workers.reserve(numberOfJobs);
+
+	for (std::size_t i = 0; i < numberOfJobs; i++)
+		workers.emplace_back(handleConnections);
+
+	logger.log(colorlog::Priority::Info, "listening on “" + serverOptions.socketPath + "” with "
+		+ std::to_string(numberOfJobs) + " worker thread(s)");
+
+	int exitCode = EXIT_SUCCESS;
+
+	// The main thread accepts connections and waits for the next requests of idle connections
+	std::vector<std::unique_ptr<Connection>> idleConnections;
+	std::vector<pollfd> pollFileDescriptors;
+
+	try
+	{
+		while (!isShuttingDown)
+		{
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+
+				for (auto &connection : returnedConnections)
+					idleConnections.emplace_back(std::move(connection));
+
+				returnedConnections.clear();
+			}
+
+			pollFileDescriptors.clear();
+			pollFileDescriptors.push_back({listeningFileDescriptor, POLLIN, 0});
+			pollFileDescriptors.push_back({wakeUpPipe[0], POLLIN, 0});
+
+			for (const auto &connection : idleConnections)
+				pollFileDescriptors.push_back({connection->fileDescriptor(), POLLIN, 0});
+
+			const auto result = poll(pollFileDescriptors.data(), pollFileDescriptors.size(), ShutdownPollingInterval);
+
+			if (result < 0)
+			{
+				if (errno == EINTR)
+					continue;
+
+				throw systemError("could not poll sockets");
+			}
+
+			if (pollFileDescriptors[1].revents != 0)
+			{
+				char buffer[64];
+
+				while (read(wakeUpPipe[0], buffer, sizeof(buffer)) > 0);
+			}
+
+			// Connections with a new request, or closed by the client, are handed over to the workers
+			size_t numberOfIdleConnections = 0;
+
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+
+				for (size_t i = 0; i < idleConnections.size(); i++)
+				{
+					if (pollFileDescriptors[i + 2].revents != 0)
+						pendingConnections.push_back(std::move(idleConnections[i]));
+					else
+						idleConnections[numberOfIdleConnections++] = std::move(idleConnections[i]);
+				}
+			}
+
+			if (numberOfIdleConnections < idleConnections.size())
+			{
+				idleConnections.resize(numberOfIdleConnections);
+				connectionPending.notify_all();
+			}
+
+			if (pollFileDescriptors[0].revents == 0)
+				continue;
+
+			const auto fileDescriptor = accept(listeningFileDescriptor, nullptr, nullptr);
+
+			if (fileDescriptor < 0)
+			{
+				if (errno == EINTR || errno == ECONNABORTED)
+					continue;
+
+				throw systemError("could not accept connection");
+			}
+
+			idleConnections.emplace_back(std::make_unique<Connection>(fileDescriptor));
+		}
+	}
+	catch (const std::exception &e)
+	{
+		logger.log(colorlog::Priority::Error, e.what());
+		exitCode = EXIT_FAILURE;
+		isShuttingDown = true;
+	}
+
+	connectionPending.notify_all();
+
+	for (auto &worker : workers)
+		worker.join();
+
+	// Closes the remaining connections
+	idleConnections.clear();
+	pendingConnections.clear();
+	returnedConnections.clear();
+
+	close(wakeUpPipe[0]);
+	close(wakeUpPipe[1]);
+	close(listeningFileDescriptor);
+	unlink(serverOptions.socketPath.c_str());
+
+	logger.log(colorlog::Priority::Info, "shutting down (domain cache: "
+		+ std::to_string(domainCache.numberOfHits()) + " hit(s), "
+		+ std::to_string(domainCache.numberOfMisses()) + " miss(es))");
+
+	return exitCode;
+}
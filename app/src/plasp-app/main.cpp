@@ -41,6 +41,21 @@ int main(int argc, char **argv)
 			case CommandType::Translate:
 				return CommandTranslate().run(argc - 1, &argv[1]);
 
+			case CommandType::Ground:
+				return CommandGround().run(argc - 1, &argv[1]);
+
+			case CommandType::Convert:
+				return CommandConvert().run(argc - 1, &argv[1]);
+
+			case CommandType::DecodeSymbols:
+				return CommandDecodeSymbols().run(argc - 1, &argv[1]);
+
+			case CommandType::Compress:
+				return CommandCompress().run(argc - 1, &argv[1]);
+
+			case CommandType::Serve:
+				return CommandServe().run(argc - 1, &argv[1]);
+
 			case CommandType::Normalize:
 				return CommandNormalize().run(argc - 1, &argv[1]);
 
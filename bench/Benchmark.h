@@ -0,0 +1,181 @@
+#ifndef __PLASP__BENCH__BENCHMARK_H
+#define __PLASP__BENCH__BENCHMARK_H
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <regex>
+#include <stdexcept>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Benchmark
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Discards all output, so that translations are measured without the cost of writing to a file
+class NullStreamBuffer : public std::streambuf
+{
+	protected:
+		int_type overflow(int_type character) override
+		{
+			return traits_type::not_eof(character);
+		}
+
+		std::streamsize xsputn(const char *, std::streamsize size) override
+		{
+			return size;
+		}
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct Measurement
+{
+	std::string name;
+	// Size of the input in bytes
+	size_t inputSize;
+	// Run times in seconds
+	std::vector<double> times;
+
+	double median() const
+	{
+		return percentile(0.5);
+	}
+
+	double percentile95() const
+	{
+		return percentile(0.95);
+	}
+
+	// Processed input in MB/s, based on the median run time
+	double throughput() const
+	{
+		return static_cast<double>(inputSize) / (1000 * 1000) / median();
+	}
+
+	// Nearest-rank percentile
+	double percentile(double fraction) const
+	{
+		auto sortedTimes = times;
+		std::sort(sortedTimes.begin(), sortedTimes.end());
+
+		const auto rank = static_cast<size_t>(std::ceil(fraction * sortedTimes.size()));
+
+		return sortedTimes[std::max(rank, static_cast<size_t>(1)) - 1];
+	}
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Runs the benchmark the given number of times. The setup is repeated before each run and is not
+// measured, so that benchmarks consuming their input (such as normalization) start from fresh input
+template<class Setup, class Run>
+Measurement measure(const std::string &name, size_t inputSize, size_t repetitions, Setup &&setup, Run &&run)
+{
+	Measurement measurement{name, inputSize, {}};
+	measurement.times.reserve(repetitions);
+
+	for (size_t i = 0; i < repetitions; i++)
+	{
+		auto input = setup();
+
+		const auto startTime = std::chrono::steady_clock::now();
+		run(input);
+		const auto endTime = std::chrono::steady_clock::now();
+
+		measurement.times.emplace_back(std::chrono::duration<double>(endTime - startTime).count());
+	}
+
+	return measurement;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline void printMeasurementHeader(std::ostream &stream)
+{
+	stream
+		<< std::left << std::setw(64) << "benchmark" << std::right
+		<< std::setw(12) << "size (KB)"
+		<< std::setw(14) << "median (ms)"
+		<< std::setw(14) << "p95 (ms)"
+		<< std::setw(14) << "MB/s"
+		<< std::setw(14) << "baseline" << std::endl;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline void printMeasurement(std::ostream &stream, const Measurement &measurement)
+{
+	stream
+		<< std::left << std::setw(64) << measurement.name << std::right << std::fixed
+		<< std::setw(12) << std::setprecision(1) << static_cast<double>(measurement.inputSize) / 1000
+		<< std::setw(14) << std::setprecision(3) << measurement.median() * 1000
+		<< std::setw(14) << std::setprecision(3) << measurement.percentile95() * 1000
+		<< std::setw(14) << std::setprecision(1) << measurement.throughput();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Measurements are written one per line, so that baselines can be read back without a JSON parser
+inline void writeMeasurements(const std::string &path, const std::vector<Measurement> &measurements)
+{
+	std::ofstream stream(path, std::ios::out);
+
+	if (!stream)
+		throw std::runtime_error("could not write benchmark results to “" + path + "”");
+
+	stream << std::setprecision(9) << "{" << std::endl << "  \"benchmarks\": [";
+
+	for (auto i = measurements.cbegin(); i != measurements.cend(); i++)
+	{
+		if (i != measurements.cbegin())
+			stream << ",";
+
+		stream
+			<< std::endl << "    {\"name\": \"" << i->name << "\""
+			<< ", \"size\": " << i->inputSize
+			<< ", \"median\": " << i->median()
+			<< ", \"p95\": " << i->percentile95()
+			<< ", \"throughput\": " << i->throughput() << "}";
+	}
+
+	stream << std::endl << "  ]" << std::endl << "}" << std::endl;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Reads the median run times of a baseline written by writeMeasurements
+inline std::map<std::string, double> readBaseline(const std::string &path)
+{
+	std::ifstream stream(path, std::ios::in);
+
+	if (!stream)
+		throw std::runtime_error("could not read baseline “" + path + "”");
+
+	static const std::regex measurementPattern("\\{\"name\": \"([^\"]*)\".*\"median\": ([-+.0-9eE]+)");
+
+	std::map<std::string, double> medians;
+	std::string line;
+
+	while (std::getline(stream, line))
+	{
+		std::smatch match;
+
+		if (std::regex_search(line, match, measurementPattern))
+			medians[match[1]] = std::stod(match[2]);
+	}
+
+	return medians;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif
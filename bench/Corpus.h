@@ -0,0 +1,141 @@
+#ifndef __PLASP__BENCH__CORPUS_H
+#define __PLASP__BENCH__CORPUS_H
+
+#include <algorithm>
+#include <experimental/filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <plasp/Language.h>
+
+#include "Generator.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Corpus
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct Input
+{
+	std::string name;
+	plasp::Language::Type language;
+	// PDDL inputs consist of a domain and a problem file, SAS inputs of a single file
+	std::vector<std::string> files;
+
+	size_t size() const
+	{
+		size_t size = 0;
+
+		for (const auto &file : files)
+			size += file.size();
+
+		return size;
+	}
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline std::string readFile(const std::experimental::filesystem::path &path)
+{
+	std::ifstream stream(path.string(), std::ios::in);
+
+	if (!stream)
+		throw std::runtime_error("could not read “" + path.string() + "”");
+
+	std::stringstream content;
+	content << stream.rdbuf();
+
+	return content.str();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline std::vector<std::experimental::filesystem::path> sortedDirectoryEntries(
+	const std::experimental::filesystem::path &directory)
+{
+	std::vector<std::experimental::filesystem::path> entries;
+
+	for (const auto &entry : std::experimental::filesystem::directory_iterator(directory))
+		entries.emplace_back(entry.path());
+
+	std::sort(entries.begin(), entries.end());
+
+	return entries;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// The PDDL instances and SAS test files bundled with plasp, followed by synthetic inputs (see
+// Generator.h) whose size is multiplied by the scale factor
+inline std::vector<Input> loadCorpus(const std::experimental::filesystem::path &directory, size_t scale)
+{
+	std::vector<Input> inputs;
+
+	for (const auto &domainDirectory : sortedDirectoryEntries(directory / "instances" / "PDDL"))
+	{
+		const auto domain = readFile(domainDirectory / "domain.pddl");
+
+		for (const auto &problemFile : sortedDirectoryEntries(domainDirectory))
+		{
+			if (problemFile.filename().string().compare(0, 8, "problem-") != 0)
+				continue;
+
+			const auto name = domainDirectory.filename().string() + "/" + problemFile.stem().string();
+			inputs.push_back({name, plasp::Language::Type::PDDL, {domain, readFile(problemFile)}});
+		}
+	}
+
+	for (const auto &file : sortedDirectoryEntries(directory / "tests" / "data"))
+		if (file.extension() == ".sas")
+			inputs.push_back({file.filename().string(), plasp::Language::Type::SAS, {readFile(file)}});
+
+	const auto generatePDDL =
+		[&](const std::string &name, const PDDLParameters &parameters)
+		{
+			const PDDLGenerator generator(parameters);
+			std::stringstream domain, problem;
+			generator.writeDomain(domain);
+			generator.writeProblem(problem);
+
+			inputs.push_back({"synthetic/" + name, plasp::Language::Type::PDDL, {domain.str(), problem.str()}});
+		};
+
+	for (const auto numberOfInitialFacts : {10000 * scale, 100000 * scale})
+	{
+		PDDLParameters parameters;
+		parameters.numberOfObjects = 1000;
+		parameters.numberOfInitialFacts = numberOfInitialFacts;
+
+		generatePDDL("pddl-facts-" + std::to_string(numberOfInitialFacts), parameters);
+	}
+
+	for (const auto numberOfObjects : {1000 * scale, 10000 * scale})
+	{
+		PDDLParameters parameters;
+		parameters.numberOfObjects = numberOfObjects;
+
+		generatePDDL("pddl-objects-" + std::to_string(numberOfObjects), parameters);
+	}
+
+	for (const auto numberOfOperators : {10000 * scale, 100000 * scale})
+	{
+		SASParameters parameters;
+		parameters.numberOfVariables = 1000;
+		parameters.numberOfOperators = numberOfOperators;
+
+		std::stringstream description;
+		SASGenerator(parameters).write(description);
+
+		inputs.push_back({"synthetic/sas-operators-" + std::to_string(numberOfOperators), plasp::Language::Type::SAS,
+			{description.str()}});
+	}
+
+	return inputs;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif
@@ -0,0 +1,359 @@
+#ifndef __PLASP__BENCH__GENERATOR_H
+#define __PLASP__BENCH__GENERATOR_H
+
+#include <algorithm>
+#include <cstdint>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Generator
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Synthetic PDDL and SAS inputs for measuring how parsing and translation scale. The inputs are
+// valid but not meant to be solvable. They are written to the stream directly, so that inputs with
+// tens of millions of facts are never held in memory, and they only depend on the parameters and
+// the seed
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Deterministic pseudorandom numbers (64-bit linear congruential generator), independent of the
+// standard library implementation
+class Random
+{
+	public:
+		explicit Random(uint64_t seed)
+		:	m_state{seed}
+		{
+		}
+
+		// Uniformly distributed in [0, bound) for bounds much smaller than 2^32
+		uint64_t get(uint64_t bound)
+		{
+			m_state = m_state * 6364136223846793005u + 1442695040888963407u;
+			return (m_state >> 32) % bound;
+		}
+
+	private:
+		uint64_t m_state;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct PDDLParameters
+{
+	size_t numberOfObjects = 100;
+	size_t numberOfPredicates = 10;
+	size_t predicateArity = 2;
+	size_t numberOfActions = 10;
+	// Levels of the type hierarchy below the root type (a complete binary tree)
+	size_t typeHierarchyDepth = 2;
+	// Nesting depth of the alternating conjunctions and disjunctions in action preconditions
+	size_t preconditionDepth = 1;
+	size_t numberOfInitialFacts = 1000;
+	size_t numberOfGoalFacts = 10;
+	uint64_t seed = 0;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class PDDLGenerator
+{
+	public:
+		explicit PDDLGenerator(const PDDLParameters &parameters)
+		:	m_parameters(parameters)
+		{
+			if (m_parameters.numberOfObjects == 0 || m_parameters.numberOfPredicates == 0)
+				throw std::invalid_argument("at least one object and one predicate required");
+
+			if (m_parameters.predicateArity > 8)
+				throw std::invalid_argument("predicate arity must not exceed 8");
+
+			if (m_parameters.typeHierarchyDepth > 16)
+				throw std::invalid_argument("type hierarchy depth must not exceed 16");
+
+			if (m_parameters.numberOfInitialFacts + m_parameters.numberOfGoalFacts > numberOfDistinctFacts())
+				throw std::invalid_argument("too many facts for the number of objects, predicates, and arity");
+		}
+
+		// Types form a complete binary tree below the root type “t”, and objects are distributed over
+		// the leaves. Predicates take arguments of the root type, while actions declare parameters
+		// of varying levels of the hierarchy
+		void writeDomain(std::ostream &stream) const
+		{
+			Random random(m_parameters.seed);
+
+			stream << "(define (domain synthetic)\n";
+			stream << "  (:requirements :strips :typing";
+
+			if (m_parameters.preconditionDepth > 1)
+				stream << " :disjunctive-preconditions";
+
+			stream << ")\n";
+			stream << "  (:types t - object";
+
+			for (size_t level = 1; level <= m_parameters.typeHierarchyDepth; level++)
+				for (size_t i = 0; i < (size_t{1} << level); i++)
+					stream << " " << typeName(level, i) << " - " << typeName(level - 1, i / 2);
+
+			stream << ")\n";
+			stream << "  (:predicates";
+
+			for (size_t i = 0; i < m_parameters.numberOfPredicates; i++)
+			{
+				stream << "\n    (p" << i;
+
+				for (size_t j = 0; j < m_parameters.predicateArity; j++)
+					stream << " ?x" << j << " - t";
+
+				stream << ")";
+			}
+
+			stream << ")";
+
+			for (size_t i = 0; i < m_parameters.numberOfActions; i++)
+			{
+				stream << "\n  (:action a" << i << "\n    :parameters (";
+
+				for (size_t j = 0; j < m_parameters.predicateArity; j++)
+				{
+					const auto level = random.get(m_parameters.typeHierarchyDepth + 1);
+
+					stream << (j > 0 ? " " : "") << "?x" << j << " - "
+						<< typeName(level, random.get(size_t{1} << level));
+				}
+
+				stream << ")\n    :precondition ";
+				writePrecondition(stream, random, m_parameters.preconditionDepth);
+				stream << "\n    :effect (and ";
+				writeAtom(stream, random.get(m_parameters.numberOfPredicates));
+				stream << " (not ";
+				writeAtom(stream, random.get(m_parameters.numberOfPredicates));
+				stream << ")))";
+			}
+
+			stream << ")\n";
+		}
+
+		// Initial state and goal facts are distinct, enumerating the argument combinations of each
+		// predicate in turn
+		void writeProblem(std::ostream &stream) const
+		{
+			stream << "(define (problem synthetic-problem)\n";
+			stream << "  (:domain synthetic)\n";
+			stream << "  (:objects";
+
+			const auto numberOfLeaves = size_t{1} << m_parameters.typeHierarchyDepth;
+
+			for (size_t i = 0; i < m_parameters.numberOfObjects; i++)
+				stream << (i % 16 == 0 ? "\n    " : " ") << "o" << i << " - "
+					<< typeName(m_parameters.typeHierarchyDepth, i % numberOfLeaves);
+
+			stream << ")\n";
+			stream << "  (:init";
+
+			for (size_t i = 0; i < m_parameters.numberOfInitialFacts; i++)
+			{
+				stream << "\n    ";
+				writeFact(stream, i);
+			}
+
+			stream << ")\n";
+			stream << "  (:goal (and";
+
+			for (size_t i = 0; i < m_parameters.numberOfGoalFacts; i++)
+			{
+				stream << "\n    ";
+				writeFact(stream, m_parameters.numberOfInitialFacts + i);
+			}
+
+			stream << ")))\n";
+		}
+
+	private:
+		static std::string typeName(size_t level, size_t index)
+		{
+			if (level == 0)
+				return "t";
+
+			return "t" + std::to_string(level) + "-" + std::to_string(index);
+		}
+
+		size_t numberOfDistinctFacts() const
+		{
+			size_t numberOfFacts = m_parameters.numberOfPredicates;
+
+			for (size_t i = 0; i < m_parameters.predicateArity; i++)
+			{
+				if (numberOfFacts > SIZE_MAX / m_parameters.numberOfObjects)
+					return SIZE_MAX;
+
+				numberOfFacts *= m_parameters.numberOfObjects;
+			}
+
+			return numberOfFacts;
+		}
+
+		void writeAtom(std::ostream &stream, size_t predicateID) const
+		{
+			stream << "(p" << predicateID;
+
+			for (size_t j = 0; j < m_parameters.predicateArity; j++)
+				stream << " ?x" << j;
+
+			stream << ")";
+		}
+
+		void writeFact(std::ostream &stream, size_t factID) const
+		{
+			stream << "(p" << factID % m_parameters.numberOfPredicates;
+
+			auto arguments = factID / m_parameters.numberOfPredicates;
+
+			for (size_t j = 0; j < m_parameters.predicateArity; j++)
+			{
+				stream << " o" << arguments % m_parameters.numberOfObjects;
+				arguments /= m_parameters.numberOfObjects;
+			}
+
+			stream << ")";
+		}
+
+		// Nests conjunctions and disjunctions, each combining an atom with the next level
+		void writePrecondition(std::ostream &stream, Random &random, size_t depth) const
+		{
+			if (depth <= 1)
+			{
+				writeAtom(stream, random.get(m_parameters.numberOfPredicates));
+				return;
+			}
+
+			stream << (depth % 2 == 0 ? "(and " : "(or ");
+			writeAtom(stream, random.get(m_parameters.numberOfPredicates));
+			stream << " ";
+			writePrecondition(stream, random, depth - 1);
+			stream << ")";
+		}
+
+		PDDLParameters m_parameters;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct SASParameters
+{
+	size_t numberOfVariables = 100;
+	size_t numberOfValues = 2;
+	size_t numberOfOperators = 1000;
+	// Prevail conditions and effects per operator, on distinct variables
+	size_t numberOfPreconditions = 1;
+	size_t numberOfEffects = 2;
+	size_t numberOfMutexGroups = 0;
+	uint64_t seed = 0;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class SASGenerator
+{
+	public:
+		explicit SASGenerator(const SASParameters &parameters)
+		:	m_parameters(parameters)
+		{
+			if (m_parameters.numberOfValues < 2)
+				throw std::invalid_argument("variables need at least two values");
+
+			if (m_parameters.numberOfVariables < m_parameters.numberOfPreconditions + m_parameters.numberOfEffects
+				|| m_parameters.numberOfVariables == 0)
+				throw std::invalid_argument("too few variables for the numbers of preconditions and effects");
+		}
+
+		void write(std::ostream &stream) const
+		{
+			Random random(m_parameters.seed);
+
+			stream << "begin_version\n3\nend_version\nbegin_metric\n0\nend_metric\n";
+			stream << m_parameters.numberOfVariables << "\n";
+
+			for (size_t i = 0; i < m_parameters.numberOfVariables; i++)
+			{
+				stream << "begin_variable\nvar" << i << "\n-1\n" << m_parameters.numberOfValues << "\n";
+
+				for (size_t j = 0; j < m_parameters.numberOfValues; j++)
+					stream << "Atom p" << i << "(v" << j << ")\n";
+
+				stream << "end_variable\n";
+			}
+
+			stream << m_parameters.numberOfMutexGroups << "\n";
+
+			// Mutex groups relate the second value of a few consecutive variables, which the initial state
+			// does not violate
+			for (size_t i = 0; i < m_parameters.numberOfMutexGroups; i++)
+			{
+				const auto firstVariable = random.get(m_parameters.numberOfVariables);
+				const auto numberOfFacts = std::min(m_parameters.numberOfVariables, size_t{3});
+
+				stream << "begin_mutex_group\n" << numberOfFacts << "\n";
+
+				for (size_t j = 0; j < numberOfFacts; j++)
+					stream << (firstVariable + j) % m_parameters.numberOfVariables << " 1\n";
+
+				stream << "end_mutex_group\n";
+			}
+
+			stream << "begin_state\n";
+
+			for (size_t i = 0; i < m_parameters.numberOfVariables; i++)
+				stream << "0\n";
+
+			stream << "end_state\nbegin_goal\n1\n0 1\nend_goal\n";
+			stream << m_parameters.numberOfOperators << "\n";
+
+			const auto numberOfConditions = m_parameters.numberOfPreconditions + m_parameters.numberOfEffects;
+
+			for (size_t i = 0; i < m_parameters.numberOfOperators; i++)
+			{
+				// Conditions and effects refer to consecutive variables, which are thus distinct
+				const auto firstVariable = random.get(m_parameters.numberOfVariables);
+				const auto variable =
+					[&](size_t j)
+					{
+						return (firstVariable + j) % m_parameters.numberOfVariables;
+					};
+
+				stream << "begin_operator\nop" << i << " o" << i % 100 << "\n";
+				stream << m_parameters.numberOfPreconditions << "\n";
+
+				for (size_t j = 0; j < m_parameters.numberOfPreconditions; j++)
+					stream << variable(j) << " " << random.get(m_parameters.numberOfValues) << "\n";
+
+				stream << m_parameters.numberOfEffects << "\n";
+
+				for (size_t j = m_parameters.numberOfPreconditions; j < numberOfConditions; j++)
+				{
+					const auto valueBefore = random.get(m_parameters.numberOfValues + 1);
+					const auto valueAfter = random.get(m_parameters.numberOfValues);
+
+					// A value of -1 means that the effect applies regardless of the value before
+					stream << "0 " << variable(j) << " "
+						<< (valueBefore == m_parameters.numberOfValues ? std::string("-1") : std::to_string(valueBefore))
+						<< " " << valueAfter << "\n";
+				}
+
+				stream << "1\nend_operator\n";
+			}
+
+			stream << "0\n";
+		}
+
+	private:
+		SASParameters m_parameters;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif
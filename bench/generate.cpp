@@ -0,0 +1,120 @@
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include <cxxopts.hpp>
+
+#include "Generator.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Generate
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Writes to the file or to the standard output if no file is given
+template<class Write>
+void writeTo(const std::string &path, Write &&write)
+{
+	if (path.empty())
+	{
+		write(std::cout);
+		return;
+	}
+
+	std::ofstream stream(path, std::ios::out);
+
+	if (!stream)
+		throw std::runtime_error("could not write to “" + path + "”");
+
+	write(stream);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char **argv)
+{
+	cxxopts::Options options("plasp-generate", "Generate synthetic PDDL and SAS inputs of configurable size.");
+	options.positional_help("(pddl|sas) [<option>...]");
+	options.add_options()
+		("h,help", "Display this help message")
+		("language", "Input language to generate (pddl, sas)", cxxopts::value<std::string>())
+		("seed", "Seed of the pseudorandom choices", cxxopts::value<uint64_t>()->default_value("0"));
+	options.add_options("pddl")
+		("domain", "Domain output file (default: standard output, followed by the problem)", cxxopts::value<std::string>()->default_value(""))
+		("problem", "Problem output file (default: standard output, following the domain)", cxxopts::value<std::string>()->default_value(""))
+		("objects", "Number of objects", cxxopts::value<size_t>()->default_value("100"))
+		("predicates", "Number of predicates", cxxopts::value<size_t>()->default_value("10"))
+		("arity", "Arity of the predicates (and number of action parameters)", cxxopts::value<size_t>()->default_value("2"))
+		("actions", "Number of actions", cxxopts::value<size_t>()->default_value("10"))
+		("type-depth", "Depth of the type hierarchy (a complete binary tree)", cxxopts::value<size_t>()->default_value("2"))
+		("precondition-depth", "Nesting depth of conjunctions and disjunctions in preconditions", cxxopts::value<size_t>()->default_value("1"))
+		("initial-facts", "Number of initial state facts", cxxopts::value<size_t>()->default_value("1000"))
+		("goal-facts", "Number of goal facts", cxxopts::value<size_t>()->default_value("10"));
+	options.add_options("sas")
+		("o,output", "Output file (default: standard output)", cxxopts::value<std::string>()->default_value(""))
+		("variables", "Number of variables", cxxopts::value<size_t>()->default_value("100"))
+		("values", "Number of values per variable", cxxopts::value<size_t>()->default_value("2"))
+		("operators", "Number of operators", cxxopts::value<size_t>()->default_value("1000"))
+		("preconditions", "Number of prevail conditions per operator", cxxopts::value<size_t>()->default_value("1"))
+		("effects", "Number of effects per operator", cxxopts::value<size_t>()->default_value("2"))
+		("mutex-groups", "Number of mutex groups", cxxopts::value<size_t>()->default_value("0"));
+	options.parse_positional("language");
+
+	try
+	{
+		const auto parseResult = options.parse(argc, argv);
+
+		if (parseResult.count("help") || !parseResult.count("language"))
+		{
+			std::cout << options.help({"", "pddl", "sas"}) << std::endl;
+			return parseResult.count("help") ? EXIT_SUCCESS : EXIT_FAILURE;
+		}
+
+		const auto language = parseResult["language"].as<std::string>();
+
+		if (language == "pddl")
+		{
+			PDDLParameters parameters;
+			parameters.numberOfObjects = parseResult["objects"].as<size_t>();
+			parameters.numberOfPredicates = parseResult["predicates"].as<size_t>();
+			parameters.predicateArity = parseResult["arity"].as<size_t>();
+			parameters.numberOfActions = parseResult["actions"].as<size_t>();
+			parameters.typeHierarchyDepth = parseResult["type-depth"].as<size_t>();
+			parameters.preconditionDepth = parseResult["precondition-depth"].as<size_t>();
+			parameters.numberOfInitialFacts = parseResult["initial-facts"].as<size_t>();
+			parameters.numberOfGoalFacts = parseResult["goal-facts"].as<size_t>();
+			parameters.seed = parseResult["seed"].as<uint64_t>();
+
+			const PDDLGenerator generator(parameters);
+
+			writeTo(parseResult["domain"].as<std::string>(), [&](auto &stream){generator.writeDomain(stream);});
+			writeTo(parseResult["problem"].as<std::string>(), [&](auto &stream){generator.writeProblem(stream);});
+		}
+		else if (language == "sas")
+		{
+			SASParameters parameters;
+			parameters.numberOfVariables = parseResult["variables"].as<size_t>();
+			parameters.numberOfValues = parseResult["values"].as<size_t>();
+			parameters.numberOfOperators = parseResult["operators"].as<size_t>();
+			parameters.numberOfPreconditions = parseResult["preconditions"].as<size_t>();
+			parameters.numberOfEffects = parseResult["effects"].as<size_t>();
+			parameters.numberOfMutexGroups = parseResult["mutex-groups"].as<size_t>();
+			parameters.seed = parseResult["seed"].as<uint64_t>();
+
+			const SASGenerator generator(parameters);
+
+			writeTo(parseResult["output"].as<std::string>(), [&](auto &stream){generator.write(stream);});
+		}
+		else
+			throw std::invalid_argument("unknown language “" + language + "”");
+	}
+	catch (const std::exception &exception)
+	{
+		std::cerr << "error: " << exception.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,269 @@
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <cxxopts.hpp>
+
+#include <colorlog/ColorStream.h>
+
+#include <pddl/AST.h>
+#include <pddl/Normalize.h>
+#include <pddl/NormalizedAST.h>
+#include <pddl/Parse.h>
+#include <pddl/Tokenizer.h>
+
+#include <plasp/pddl/TranslatorASP.h>
+#include <plasp/sas/Description.h>
+#include <plasp/sas/TranslatorASP.h>
+
+#include "Benchmark.h"
+#include "Corpus.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Main
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<class Tokenizer>
+Tokenizer makeTokenizer(const Input &input)
+{
+	Tokenizer tokenizer;
+
+	for (const auto &file : input.files)
+	{
+		std::istringstream stream(file);
+		tokenizer.read(input.name, stream);
+	}
+
+	return tokenizer;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+pddl::Context makeContext(const Input &input)
+{
+	const auto ignoreWarning = [](const auto &, const auto &){};
+
+	// Some of the bundled IPC instances rely on legacy features
+	return pddl::Context(makeTokenizer<pddl::Tokenizer>(input), ignoreWarning, pddl::Mode::Compatibility);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Translates into a stream that discards the output, buffered like the output of plasp translate
+template<class Translator, class Description>
+void translate(const Description &description)
+{
+	NullStreamBuffer nullStreamBuffer;
+	std::ostream nullStream(&nullStreamBuffer);
+
+	{
+		colorlog::ColorStream outputStream(nullStream);
+		outputStream.setColorPolicy(colorlog::ColorStream::ColorPolicy::Never);
+		outputStream.enableOutputBuffer();
+
+		Translator(description, outputStream).translate();
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::vector<Measurement> benchmarkPDDL(const Input &input, size_t repetitions, const std::string &filter)
+{
+	std::vector<Measurement> measurements;
+
+	const auto runBenchmark =
+		[&](const std::string &benchmark, auto &&setup, auto &&run)
+		{
+			const auto name = benchmark + "/" + input.name;
+
+			if (name.find(filter) != std::string::npos)
+				measurements.emplace_back(measure(name, input.size(), repetitions, setup, run));
+		};
+
+	runBenchmark("tokenization",
+		[](){return 0;},
+		[&](auto &)
+		{
+			auto tokenizer = makeTokenizer<pddl::Tokenizer>(input);
+			tokenizer.removeComments(";", "\n", false);
+
+			for (tokenizer.skipWhiteSpace(); !tokenizer.atEnd(); tokenizer.skipWhiteSpace())
+			{
+				if (pddl::PDDLTokenizerPolicy::isIdentifierCharacter(tokenizer.currentCharacter()))
+					tokenizer.getIdentifier();
+				else
+					tokenizer.advance();
+			}
+		});
+
+	runBenchmark("pddl-parsing",
+		[&](){return std::make_unique<pddl::Context>(makeContext(input));},
+		[](auto &context)
+		{
+			pddl::parseDescription(*context);
+		});
+
+	runBenchmark("normalization",
+		[&]()
+		{
+			auto context = makeContext(input);
+			return pddl::parseDescription(context);
+		},
+		[](auto &description)
+		{
+			pddl::normalize(std::move(description));
+		});
+
+	auto context = makeContext(input);
+	const auto description = pddl::normalize(pddl::parseDescription(context));
+
+	runBenchmark("pddl-translation",
+		[](){return 0;},
+		[&](auto &)
+		{
+			translate<plasp::pddl::TranslatorASP>(description);
+		});
+
+	return measurements;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::vector<Measurement> benchmarkSAS(const Input &input, size_t repetitions, const std::string &filter)
+{
+	std::vector<Measurement> measurements;
+
+	const auto runBenchmark =
+		[&](const std::string &benchmark, auto &&setup, auto &&run)
+		{
+			const auto name = benchmark + "/" + input.name;
+
+			if (name.find(filter) != std::string::npos)
+				measurements.emplace_back(measure(name, input.size(), repetitions, setup, run));
+		};
+
+	runBenchmark("tokenization",
+		[](){return 0;},
+		[&](auto &)
+		{
+			auto tokenizer = makeTokenizer<tokenize::Tokenizer<>>(input);
+
+			for (tokenizer.skipWhiteSpace(); !tokenizer.atEnd(); tokenizer.skipWhiteSpace())
+				tokenizer.get<std::string>();
+		});
+
+	runBenchmark("sas-parsing",
+		[&](){return makeTokenizer<tokenize::Tokenizer<>>(input);},
+		[](auto &tokenizer)
+		{
+			plasp::sas::Description::fromTokenizer(std::move(tokenizer));
+		});
+
+	auto tokenizer = makeTokenizer<tokenize::Tokenizer<>>(input);
+	const auto description = plasp::sas::Description::fromTokenizer(std::move(tokenizer));
+
+	runBenchmark("sas-translation",
+		[](){return 0;},
+		[&](auto &)
+		{
+			translate<plasp::sas::TranslatorASP>(description);
+		});
+
+	return measurements;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char **argv)
+{
+	cxxopts::Options options("plasp-bench", "Measure the performance of plasp’s parsers and translators.");
+	options.add_options()
+		("h,help", "Display this help message")
+		("d,directory", "Root directory of the plasp repository (containing the benchmark instances)", cxxopts::value<std::string>()->default_value("."))
+		("r,repetitions", "Number of runs per benchmark", cxxopts::value<size_t>()->default_value("10"))
+		("s,scale", "Size factor of the synthetic inputs", cxxopts::value<size_t>()->default_value("1"))
+		("f,filter", "Only run benchmarks whose names contain this string", cxxopts::value<std::string>()->default_value(""))
+		("o,output", "Write the results to this file (JSON format)", cxxopts::value<std::string>())
+		("b,baseline", "Compare the results against a file written with --output", cxxopts::value<std::string>())
+		("t,tolerance", "Report regressions if the median run time exceeds the baseline by more than this percentage", cxxopts::value<double>()->default_value("20"));
+
+	try
+	{
+		const auto parseResult = options.parse(argc, argv);
+
+		if (parseResult.count("help"))
+		{
+			std::cout << options.help() << std::endl;
+			return EXIT_SUCCESS;
+		}
+
+		const auto repetitions = std::max(parseResult["repetitions"].as<size_t>(), static_cast<size_t>(1));
+		const auto filter = parseResult["filter"].as<std::string>();
+		const auto tolerance = parseResult["tolerance"].as<double>() / 100;
+
+		std::map<std::string, double> baseline;
+
+		if (parseResult.count("baseline"))
+			baseline = readBaseline(parseResult["baseline"].as<std::string>());
+
+		const auto inputs = loadCorpus(parseResult["directory"].as<std::string>(), parseResult["scale"].as<size_t>());
+
+		std::vector<Measurement> measurements;
+		size_t numberOfRegressions = 0;
+
+		printMeasurementHeader(std::cout);
+
+		for (const auto &input : inputs)
+		{
+			auto inputMeasurements = (input.language == plasp::Language::Type::PDDL)
+				? benchmarkPDDL(input, repetitions, filter)
+				: benchmarkSAS(input, repetitions, filter);
+
+			for (auto &measurement : inputMeasurements)
+			{
+				printMeasurement(std::cout, measurement);
+
+				const auto baselineMedian = baseline.find(measurement.name);
+
+				if (baselineMedian != baseline.end())
+				{
+					const auto change = measurement.median() / baselineMedian->second - 1;
+					const auto isRegression = change > tolerance;
+
+					std::cout << std::setw(13) << std::showpos << std::setprecision(1) << change * 100 << "%"
+						<< std::noshowpos << (isRegression ? "  regression" : "");
+
+					if (isRegression)
+						numberOfRegressions++;
+				}
+
+				std::cout << std::endl;
+
+				measurements.emplace_back(std::move(measurement));
+			}
+		}
+
+		if (parseResult.count("output"))
+			writeMeasurements(parseResult["output"].as<std::string>(), measurements);
+
+		if (numberOfRegressions > 0)
+		{
+			std::cerr << numberOfRegressions << " benchmark(s) slower than the baseline by more than "
+				<< tolerance * 100 << "%" << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+	catch (const std::exception &exception)
+	{
+		std::cerr << "error: " << exception.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
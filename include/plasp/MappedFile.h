@@ -0,0 +1,91 @@
+#ifndef __PLASP__MAPPED_FILE_H
+#define __PLASP__MAPPED_FILE_H
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace plasp
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// MappedFile
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Read-only memory mapping of a complete file, which is unmapped on destruction
+class MappedFile
+{
+	public:
+		explicit MappedFile(const std::string &path)
+		:	m_data{nullptr},
+			m_size{0}
+		{
+			const auto fileDescriptor = open(path.c_str(), O_RDONLY);
+
+			if (fileDescriptor < 0)
+				throw std::runtime_error("could not open “" + path + "” (" + std::strerror(errno) + ")");
+
+			struct stat fileStatus;
+
+			if (fstat(fileDescriptor, &fileStatus) != 0)
+			{
+				close(fileDescriptor);
+				throw std::runtime_error("could not access “" + path + "” (" + std::strerror(errno) + ")");
+			}
+
+			m_size = static_cast<std::size_t>(fileStatus.st_size);
+
+			// Empty files cannot be mapped
+			if (m_size > 0)
+			{
+				auto *data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+
+				if (data == MAP_FAILED)
+				{
+					close(fileDescriptor);
+					throw std::runtime_error("could not map “" + path + "” into memory (" + std::strerror(errno) + ")");
+				}
+
+				m_data = static_cast<const char *>(data);
+			}
+
+			close(fileDescriptor);
+		}
+
+		~MappedFile()
+		{
+			if (m_data)
+				munmap(const_cast<char *>(m_data), m_size);
+		}
+
+		MappedFile(const MappedFile &other) = delete;
+		MappedFile &operator=(const MappedFile &other) = delete;
+
+		const char *data() const
+		{
+			return m_data;
+		}
+
+		std::size_t size() const
+		{
+			return m_size;
+		}
+
+	private:
+		const char *m_data;
+		std::size_t m_size;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+
+#endif
@@ -0,0 +1,197 @@
+#ifndef __PLASP__PARALLEL_TRANSLATION_H
+#define __PLASP__PARALLEL_TRANSLATION_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <colorlog/ColorStream.h>
+
+namespace plasp
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// ParallelTranslation
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Splitting the work into more chunks than threads balances the load if elements vary in size
+constexpr std::size_t ChunksPerThread = 8;
+constexpr std::size_t ChunkBufferCapacity = 64 * 1024;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline std::size_t resolveNumberOfThreads(std::size_t numberOfThreads)
+{
+	if (numberOfThreads != 0)
+		return numberOfThreads;
+
+	return std::max(static_cast<std::size_t>(std::thread::hardware_concurrency()), static_cast<std::size_t>(1));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Translates the elements 0, …, numberOfElements - 1 in contiguous chunks on numberOfThreads (> 1)
+// threads. translateChunk(begin, end) returns the output of the elements begin, …, end - 1, and
+// writeChunk(output) is called on the calling thread with the outputs of all chunks in order, each as
+// soon as it is complete
+template<class TranslateChunk, class WriteChunk>
+void translateChunksInParallel(std::size_t numberOfElements, std::size_t numberOfThreads,
+	TranslateChunk translateChunk, WriteChunk writeChunk)
+{
+	using Output = decltype(translateChunk(std::size_t(0), std::size_t(0)));
+
+	const auto numberOfChunks = std::min(numberOfElements, numberOfThreads * ChunksPerThread);
+
+	struct Chunk
+	{
+		Output output;
+		std::exception_ptr exception;
+		bool isDone = false;
+	};
+
+	std::vector<Chunk> chunks(numberOfChunks);
+	std::mutex mutex;
+	std::condition_variable chunkDone;
+	std::atomic<std::size_t> nextChunkID{0};
+
+	const auto translateChunks =
+		[&]()
+		{
+			while (true)
+			{
+				const auto chunkID = nextChunkID++;
+
+				if (chunkID >= numberOfChunks)
+					return;
+
+				auto &chunk = chunks[chunkID];
+
+				const auto begin = numberOfElements * chunkID / numberOfChunks;
+				const auto end = numberOfElements * (chunkID + 1) / numberOfChunks;
+
+				try
+				{
+					chunk.output = translateChunk(begin, end);
+				}
+				catch (...)
+				{
+					chunk.exception = std::current_exception();
+				}
+
+				{
+					std::lock_guard<std::mutex> lock(mutex);
+					chunk.isDone = true;
+				}
+
+				chunkDone.notify_all();
+			}
+		};
+
+	std::vector<std::thread> threads;
+	threads.reserve(numberOfThreads);
+
+	for (std::size_t i = 0; i < numberOfThreads; i++)
+		threads.emplace_back(translateChunks);
+
+	std::exception_ptr exception;
+
+	try
+	{
+		for (std::size_t chunkID = 0; chunkID < numberOfChunks; chunkID++)
+		{
+			auto &chunk = chunks[chunkID];
+
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				chunkDone.wait(lock, [&](){return chunk.isDone;});
+			}
+
+			// Report the error of the first failing element, just like a sequential translation
+			if (chunk.exception)
+			{
+				exception = chunk.exception;
+				break;
+			}
+
+			writeChunk(chunk.output);
+			chunk.output = Output();
+		}
+	}
+	catch (...)
+	{
+		exception = std::current_exception();
+	}
+
+	// Stop handing out chunks if the translation is aborted
+	if (exception)
+		nextChunkID = numberOfChunks;
+
+	for (auto &thread : threads)
+		thread.join();
+
+	if (exception)
+		std::rethrow_exception(exception);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Translates the elements 0, …, numberOfElements - 1 with translateElement(outputStream, index).
+// With multiple threads, contiguous chunks of elements are rendered into separate buffers, which
+// are written to the output stream in order as soon as they are complete. Hence, the output is
+// identical to that of a sequential translation
+template<class TranslateElement>
+void translateInParallel(colorlog::ColorStream &outputStream, std::size_t numberOfElements,
+	std::size_t numberOfThreads, TranslateElement translateElement)
+{
+	numberOfThreads = std::min(resolveNumberOfThreads(numberOfThreads), numberOfElements);
+
+	if (numberOfThreads <= 1)
+	{
+		for (std::size_t i = 0; i < numberOfElements; i++)
+			translateElement(outputStream, i);
+
+		return;
+	}
+
+	const auto colorPolicy = outputStream.supportsColor()
+		? colorlog::ColorStream::ColorPolicy::Always
+		: colorlog::ColorStream::ColorPolicy::Never;
+
+	translateChunksInParallel(numberOfElements, numberOfThreads,
+		[&](std::size_t begin, std::size_t end)
+		{
+			std::ostringstream chunkStream;
+
+			{
+				colorlog::ColorStream chunkColorStream(chunkStream);
+				chunkColorStream.setColorPolicy(colorPolicy);
+				chunkColorStream.setSymbolTable(outputStream.symbolTable());
+
+				if (colorPolicy == colorlog::ColorStream::ColorPolicy::Never)
+					chunkColorStream.enableOutputBuffer(ChunkBufferCapacity);
+
+				for (auto i = begin; i < end; i++)
+					translateElement(chunkColorStream, i);
+			}
+
+			return chunkStream.str();
+		},
+		[&](const std::string &output)
+		{
+			outputStream.write(output.data(), output.size());
+		});
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+
+#endif
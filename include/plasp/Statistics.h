@@ -0,0 +1,131 @@
+#ifndef __PLASP__STATISTICS_H
+#define __PLASP__STATISTICS_H
+
+#include <chrono>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace plasp
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Statistics
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Collects the time spent in the phases of a run (such as parsing and translating) along with
+// counters (such as the number of translated actions). Measuring is cheap enough to be always on
+class Statistics
+{
+	public:
+		using Clock = std::chrono::steady_clock;
+
+		// Measures the time from its construction to its destruction as a phase. Phases measured while
+		// another phase is running are reported as part of the running phase
+		class PhaseTimer
+		{
+			public:
+				explicit PhaseTimer(Statistics &statistics, const char *phase);
+				~PhaseTimer();
+
+				PhaseTimer(const PhaseTimer &other) = delete;
+				PhaseTimer &operator=(const PhaseTimer &other) = delete;
+
+			private:
+				Statistics &m_statistics;
+				size_t m_phaseID;
+				Clock::time_point m_startTime;
+		};
+
+		Statistics();
+
+		// Runs the function as a phase and returns its result
+		template<class Function>
+		auto measure(const char *phase, Function &&function)
+		{
+			PhaseTimer phaseTimer(*this, phase);
+			return function();
+		}
+
+		// Adds a phase measured elsewhere (for instance, by the PDDL parser) to the running phase
+		void addPhase(const char *phase, Clock::duration duration);
+		// Adds the value to the counter with the given name
+		void count(const char *counter, size_t value);
+
+		// Prints a human-readable summary
+		void print(std::ostream &stream) const;
+		void printJSON(std::ostream &stream) const;
+
+		// Peak resident set size of the process in bytes
+		static size_t peakResidentSetSize();
+
+	private:
+		struct Phase
+		{
+			std::string name;
+			size_t depth;
+			Clock::duration duration;
+		};
+
+		Clock::time_point m_startTime;
+
+		// Phases in the order they were started, nested phases following the phase they are part of
+		std::vector<Phase> m_phases;
+		size_t m_depth;
+
+		std::vector<std::pair<std::string, size_t>> m_counters;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Counts the bytes and facts written to a stream by intercepting its stream buffer, which is restored
+// on destruction. Facts are recognized as periods at the end of a line
+class OutputCounter : public std::streambuf
+{
+	public:
+		explicit OutputCounter(std::ostream &stream);
+		~OutputCounter();
+
+		OutputCounter(const OutputCounter &other) = delete;
+		OutputCounter &operator=(const OutputCounter &other) = delete;
+
+		size_t numberOfBytes() const
+		{
+			return m_numberOfBytes;
+		}
+
+		size_t numberOfFacts() const
+		{
+			return m_numberOfFacts;
+		}
+
+	protected:
+		int_type overflow(int_type character) override;
+		std::streamsize xsputn(const char *data, std::streamsize size) override;
+		int sync() override;
+
+	private:
+		void countOutput(const char *data, size_t size);
+
+		std::ostream &m_stream;
+		std::streambuf *m_streamBuffer;
+
+		size_t m_numberOfBytes;
+		size_t m_numberOfFacts;
+		char m_lastCharacter;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Writes the string as a quoted JSON string with escaped special characters
+void printJSONString(std::ostream &stream, const std::string &string);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+
+#endif
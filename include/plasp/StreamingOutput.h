@@ -0,0 +1,186 @@
+#ifndef __PLASP__STREAMING_OUTPUT_H
+#define __PLASP__STREAMING_OUTPUT_H
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include <colorlog/ColorStream.h>
+
+namespace plasp
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// StreamingOutput
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+constexpr std::size_t StreamingChunkCapacity = 64 * 1024;
+constexpr std::size_t StreamingQueueCapacity = 16;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Output is rendered into chunks on the translating thread, which are passed through a bounded
+// queue to a writer thread. Hence, writing the output overlaps with parsing and translating the
+// input, while at most a fixed number of chunks is held in memory
+class StreamingOutput
+{
+	public:
+		explicit StreamingOutput(colorlog::ColorStream &outputStream, std::size_t queueCapacity = StreamingQueueCapacity)
+		:	m_outputStream(outputStream),
+			m_chunkColorStream(m_chunkStream),
+			m_queueCapacity{std::max(queueCapacity, static_cast<std::size_t>(1))},
+			m_isFinished{false}
+		{
+			const auto colorPolicy = outputStream.supportsColor()
+				? colorlog::ColorStream::ColorPolicy::Always
+				: colorlog::ColorStream::ColorPolicy::Never;
+
+			m_chunkColorStream.setColorPolicy(colorPolicy);
+			m_chunkColorStream.setSymbolTable(outputStream.symbolTable());
+
+			if (colorPolicy == colorlog::ColorStream::ColorPolicy::Never)
+				m_chunkColorStream.enableOutputBuffer(StreamingChunkCapacity);
+
+			m_writerThread = std::thread([&](){write();});
+		}
+
+		~StreamingOutput()
+		{
+			if (!m_writerThread.joinable())
+				return;
+
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_isFinished = true;
+			}
+
+			m_queueChanged.notify_all();
+			m_writerThread.join();
+		}
+
+		StreamingOutput(const StreamingOutput &other) = delete;
+		StreamingOutput &operator=(const StreamingOutput &other) = delete;
+
+		// Stream into which the output is rendered
+		colorlog::ColorStream &stream()
+		{
+			return m_chunkColorStream;
+		}
+
+		// Hands the rendered output over to the writer thread once it fills a chunk, blocking while
+		// the queue is full
+		void commit()
+		{
+			if (static_cast<std::size_t>(m_chunkStream.tellp()) < StreamingChunkCapacity)
+				return;
+
+			flush();
+		}
+
+		// Hands all rendered output over to the writer thread
+		void flush()
+		{
+			m_chunkColorStream.flush();
+
+			auto chunk = m_chunkStream.str();
+			m_chunkStream.str(std::string());
+
+			if (chunk.empty())
+				return;
+
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_queueChanged.wait(lock, [&](){return m_queue.size() < m_queueCapacity || m_exception;});
+
+			// After a write error, the remaining output is discarded
+			if (m_exception)
+				return;
+
+			m_queue.emplace_back(std::move(chunk));
+			lock.unlock();
+
+			m_queueChanged.notify_all();
+		}
+
+		// Writes all remaining output and waits for the writer thread to complete
+		void finish()
+		{
+			flush();
+
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_isFinished = true;
+			}
+
+			m_queueChanged.notify_all();
+			m_writerThread.join();
+
+			if (m_exception)
+				std::rethrow_exception(m_exception);
+		}
+
+	private:
+		void write()
+		{
+			while (true)
+			{
+				std::string chunk;
+
+				{
+					std::unique_lock<std::mutex> lock(m_mutex);
+					m_queueChanged.wait(lock, [&](){return !m_queue.empty() || m_isFinished;});
+
+					if (m_queue.empty())
+						return;
+
+					chunk = std::move(m_queue.front());
+					m_queue.pop_front();
+				}
+
+				m_queueChanged.notify_all();
+
+				try
+				{
+					m_outputStream.write(chunk.data(), chunk.size());
+					m_outputStream.flush();
+				}
+				catch (...)
+				{
+					{
+						std::lock_guard<std::mutex> lock(m_mutex);
+						m_exception = std::current_exception();
+						m_queue.clear();
+					}
+
+					m_queueChanged.notify_all();
+					return;
+				}
+			}
+		}
+
+		colorlog::ColorStream &m_outputStream;
+
+		std::ostringstream m_chunkStream;
+		colorlog::ColorStream m_chunkColorStream;
+
+		std::deque<std::string> m_queue;
+		std::size_t m_queueCapacity;
+		bool m_isFinished;
+		std::exception_ptr m_exception;
+		std::mutex m_mutex;
+		std::condition_variable m_queueChanged;
+
+		std::thread m_writerThread;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+
+#endif
@@ -0,0 +1,57 @@
+#ifndef __PLASP__SYMBOLS_H
+#define __PLASP__SYMBOLS_H
+
+#include <experimental/filesystem>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include <colorlog/SymbolTable.h>
+
+#include <tokenize/Tokenizer.h>
+
+#include <plasp/Language.h>
+
+namespace plasp
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Symbols
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Writes the symbol table as ASP facts of the form symbol(ID, "name")
+void printSymbolTable(std::ostream &stream, const colorlog::SymbolTable &symbolTable, Language::Type language);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Maps the integer symbol IDs in answer sets of translations with symbol ID output back to names
+class SymbolDecoder
+{
+	public:
+		static SymbolDecoder fromTokenizer(tokenize::Tokenizer<> &&tokenizer);
+		static SymbolDecoder fromFile(const std::experimental::filesystem::path &path);
+
+	public:
+		Language::Type language() const;
+		const std::vector<std::string> &names() const;
+
+		// Copies the input to the output, replacing symbol IDs at argument positions that hold names
+		// in the translation output format (such as constant(ID)) with the corresponding names
+		void decode(std::istream &inputStream, std::ostream &outputStream) const;
+
+	private:
+		SymbolDecoder();
+
+		void parseContent(tokenize::Tokenizer<> &tokenizer);
+
+		Language::Type m_language;
+		std::vector<std::string> m_names;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+
+#endif
@@ -0,0 +1,112 @@
+#ifndef __PLASP__PDDL__DOMAIN_CACHE_H
+#define __PLASP__PDDL__DOMAIN_CACHE_H
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <pddl/AST.h>
+#include <pddl/Context.h>
+#include <pddl/Mode.h>
+#include <pddl/NormalizedAST.h>
+
+namespace plasp
+{
+namespace pddl
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// DomainCache
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Keeps parsed and normalized PDDL domains, so that problems of the same domain only need to be
+// parsed themselves. Domains are identified by the hash of their text and the parsing mode, and the
+// least recently used domains are evicted once more than the given number of domains are cached.
+// Each parsed domain is leased to one problem at a time, and problems of the same domain that are
+// handled concurrently obtain separately parsed copies of it
+class DomainCache
+{
+	private:
+		struct Instance
+		{
+			// The declarations that the problem parser looks up are owned by the normalized domain
+			::pddl::ast::DomainPointer domain;
+			::pddl::normalizedAST::Description description;
+			std::size_t numberOfTypes;
+		};
+
+	public:
+		class Lease
+		{
+			public:
+				Lease(const Lease &other) = delete;
+				Lease &operator=(const Lease &other) = delete;
+				Lease(Lease &&other) = default;
+				Lease &operator=(Lease &&other) = delete;
+				~Lease();
+
+				// Parses and normalizes the problem in the given context (replacing the previous one)
+				const ::pddl::normalizedAST::Description &parseProblem(::pddl::Context &context);
+
+				// The normalized domain along with the problem parsed last, if any
+				const ::pddl::normalizedAST::Description &description() const;
+
+			private:
+				friend class DomainCache;
+
+				Lease(DomainCache &cache, std::shared_ptr<const std::string> domainText, ::pddl::Mode mode,
+					std::unique_ptr<Instance> instance);
+
+				DomainCache *m_cache;
+				std::shared_ptr<const std::string> m_domainText;
+				::pddl::Mode m_mode;
+				std::unique_ptr<Instance> m_instance;
+		};
+
+		explicit DomainCache(std::size_t capacity);
+
+		// Returns an unused cached copy of the domain, or parses and normalizes it otherwise (the name
+		// only appears in the locations of parser errors and warnings)
+		Lease lease(const std::string &domainText, ::pddl::Mode mode,
+			::pddl::Context::WarningCallback warningCallback, const std::string &domainName = "domain");
+
+		std::size_t numberOfHits() const;
+		std::size_t numberOfMisses() const;
+
+	private:
+		struct Entry
+		{
+			std::shared_ptr<const std::string> domainText;
+			::pddl::Mode mode;
+			std::vector<std::unique_ptr<Instance>> unusedInstances;
+		};
+
+		static std::size_t key(const std::string &domainText, ::pddl::Mode mode);
+		static void resetProblem(Instance &instance);
+
+		void giveBack(std::shared_ptr<const std::string> domainText, ::pddl::Mode mode,
+			std::unique_ptr<Instance> instance);
+
+		const std::size_t m_capacity;
+
+		std::mutex m_mutex;
+		// Most recently used entries first
+		std::list<Entry> m_entries;
+		std::unordered_map<std::size_t, std::list<Entry>::iterator> m_entryForKey;
+
+		std::atomic<std::size_t> m_numberOfHits;
+		std::atomic<std::size_t> m_numberOfMisses;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef __PLASP__PDDL__GROUND_FACT_SINK_H
+#define __PLASP__PDDL__GROUND_FACT_SINK_H
+
+#include <limits>
+
+#include <pddl/NormalizedASTForward.h>
+
+#include <plasp/pddl/Grounding.h>
+
+namespace plasp
+{
+namespace pddl
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// GroundFactSink
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Instance of a predicate, which is a Boolean variable of the output format
+struct GroundAtom
+{
+	const ::pddl::normalizedAST::PredicateDeclaration *predicate;
+	GroundArguments arguments;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Receives the facts of a grounded PDDL description, one call per fact of the output format (see
+// doc/output-format.md) with all rules instantiated, so that the translation can be used within the
+// same process without writing and parsing text. Variables are passed as ground atoms, whose values
+// are true or false
+class GroundFactSink
+{
+	public:
+		// Effect ID of postconditions without conditions (conditional effects are numbered
+		// consecutively across all action instances)
+		static constexpr std::size_t UnconditionalEffect = std::numeric_limits<std::size_t>::max();
+
+		virtual ~GroundFactSink() = default;
+
+		virtual void variable(const GroundAtom &atom) = 0;
+
+		virtual void action(const ::pddl::normalizedAST::Action &action, const GroundArguments &arguments) = 0;
+		virtual void precondition(const ::pddl::normalizedAST::Action &action, const GroundArguments &arguments,
+			const GroundAtom &atom, bool value) = 0;
+		virtual void postcondition(const ::pddl::normalizedAST::Action &action, const GroundArguments &arguments,
+			std::size_t effectID, const GroundAtom &atom, bool value) = 0;
+		// Conditions of conditional effects
+		virtual void effectCondition(std::size_t effectID, const GroundAtom &atom, bool value) = 0;
+
+		// Called for all variables, which are false unless stated otherwise in the problem
+		virtual void initialState(const GroundAtom &atom, bool value) = 0;
+		virtual void goal(const GroundAtom &atom, bool value) = 0;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+
+#endif
@@ -0,0 +1,55 @@
+#ifndef __PLASP__PDDL__GROUNDING_H
+#define __PLASP__PDDL__GROUNDING_H
+
+#include <vector>
+
+#include <pddl/NormalizedASTForward.h>
+
+namespace plasp
+{
+namespace pddl
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Grounding
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using GroundArguments = std::vector<const ::pddl::normalizedAST::ConstantDeclaration *>;
+
+class GroundFactSink;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct Grounding
+{
+	// Instances of each action (in the order of the domain’s actions) reachable in the delete
+	// relaxation
+	std::vector<std::vector<GroundArguments>> actions;
+
+	// Instances of each predicate (in the order of the domain’s predicates) that are reachable or
+	// referred to by reachable actions or the goal; empty if the predicates cannot be ground, which
+	// is the case for descriptions with derived predicates
+	std::vector<std::vector<GroundArguments>> predicates;
+	bool hasGroundPredicates = false;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Computes the fixpoint of the delete relaxation, starting from the initial state. Negative
+// preconditions and derived predicates are assumed to be satisfiable, so no reachable action
+// instance is omitted
+Grounding groundReachableInstances(const ::pddl::normalizedAST::Description &description);
+
+// Passes the variables and action instances of the grounding to a sink, along with their
+// preconditions and effects, the initial state, and the goal (requires ground predicates)
+void translateGrounding(const ::pddl::normalizedAST::Description &description, const Grounding &grounding,
+	GroundFactSink &sink);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+
+#endif
@@ -0,0 +1,99 @@
+#ifndef __PLASP__PDDL__INCREMENTAL_TRANSLATOR_ASP_H
+#define __PLASP__PDDL__INCREMENTAL_TRANSLATOR_ASP_H
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <pddl/AST.h>
+#include <pddl/Context.h>
+#include <pddl/NormalizedAST.h>
+#include <pddl/detail/parsing/Description.h>
+#include <pddl/detail/parsing/Domain.h>
+
+namespace plasp
+{
+namespace pddl
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// IncrementalTranslatorASP
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Translates successive versions of a PDDL description, keeping the parsed description and its
+// translation between versions. The input is split into the domain’s action sections, the rest of
+// the domain, and the problem, and only the parts that changed are parsed and translated again:
+// changed actions are parsed against the kept declarations, and a changed problem is parsed against
+// the kept domain. If the declarations changed, or if the changed actions would introduce derived
+// predicates or types, everything is parsed again. The output is identical to that of TranslatorASP
+// without additional translation options
+class IncrementalTranslatorASP
+{
+	public:
+		struct Update
+		{
+			// Whether the description was parsed and translated from scratch
+			bool isComplete = false;
+			std::size_t numberOfParsedActions = 0;
+			bool isProblemParsed = false;
+		};
+
+		// Translates the description read by the context’s tokenizer, which must use the same parsing
+		// mode for all versions. If parsing fails, the previous translation is kept
+		Update update(::pddl::Context &context);
+
+		// Writes the translation of the last successfully translated version
+		void write(std::ostream &outputStream) const;
+
+		std::size_t numberOfActions() const;
+
+	private:
+		struct Action
+		{
+			std::string text;
+			std::size_t conditionalEffectIDOffset;
+			std::string output;
+		};
+
+		Update translateCompletely(::pddl::Context &context, ::pddl::detail::DescriptionParser &descriptionParser,
+			std::string &&declarationsText, std::vector<std::string> &&actionTexts, std::string &&problemText);
+		// Returns false if the changed actions cannot be parsed without parsing the domain again, in
+		// which case the action texts are left untouched
+		bool updateActions(::pddl::Context &context,
+			const std::vector<::pddl::detail::DomainParser::Section> &actionSections,
+			std::vector<std::string> &actionTexts, Update &update);
+		void updateProblem(::pddl::Context &context, ::pddl::detail::DescriptionParser &descriptionParser,
+			std::string &&problemText, Update &update);
+
+		void swapDeclarations();
+
+		void translateActions();
+		void translateDeclarations();
+		void translateProblem();
+
+		// Normalization moves the declarations that the parser looks up to the normalized domain, so
+		// they are lent back to the domain while actions and problems are parsed
+		::pddl::ast::DomainPointer m_domain;
+		::pddl::normalizedAST::Description m_description;
+		// Types that the problem parser declares in compatibility mode are removed before reparsing it
+		std::size_t m_numberOfDomainTypes = 0;
+
+		std::string m_declarationsText;
+		std::vector<Action> m_actions;
+		std::string m_problemText;
+		// A problem that failed to parse is parsed again with the next version
+		bool m_isProblemCurrent = false;
+
+		std::string m_declarationsOutput;
+		std::size_t m_numberOfTranslatedTypes = 0;
+		std::string m_problemOutput;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+
+#endif
@@ -0,0 +1,50 @@
+#ifndef __PLASP__PDDL__INVARIANT_SYNTHESIS_H
+#define __PLASP__PDDL__INVARIANT_SYNTHESIS_H
+
+#include <vector>
+
+#include <pddl/NormalizedASTForward.h>
+
+namespace plasp
+{
+namespace pddl
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// InvariantSynthesis
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct InvariantPart
+{
+	const ::pddl::normalizedAST::PredicateDeclaration *predicate;
+
+	// Positions of the predicate’s arguments that are bound to the invariant’s parameters, in the
+	// order of the invariant’s parameters; the remaining argument (if any) is counted
+	std::vector<size_t> parameterPositions;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// For each assignment of the parameters, at most one of the atoms matching the parts is true in any
+// reachable state, so each assignment forms a mutex group
+struct Invariant
+{
+	size_t numberOfParameters;
+	std::vector<InvariantPart> parts;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Finds invariants by refining candidates until all actions are balanced (monotonicity-based
+// synthesis, as in Fast Downward’s translator), and checks them against the initial state.
+// Candidates that cannot be proven with the implemented, conservative checks are dropped
+std::vector<Invariant> synthesizeInvariants(const ::pddl::normalizedAST::Description &description);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+
+#endif
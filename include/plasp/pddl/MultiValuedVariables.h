@@ -0,0 +1,58 @@
+#ifndef __PLASP__PDDL__MULTI_VALUED_VARIABLES_H
+#define __PLASP__PDDL__MULTI_VALUED_VARIABLES_H
+
+#include <map>
+#include <set>
+#include <vector>
+
+#include <pddl/NormalizedASTForward.h>
+
+#include <plasp/pddl/InvariantSynthesis.h>
+
+namespace plasp
+{
+namespace pddl
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// MultiValuedVariables
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct MultiValuedVariablePart
+{
+	// Index of the invariant the variable is formed from
+	size_t invariantID;
+	size_t numberOfParameters;
+	std::vector<size_t> parameterPositions;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Predicates whose instances are merged into multi-valued variables, one per mutex group of an
+// invariant. The atoms become the values of the variable, with false as the value for none of them
+struct MultiValuedVariables
+{
+	std::map<const ::pddl::normalizedAST::PredicateDeclaration *, MultiValuedVariablePart> parts;
+
+	// Delete effects that need not be translated, as the action assigns another value to the
+	// same variable
+	std::set<const ::pddl::normalizedAST::Predicate *> impliedDeleteEffects;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Greedily selects invariants (larger ones first) whose predicates can be represented by
+// multi-valued variables: their atoms must only be required to be true, must not be referred to
+// by derived predicates, conditional effects, or universally quantified effects, and must only be
+// deleted if known to be true or replaced with another value
+MultiValuedVariables selectMultiValuedVariables(const ::pddl::normalizedAST::Description &description,
+	const std::vector<Invariant> &invariants);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef __PLASP__PDDL__STATIC_PREDICATES_H
+#define __PLASP__PDDL__STATIC_PREDICATES_H
+
+#include <set>
+
+#include <pddl/NormalizedASTForward.h>
+
+namespace plasp
+{
+namespace pddl
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// StaticPredicates
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using StaticPredicates = std::set<const ::pddl::normalizedAST::PredicateDeclaration *>;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Predicates that no action effect refers to, whose instances keep their initial values
+StaticPredicates detectStaticPredicates(const ::pddl::normalizedAST::Domain &domain);
+
+// Static predicates that are only referred to by action preconditions (and not by conditional
+// effects, derived predicates, or the goal), which can thus be folded into action applicability
+// instead of being translated as variables
+StaticPredicates detectCompilableStaticPredicates(const ::pddl::normalizedAST::Description &description);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef __PLASP__PDDL__STREAMING_TRANSLATOR_ASP_H
+#define __PLASP__PDDL__STREAMING_TRANSLATOR_ASP_H
+
+#include <colorlog/ColorStream.h>
+
+#include <pddl/Context.h>
+
+#include <plasp/Statistics.h>
+
+namespace plasp
+{
+namespace pddl
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// StreamingTranslatorASP
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Translates a PDDL description while parsing it. Once the domain is translated, the problem’s
+// objects, initial state facts, and goal are parsed, normalized, and translated one after another,
+// and the output is written by a separate thread. Initial state facts are discarded as soon as they
+// are translated, so they are never held in memory all at once. The output is identical to that of
+// TranslatorASP without additional translation options
+class StreamingTranslatorASP
+{
+	public:
+		explicit StreamingTranslatorASP(::pddl::Context &context, colorlog::ColorStream &outputStream);
+
+		void translate();
+
+		// Counts the translated actions and derived predicates
+		void collectStatistics(Statistics &statistics) const;
+
+	private:
+		::pddl::Context &m_context;
+		colorlog::ColorStream &m_outputStream;
+
+		size_t m_numberOfActions;
+		size_t m_numberOfDerivedPredicates;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+
+#endif
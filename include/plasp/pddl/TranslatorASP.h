@@ -1,11 +1,22 @@
 #ifndef __PLASP__PDDL__TRANSLATOR_ASP_H
 #define __PLASP__PDDL__TRANSLATOR_ASP_H
 
+#include <memory>
+
 #include <colorlog/ColorStream.h>
+#include <colorlog/SymbolTable.h>
 
 #include <pddl/NormalizedASTForward.h>
 #include <pddl/Parse.h>
 
+#include <plasp/Statistics.h>
+
+#include <plasp/pddl/GroundFactSink.h>
+#include <plasp/pddl/Grounding.h>
+#include <plasp/pddl/InvariantSynthesis.h>
+#include <plasp/pddl/MultiValuedVariables.h>
+#include <plasp/pddl/StaticPredicates.h>
+
 namespace plasp
 {
 namespace pddl
@@ -22,10 +33,43 @@ class TranslatorASP
 	public:
 		explicit TranslatorASP(const ::pddl::normalizedAST::Description &description, colorlog::ColorStream &outputStream);
 
+		// Actions and initial state facts are translated in parallel if more than one thread is used
+		// (0: one thread per CPU core); the output does not depend on the number of threads
+		void setNumberOfThreads(size_t numberOfThreads);
+
+		// Adds all names used in the output to the symbol table (for integer symbol ID output)
+		void collectSymbols(colorlog::SymbolTable &symbolTable) const;
+		// Counts the translated actions and derived predicates
+		void collectStatistics(Statistics &statistics) const;
+
+		// Restricts the translated actions and variables to those reachable from the initial state
+		// (requires a problem description)
+		void ground();
+
+		// Translates static predicates that are only used in action preconditions as static/1 facts
+		// checked by the action declarations instead of as variables
+		void compileStaticPredicates();
+
+		// Translates synthesized invariants as mutex groups (requires a problem description)
+		void synthesizeMutexGroups();
+
+		// Merges the atoms of synthesized invariants into multi-valued variables where the actions
+		// permit it (requires a problem description)
+		void useMultiValuedVariables();
+
 		void translate() const;
+		// Passes the instantiated facts to a sink instead of writing rules (requires grounding a
+		// description without derived predicates, and supports none of the options above)
+		void translate(GroundFactSink &sink) const;
 
 	private:
+		// The streaming and incremental translators reuse the translation of the individual sections
+		friend class IncrementalTranslatorASP;
+		friend class StreamingTranslatorASP;
+
 		void translateDomain() const;
+		// Everything but the actions
+		void translateDomainDeclarations() const;
 		void translateUtils() const;
 		void translateTypes() const;
 		void translatePredicates() const;
@@ -34,11 +78,19 @@ class TranslatorASP
 
 		void translateProblem() const;
 		void translateInitialState() const;
+		void translateInitialStateFact(colorlog::ColorStream &outputStream, const ::pddl::normalizedAST::Fact &fact) const;
+		void translateDefaultInitialState() const;
+		void translateMutexGroups() const;
 		void translateGoal() const;
 		void translateConstants(const std::string &heading, const ::pddl::ast::ConstantDeclarations &constants) const;
 
 		const ::pddl::normalizedAST::Description &m_description;
 		colorlog::ColorStream &m_outputStream;
+		size_t m_numberOfThreads;
+		std::unique_ptr<Grounding> m_grounding;
+		StaticPredicates m_staticPredicates;
+		std::vector<Invariant> m_invariants;
+		std::unique_ptr<MultiValuedVariables> m_multiValuedVariables;
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,152 @@
+#ifndef __PLASP__PDDL__TRANSLATION__ACTION_H
+#define __PLASP__PDDL__TRANSLATION__ACTION_H
+
+#include <colorlog/Formatting.h>
+
+#include <pddl/NormalizedAST.h>
+
+#include <plasp/pddl/Grounding.h>
+#include <plasp/pddl/StaticPredicates.h>
+#include <plasp/pddl/translation/Effect.h>
+#include <plasp/pddl/translation/GroundArguments.h>
+#include <plasp/pddl/translation/Precondition.h>
+#include <plasp/pddl/translation/Primitives.h>
+#include <plasp/pddl/translation/Variables.h>
+
+namespace plasp
+{
+namespace pddl
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Action
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// If ground instances are given, only these instances are declared as actions, while the
+// preconditions and effects are still translated as rules over the declared actions. Preconditions
+// on the given static predicates are checked against static/1 facts in the action declaration
+// (ground instances are expected to satisfy them already)
+inline void translateAction(colorlog::ColorStream &outputStream, const ::pddl::normalizedAST::Action &action,
+	size_t &numberOfConditionalEffects, const std::vector<GroundArguments> *groundInstances = nullptr,
+	const StaticPredicates *staticPredicates = nullptr, const MultiValuedVariables *multiValuedVariables = nullptr)
+{
+	VariableIDMap variableIDs;
+
+	std::vector<std::pair<const ::pddl::normalizedAST::Predicate *, bool>> staticPreconditions;
+
+	if (staticPredicates && action.precondition)
+	{
+		const auto handleLiteral =
+			[&](const ::pddl::normalizedAST::Literal &literal)
+			{
+				const auto isPositive = literal.is<::pddl::normalizedAST::AtomicFormula>();
+				const auto &atomicFormula = isPositive
+					? literal.get<::pddl::normalizedAST::AtomicFormula>()
+					: literal.get<::pddl::normalizedAST::NotPointer<::pddl::normalizedAST::AtomicFormula>>()->argument;
+
+				if (!atomicFormula.is<::pddl::normalizedAST::PredicatePointer>())
+					return;
+
+				const auto &predicate = atomicFormula.get<::pddl::normalizedAST::PredicatePointer>();
+
+				if (staticPredicates->find(predicate->declaration) != staticPredicates->cend())
+					staticPreconditions.emplace_back(predicate.get(), isPositive);
+			};
+
+		const auto handleAnd =
+			[&](const ::pddl::normalizedAST::AndPointer<::pddl::normalizedAST::Literal> &and_)
+			{
+				for (const auto &argument : and_->arguments)
+					handleLiteral(argument);
+			};
+
+		action.precondition.value().match(handleLiteral, handleAnd);
+	}
+
+	const auto printActionName =
+		[&]()
+		{
+			outputStream << colorlog::Keyword("action") << "(";
+
+			if (action.parameters.empty())
+			{
+				outputStream << action << ")";
+				return;
+			}
+
+			outputStream << "(" << action;
+			translateVariablesForRuleHead(outputStream, action.parameters, variableIDs);
+			outputStream << "))";
+		};
+
+	const auto printPreconditionRuleBody =
+		[&]()
+		{
+			outputStream << " :- " << colorlog::Function("action") << "(";
+			printActionName();
+			outputStream << ")";
+		};
+
+	outputStream << std::endl;
+
+	// Name
+	if (groundInstances)
+	{
+		for (size_t i = 0; i < groundInstances->size(); i++)
+		{
+			if (i > 0)
+				outputStream << std::endl;
+
+			outputStream << colorlog::Function("action") << "(" << colorlog::Keyword("action") << "(";
+			translateGroundInstance(outputStream, action, (*groundInstances)[i]);
+			outputStream << ")).";
+		}
+	}
+	else
+	{
+		outputStream << colorlog::Function("action") << "(";
+		printActionName();
+		outputStream << ")";
+
+		if (!action.parameters.empty() || !staticPreconditions.empty())
+			outputStream << " :- ";
+
+		translateVariablesForRuleBody(outputStream, action.parameters, variableIDs);
+
+		for (size_t i = 0; i < staticPreconditions.size(); i++)
+		{
+			if (i > 0 || !action.parameters.empty())
+				outputStream << ", ";
+
+			if (!staticPreconditions[i].second)
+				outputStream << colorlog::Keyword("not") << " ";
+
+			outputStream << colorlog::Function("static") << "(" << colorlog::Keyword("variable") << "(";
+			translatePredicate(outputStream, *staticPreconditions[i].first, variableIDs);
+			outputStream << "))";
+		}
+
+		outputStream << ".";
+	}
+
+	// Precondition
+	if (action.precondition)
+		translatePrecondition(outputStream, action.precondition.value(), printActionName,
+			printPreconditionRuleBody, variableIDs, staticPredicates, multiValuedVariables);
+
+	// Effect
+	if (action.effect)
+		translateEffect(outputStream, action.effect.value(), printActionName,
+			numberOfConditionalEffects, variableIDs, multiValuedVariables);
+
+	outputStream << std::endl;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+
+#endif
@@ -25,21 +25,29 @@ namespace pddl
 //
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+// Delete effects implied by assignments to multi-valued variables are omitted
 template<typename PrintObjectName>
 inline void translateEffect(colorlog::ColorStream &outputStream,
 	const ::pddl::normalizedAST::Effect &effect, PrintObjectName printObjectName,
-	VariableStack &variableStack, size_t &numberOfConditionalEffects, VariableIDMap &variableIDs)
+	VariableStack &variableStack, size_t &numberOfConditionalEffects, VariableIDMap &variableIDs,
+	const MultiValuedVariables *multiValuedVariables = nullptr)
 {
 	const auto handlePredicate =
 		[&](const ::pddl::normalizedAST::PredicatePointer &predicate, bool isPositive = true)
 		{
+			if (!isPositive && multiValuedVariables
+				&& multiValuedVariables->impliedDeleteEffects.find(predicate.get()) != multiValuedVariables->impliedDeleteEffects.cend())
+			{
+				return;
+			}
+
 			outputStream << std::endl << colorlog::Function("postcondition") << "(";
 			printObjectName();
 			outputStream
 				<< ", " << colorlog::Keyword("effect") << "("
 				<< colorlog::Reserved("unconditional") << ")"
 				<< ", ";
-			translatePredicateToVariable(outputStream, *predicate, variableIDs, isPositive);
+			translatePredicateToVariable(outputStream, *predicate, variableIDs, isPositive, multiValuedVariables);
 			outputStream << ") :- " << colorlog::Function("action") << "(";
 			printObjectName();
 			outputStream << ")";
@@ -98,7 +106,7 @@ inline void translateEffect(colorlog::ColorStream &outputStream,
 		{
 			for (const auto &argument : and_->arguments)
 				translateEffect(outputStream, argument, printObjectName, variableStack,
-					numberOfConditionalEffects, variableIDs);
+					numberOfConditionalEffects, variableIDs, multiValuedVariables);
 		};
 
 	const auto handleForAll =
@@ -107,7 +115,7 @@ inline void translateEffect(colorlog::ColorStream &outputStream,
 			variableStack.push(&forAll->parameters);
 
 			translateEffect(outputStream, forAll->argument, printObjectName,
-				variableStack, numberOfConditionalEffects, variableIDs);
+				variableStack, numberOfConditionalEffects, variableIDs, multiValuedVariables);
 
 			variableStack.pop();
 		};
@@ -156,12 +164,52 @@ inline void translateEffect(colorlog::ColorStream &outputStream,
 template<typename PrintObjectName>
 inline void translateEffect(colorlog::ColorStream &outputStream,
 	const ::pddl::normalizedAST::Effect &effect, PrintObjectName printObjectName,
-	size_t &numberOfConditionalEffects, VariableIDMap &variableIDs)
+	size_t &numberOfConditionalEffects, VariableIDMap &variableIDs,
+	const MultiValuedVariables *multiValuedVariables = nullptr)
 {
 	VariableStack variableStack;
 
 	translateEffect(outputStream, effect, printObjectName, variableStack,
-		numberOfConditionalEffects, variableIDs);
+		numberOfConditionalEffects, variableIDs, multiValuedVariables);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Counts the conditional effects, which determines by how much translateEffect advances the
+// conditional effect IDs
+inline size_t countConditionalEffects(const ::pddl::normalizedAST::Effect &effect)
+{
+	const auto handleLiteral =
+		[](const ::pddl::normalizedAST::Literal &)
+		{
+			return size_t(0);
+		};
+
+	const auto handleAnd =
+		[](const ::pddl::normalizedAST::AndPointer<::pddl::normalizedAST::Effect> &and_)
+		{
+			size_t numberOfConditionalEffects{0};
+
+			for (const auto &argument : and_->arguments)
+				numberOfConditionalEffects += countConditionalEffects(argument);
+
+			return numberOfConditionalEffects;
+		};
+
+	const auto handleForAll =
+		[](const ::pddl::normalizedAST::ForAllPointer<::pddl::normalizedAST::Effect> &forAll)
+		{
+			return countConditionalEffects(forAll->argument);
+		};
+
+	const auto handleWhen =
+		[](const ::pddl::normalizedAST::WhenPointer<::pddl::normalizedAST::Precondition,
+			::pddl::normalizedAST::ConditionalEffect> &)
+		{
+			return size_t(1);
+		};
+
+	return effect.match(handleAnd, handleForAll, handleLiteral, handleWhen);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
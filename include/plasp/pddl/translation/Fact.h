@@ -18,7 +18,8 @@ namespace pddl
 //
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-inline void translateFact(colorlog::ColorStream &outputStream, const ::pddl::normalizedAST::Fact &fact)
+inline void translateFact(colorlog::ColorStream &outputStream, const ::pddl::normalizedAST::Fact &fact,
+	const MultiValuedVariables *multiValuedVariables = nullptr)
 {
 	outputStream << std::endl << colorlog::Function("initialState") << "(";
 
@@ -27,7 +28,7 @@ inline void translateFact(colorlog::ColorStream &outputStream, const ::pddl::nor
 	const auto handlePredicate =
 		[&](const ::pddl::normalizedAST::PredicatePointer &predicate, bool isPositive = true)
 		{
-			translatePredicateToVariable(outputStream, *predicate, variableIDs, isPositive);
+			translatePredicateToVariable(outputStream, *predicate, variableIDs, isPositive, multiValuedVariables);
 		};
 
 	const auto handleNegatedPredicate =
@@ -67,6 +68,22 @@ inline void translateFact(colorlog::ColorStream &outputStream, const ::pddl::nor
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+// Instances of static predicates are no variables and hence not part of the initial state
+inline void translateStaticFact(colorlog::ColorStream &outputStream, const ::pddl::normalizedAST::Predicate &predicate)
+{
+	VariableIDMap variableIDs;
+
+	outputStream
+		<< std::endl << colorlog::Function("static") << "("
+		<< colorlog::Keyword("variable") << "(";
+
+	translatePredicate(outputStream, predicate, variableIDs);
+
+	outputStream << ")).";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 }
 }
 
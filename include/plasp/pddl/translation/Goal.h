@@ -22,7 +22,8 @@ namespace pddl
 //
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-inline void translateGoal(colorlog::ColorStream &outputStream, const ::pddl::normalizedAST::Goal &goal)
+inline void translateGoal(colorlog::ColorStream &outputStream, const ::pddl::normalizedAST::Goal &goal,
+	const MultiValuedVariables *multiValuedVariables = nullptr)
 {
 	VariableIDMap variableIDs;
 
@@ -40,7 +41,7 @@ inline void translateGoal(colorlog::ColorStream &outputStream, const ::pddl::nor
 			ensureNoVariables(predicate);
 
 			outputStream << std::endl << colorlog::Function("goal") << "(";
-			translatePredicateToVariable(outputStream, *predicate, variableIDs, isPositive);
+			translatePredicateToVariable(outputStream, *predicate, variableIDs, isPositive, multiValuedVariables);
 			outputStream << ").";
 		};
 
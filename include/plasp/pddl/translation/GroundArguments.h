@@ -0,0 +1,47 @@
+#ifndef __PLASP__PDDL__TRANSLATION__GROUND_ARGUMENTS_H
+#define __PLASP__PDDL__TRANSLATION__GROUND_ARGUMENTS_H
+
+#include <colorlog/Formatting.h>
+
+#include <pddl/NormalizedAST.h>
+
+#include <plasp/pddl/Grounding.h>
+#include <plasp/pddl/translation/Primitives.h>
+
+namespace plasp
+{
+namespace pddl
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// GroundArguments
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Prints a ground instance of a named element (action or predicate) in the same format as the
+// lifted rule heads, such as ("name", constant("a"), constant("b")) or just "name"
+template<class Element>
+inline void translateGroundInstance(colorlog::ColorStream &outputStream, const Element &element,
+	const GroundArguments &groundArguments)
+{
+	if (groundArguments.empty())
+	{
+		outputStream << element;
+		return;
+	}
+
+	outputStream << "(" << element;
+
+	for (const auto *constant : groundArguments)
+		outputStream << ", " << colorlog::Keyword("constant") << "(" << *constant << ")";
+
+	outputStream << ")";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+
+#endif
@@ -7,6 +7,8 @@
 
 #include <plasp/TranslatorException.h>
 
+#include <plasp/pddl/StaticPredicates.h>
+
 #include <plasp/pddl/translation/DerivedPredicate.h>
 #include <plasp/pddl/translation/Predicate.h>
 #include <plasp/pddl/translation/Primitives.h>
@@ -22,18 +24,23 @@ namespace pddl
 //
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+// Preconditions on the given static predicates are omitted, as they are translated separately
 template<typename PrintObjectName, typename PrintRuleBody>
 inline void translatePrecondition(colorlog::ColorStream &outputStream,
 	const ::pddl::normalizedAST::Precondition &precondition, PrintObjectName printObjectName,
-	PrintRuleBody printRuleBody, VariableIDMap &variableIDs)
+	PrintRuleBody printRuleBody, VariableIDMap &variableIDs, const StaticPredicates *staticPredicates = nullptr,
+	const MultiValuedVariables *multiValuedVariables = nullptr)
 {
 	const auto handlePredicate =
 		[&](const ::pddl::normalizedAST::PredicatePointer &predicate, bool isPositive = true)
 		{
+			if (staticPredicates && staticPredicates->find(predicate->declaration) != staticPredicates->cend())
+				return;
+
 			outputStream << std::endl << colorlog::Function("precondition") << "(";
 			printObjectName();
 			outputStream << ", ";
-			translatePredicateToVariable(outputStream, *predicate, variableIDs, isPositive);
+			translatePredicateToVariable(outputStream, *predicate, variableIDs, isPositive, multiValuedVariables);
 			outputStream << ")";
 			printRuleBody();
 			outputStream << ".";
@@ -6,6 +6,7 @@
 #include <pddl/NormalizedAST.h>
 #include <pddl/Parse.h>
 
+#include <plasp/pddl/MultiValuedVariables.h>
 #include <plasp/pddl/translation/Primitives.h>
 #include <plasp/pddl/translation/Variables.h>
 
@@ -22,6 +23,7 @@ namespace pddl
 
 void translatePredicate(colorlog::ColorStream &outputStream, const ::pddl::normalizedAST::Predicate &predicate, VariableIDMap &variableIDs);
 void translatePredicateDeclaration(colorlog::ColorStream &outputStream, const ::pddl::normalizedAST::PredicateDeclaration &predicateDeclaration, VariableIDMap &variableIDs);
+void translatePredicateDeclarationToVariable(colorlog::ColorStream &outputStream, const ::pddl::normalizedAST::PredicateDeclaration &predicateDeclaration, VariableIDMap &variableIDs, const MultiValuedVariables *multiValuedVariables = nullptr);
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -78,8 +80,105 @@ inline void translatePredicateDeclaration(colorlog::ColorStream &outputStream, c
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void translatePredicateToVariable(colorlog::ColorStream &outputStream, const ::pddl::normalizedAST::Predicate &predicate, VariableIDMap &variableIDs, bool isPositive = true)
+// Prints the multi-valued variable of a mutex group with the arguments at the given positions
+template<class PrintArgument>
+inline void translateMultiValuedVariable(colorlog::ColorStream &outputStream, const MultiValuedVariablePart &part, PrintArgument printArgument)
 {
+	outputStream << colorlog::Keyword("variable") << "(" << colorlog::Keyword("mutexGroup") << "(";
+
+	if (part.numberOfParameters == 0)
+	{
+		outputStream << colorlog::Number<size_t>(part.invariantID) << "))";
+		return;
+	}
+
+	outputStream << "(" << colorlog::Number<size_t>(part.invariantID);
+
+	for (const auto parameterPosition : part.parameterPositions)
+	{
+		outputStream << ", ";
+		printArgument(parameterPosition);
+	}
+
+	outputStream << ")))";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Atoms merged into multi-valued variables are values of these variables instead of variables
+inline void translatePredicateDeclarationToVariable(colorlog::ColorStream &outputStream, const ::pddl::normalizedAST::PredicateDeclaration &predicateDeclaration, VariableIDMap &variableIDs, const MultiValuedVariables *multiValuedVariables)
+{
+	if (multiValuedVariables)
+	{
+		const auto matchingPart = multiValuedVariables->parts.find(&predicateDeclaration);
+
+		if (matchingPart != multiValuedVariables->parts.cend())
+		{
+			const auto printArgument =
+				[&](size_t position)
+				{
+					translateVariableDeclaration(outputStream, *predicateDeclaration.parameters[position], variableIDs);
+				};
+
+			translateMultiValuedVariable(outputStream, matchingPart->second, printArgument);
+			outputStream << ", " << colorlog::Keyword("value") << "(";
+			translateMultiValuedVariable(outputStream, matchingPart->second, printArgument);
+			outputStream << ", ";
+			translatePredicateDeclaration(outputStream, predicateDeclaration, variableIDs);
+			outputStream << ")";
+
+			return;
+		}
+	}
+
+	translatePredicateDeclaration(outputStream, predicateDeclaration, variableIDs);
+	outputStream << ", " << colorlog::Keyword("value") << "(";
+	translatePredicateDeclaration(outputStream, predicateDeclaration, variableIDs);
+	outputStream << ", " << colorlog::Boolean("true") << ")";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline void translatePredicateToVariable(colorlog::ColorStream &outputStream, const ::pddl::normalizedAST::Predicate &predicate, VariableIDMap &variableIDs, bool isPositive = true, const MultiValuedVariables *multiValuedVariables = nullptr)
+{
+	if (multiValuedVariables)
+	{
+		const auto matchingPart = multiValuedVariables->parts.find(predicate.declaration);
+
+		if (matchingPart != multiValuedVariables->parts.cend())
+		{
+			const auto printArgument =
+				[&](size_t position)
+				{
+					const auto &argument = predicate.arguments[position];
+
+					if (argument.is<::pddl::normalizedAST::ConstantPointer>())
+						outputStream << colorlog::Keyword("constant") << "(" << *argument.get<::pddl::normalizedAST::ConstantPointer>() << ")";
+					else
+						translateVariable(outputStream, *argument.get<::pddl::normalizedAST::VariablePointer>(), variableIDs);
+				};
+
+			translateMultiValuedVariable(outputStream, matchingPart->second, printArgument);
+			outputStream << ", " << colorlog::Keyword("value") << "(";
+			translateMultiValuedVariable(outputStream, matchingPart->second, printArgument);
+			outputStream << ", ";
+
+			// Deleting the atom resets the variable
+			if (isPositive)
+			{
+				outputStream << colorlog::Keyword("variable") << "(";
+				translatePredicate(outputStream, predicate, variableIDs);
+				outputStream << ")";
+			}
+			else
+				outputStream << colorlog::Boolean("false");
+
+			outputStream << ")";
+
+			return;
+		}
+	}
+
 	outputStream << colorlog::Keyword("variable") << "(";
 
 	translatePredicate(outputStream, predicate, variableIDs);
@@ -1,11 +1,14 @@
 #ifndef __PLASP__SAS__ASSIGNED_VARIABLE_H
 #define __PLASP__SAS__ASSIGNED_VARIABLE_H
 
+#include <cstdint>
 #include <iosfwd>
+#include <type_traits>
 #include <vector>
 
 #include <tokenize/Tokenizer.h>
 
+#include <plasp/sas/Binary.h>
 #include <plasp/sas/Value.h>
 #include <plasp/sas/Variable.h>
 
@@ -25,25 +28,37 @@ using AssignedVariables = std::vector<AssignedVariable>;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+// Refers to the variable and value by their indices, which keeps conditions and effects compact.
+// The variables and values themselves are looked up in the variables of the description
 class AssignedVariable
 {
 	public:
 		static AssignedVariable fromSAS(tokenize::Tokenizer<> &tokenizer, const Variables &variables);
-		static AssignedVariable fromSAS(tokenize::Tokenizer<> &tokenizer, const Variable &variable);
+		static AssignedVariable fromSAS(tokenize::Tokenizer<> &tokenizer, const Variables &variables, size_t variableID);
+		static AssignedVariable fromBinary(BinaryReader &reader, const Variables &variables);
 
 	public:
-		explicit AssignedVariable(const Variable &variable, const Value &value);
+		explicit AssignedVariable(size_t variableID, int valueID);
 
-		const Variable &variable() const;
-		const Value &value() const;
+		size_t variableID() const;
+		// Value::AnyID if any value is matched
+		int valueID() const;
+
+		const Variable &variable(const Variables &variables) const;
+		const Value &value(const Variables &variables) const;
+
+		void writeBinary(BinaryWriter &writer) const;
 
 	private:
-		AssignedVariable();
+		AssignedVariable() = default;
 
-		const Variable *m_variable;
-		const Value *m_value;
+		uint32_t m_variableID;
+		int32_t m_valueID;
 };
 
+static_assert(std::is_trivially_copyable<AssignedVariable>::value && sizeof(AssignedVariable) == 8,
+	"assigned variables are expected to be compact");
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 }
@@ -31,11 +31,14 @@ class AxiomRule
 		using Conditions = AssignedVariables;
 
 		static AxiomRule fromSAS(tokenize::Tokenizer<> &tokenizer, const Variables &variables);
+		static AxiomRule fromBinary(BinaryReader &reader, const Variables &variables);
 
 	public:
 		const Conditions &conditions() const;
 		const Condition &postcondition() const;
 
+		void writeBinary(BinaryWriter &writer) const;
+
 	private:
 		AxiomRule() = default;
 		explicit AxiomRule(Conditions conditions, Condition postcondition);
@@ -0,0 +1,212 @@
+#ifndef __PLASP__SAS__BINARY_H
+#define __PLASP__SAS__BINARY_H
+
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace plasp
+{
+namespace sas
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Binary
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Binary SAS descriptions start with a magic number and the format version, followed by the size of
+// the string pool, the string pool itself, and the sections of the description in the same order as
+// in the text format. All integers are stored in little-endian byte order. Strings are stored once
+// in the string pool (null-terminated) and referenced by their offset and length
+constexpr char BinaryMagic[] = {'P', 'L', 'A', 'S', 'P', 'S', 'A', 'S'};
+constexpr uint32_t BinaryFormatVersion = 1;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class BinaryWriter
+{
+	public:
+		void writeUInt32(uint32_t value)
+		{
+			for (size_t i = 0; i < 4; i++)
+				m_content.push_back(static_cast<char>((value >> (8 * i)) & 0xff));
+		}
+
+		void writeInt32(int32_t value)
+		{
+			writeUInt32(static_cast<uint32_t>(value));
+		}
+
+		void writeUInt64(uint64_t value)
+		{
+			writeUInt32(static_cast<uint32_t>(value));
+			writeUInt32(static_cast<uint32_t>(value >> 32));
+		}
+
+		void writeSize(size_t size)
+		{
+			if (size > UINT32_MAX)
+				throw std::runtime_error("SAS description too large for the binary format");
+
+			writeUInt32(static_cast<uint32_t>(size));
+		}
+
+		void writeString(std::string_view string)
+		{
+			auto match = m_stringOffsets.find(std::string(string));
+
+			if (match == m_stringOffsets.end())
+			{
+				match = m_stringOffsets.emplace(std::string(string), m_strings.size()).first;
+				m_strings.append(string.data(), string.size());
+				m_strings.push_back('\0');
+			}
+
+			writeSize(match->second);
+			writeSize(string.size());
+		}
+
+		// Writes the header and the string pool, followed by all content written so far
+		void writeTo(std::ostream &stream) const
+		{
+			BinaryWriter header;
+			header.m_content.append(BinaryMagic, sizeof(BinaryMagic));
+			header.writeUInt32(BinaryFormatVersion);
+			header.writeSize(m_strings.size());
+
+			stream.write(header.m_content.data(), header.m_content.size());
+			stream.write(m_strings.data(), m_strings.size());
+			stream.write(m_content.data(), m_content.size());
+		}
+
+	private:
+		std::string m_content;
+		std::string m_strings;
+		std::unordered_map<std::string, size_t> m_stringOffsets;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Reads binary SAS descriptions without copying them. Strings point into the read data directly
+class BinaryReader
+{
+	public:
+		static bool hasMagic(const char *data, size_t size)
+		{
+			return size >= sizeof(BinaryMagic) && std::memcmp(data, BinaryMagic, sizeof(BinaryMagic)) == 0;
+		}
+
+	public:
+		explicit BinaryReader(const char *data, size_t size)
+		:	m_data{data},
+			m_size{size},
+			m_position{0},
+			m_strings{nullptr},
+			m_stringsSize{0}
+		{
+		}
+
+		// Checks the magic number and the format version and locates the string pool
+		void readHeader()
+		{
+			if (!hasMagic(m_data, m_size))
+				throw std::runtime_error("not a binary SAS description");
+
+			m_position = sizeof(BinaryMagic);
+
+			const auto formatVersion = getUInt32();
+
+			if (formatVersion != BinaryFormatVersion)
+				throw std::runtime_error("unsupported binary SAS format version (" + std::to_string(formatVersion) + ")");
+
+			m_stringsSize = getSize();
+			require(m_stringsSize);
+			m_strings = m_data + m_position;
+			m_position += m_stringsSize;
+		}
+
+		uint32_t getUInt32()
+		{
+			require(4);
+
+			const auto *bytes = reinterpret_cast<const unsigned char *>(m_data + m_position);
+			m_position += 4;
+
+			return static_cast<uint32_t>(bytes[0])
+				| (static_cast<uint32_t>(bytes[1]) << 8)
+				| (static_cast<uint32_t>(bytes[2]) << 16)
+				| (static_cast<uint32_t>(bytes[3]) << 24);
+		}
+
+		int32_t getInt32()
+		{
+			return static_cast<int32_t>(getUInt32());
+		}
+
+		uint64_t getUInt64()
+		{
+			const uint64_t lowerBits = getUInt32();
+			const uint64_t upperBits = getUInt32();
+
+			return lowerBits | (upperBits << 32);
+		}
+
+		size_t getSize()
+		{
+			return getUInt32();
+		}
+
+		// Sizes of sections, which must not exceed the remaining data (guards allocations)
+		size_t getNumberOfElements(size_t minimumElementSize)
+		{
+			const auto numberOfElements = getSize();
+
+			if (numberOfElements > (m_size - m_position) / minimumElementSize)
+				throw std::runtime_error("malformed binary SAS description (number of elements out of range)");
+
+			return numberOfElements;
+		}
+
+		std::string_view getString()
+		{
+			const auto offset = getSize();
+			const auto length = getSize();
+
+			if (offset >= m_stringsSize || length >= m_stringsSize - offset || m_strings[offset + length] != '\0')
+				throw std::runtime_error("malformed binary SAS description (string out of range)");
+
+			return std::string_view(m_strings + offset, length);
+		}
+
+		bool atEnd() const
+		{
+			return m_position == m_size;
+		}
+
+	private:
+		void require(size_t size) const
+		{
+			if (size > m_size - m_position)
+				throw std::runtime_error("malformed binary SAS description (unexpected end of file)");
+		}
+
+		const char *m_data;
+		size_t m_size;
+		size_t m_position;
+
+		const char *m_strings;
+		size_t m_stringsSize;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+
+#endif
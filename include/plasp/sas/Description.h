@@ -8,11 +8,14 @@
 
 #include <tokenize/Tokenizer.h>
 
+#include <plasp/MappedFile.h>
+
 #include <plasp/sas/AxiomRule.h>
 #include <plasp/sas/Goal.h>
 #include <plasp/sas/InitialState.h>
 #include <plasp/sas/MutexGroup.h>
 #include <plasp/sas/Operator.h>
+#include <plasp/sas/StringPool.h>
 #include <plasp/sas/Variable.h>
 
 namespace plasp
@@ -29,9 +32,14 @@ namespace sas
 class Description
 {
 	public:
-		static Description fromTokenizer(tokenize::Tokenizer<> &&tokenizer);
+		// Operators and axiom rules are parsed in parallel if more than one thread is used (0: one
+		// thread per CPU core)
+		static Description fromTokenizer(tokenize::Tokenizer<> &&tokenizer, size_t numberOfThreads = 1);
 		static Description fromStream(std::istream &istream);
 		static Description fromFile(const std::experimental::filesystem::path &path);
+		// Binary descriptions are mapped into memory, and names are not copied out of the file
+		static Description fromBinaryFile(const std::experimental::filesystem::path &path);
+		static bool isBinaryFile(const std::experimental::filesystem::path &path);
 
 	public:
 		bool usesActionCosts() const;
@@ -47,10 +55,15 @@ class Description
 
 		bool hasRequirements() const;
 
+		void writeBinary(std::ostream &ostream) const;
+
 	private:
+		// The streaming translator parses descriptions section by section
+		friend class StreamingTranslatorASP;
+
 		Description();
 
-		void parseContent(tokenize::Tokenizer<> &tokenizer);
+		void parseContent(tokenize::Tokenizer<> &tokenizer, size_t numberOfThreads = 1);
 
 		void parseVersionSection(tokenize::Tokenizer<> &tokenizer) const;
 		void parseMetricSection(tokenize::Tokenizer<> &tokenizer);
@@ -58,11 +71,14 @@ class Description
 		void parseMutexSection(tokenize::Tokenizer<> &tokenizer);
 		void parseInitialStateSection(tokenize::Tokenizer<> &tokenizer);
 		void parseGoalSection(tokenize::Tokenizer<> &tokenizer);
-		void parseOperatorSection(tokenize::Tokenizer<> &tokenizer);
-		void parseAxiomSection(tokenize::Tokenizer<> &tokenizer);
+		void parseOperatorSection(tokenize::Tokenizer<> &tokenizer, size_t numberOfThreads);
+		void parseAxiomSection(tokenize::Tokenizer<> &tokenizer, size_t numberOfThreads);
 
 		bool m_usesActionCosts;
 
+		// Names of the variables and values
+		StringPool m_names;
+		std::unique_ptr<MappedFile> m_mappedFile;
 		Variables m_variables;
 		MutexGroups m_mutexGroups;
 		std::unique_ptr<InitialState> m_initialState;
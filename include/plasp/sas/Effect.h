@@ -31,11 +31,14 @@ class Effect
 		using Conditions = AssignedVariables;
 
 		static Effect fromSAS(tokenize::Tokenizer<> &tokenizer, const Variables &variables, Conditions &preconditions);
+		static Effect fromBinary(BinaryReader &reader, const Variables &variables);
 
 	public:
 		const Conditions &conditions() const;
 		const Condition &postcondition() const;
 
+		void writeBinary(BinaryWriter &writer) const;
+
 	private:
 		Effect() = default;
 		explicit Effect(Conditions conditions, Condition postcondition);
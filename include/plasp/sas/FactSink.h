@@ -0,0 +1,92 @@
+#ifndef __PLASP__SAS__FACT_SINK_H
+#define __PLASP__SAS__FACT_SINK_H
+
+#include <limits>
+#include <memory>
+
+#include <plasp/sas/AssignedVariable.h>
+#include <plasp/sas/Operator.h>
+
+namespace plasp
+{
+namespace sas
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// FactSink
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Receives the facts of a translated SAS description, one call per fact of the output format (see
+// doc/output-format.md), so that the translation can be used within the same process without
+// writing and parsing text. Facts of variables and values are passed as assigned variables that
+// refer to the variables of the translated description. Operators are passed directly, as the
+// streaming translator does not keep them in the description
+class FactSink
+{
+	public:
+		enum class Section
+		{
+			Requirements,
+			Variables,
+			Actions,
+			MutexGroups,
+			AxiomRules,
+			InitialState,
+			Goal
+		};
+
+		enum class Feature
+		{
+			ActionCosts,
+			AxiomRules,
+			ConditionalEffects
+		};
+
+		// Effect ID of postconditions without conditions (conditional effects are numbered
+		// consecutively across all operators)
+		static constexpr std::size_t UnconditionalEffect = std::numeric_limits<std::size_t>::max();
+
+		virtual ~FactSink() = default;
+
+		// Called before the facts of each section
+		virtual void beginSection(Section section);
+
+		virtual void requiresFeature(Feature feature) = 0;
+
+		virtual void variable(std::size_t variableID) = 0;
+		virtual void contains(const AssignedVariable &fact) = 0;
+
+		virtual void action(const Operator &operator_) = 0;
+		virtual void precondition(const Operator &operator_, const AssignedVariable &fact) = 0;
+		virtual void postcondition(const Operator &operator_, std::size_t effectID, const AssignedVariable &fact) = 0;
+		// Conditions of conditional effects
+		virtual void effectCondition(std::size_t effectID, const AssignedVariable &fact) = 0;
+		virtual void costs(const Operator &operator_) = 0;
+
+		// Mutex groups and axiom rules are numbered consecutively, omitting pruned ones
+		virtual void mutexGroup(std::size_t mutexGroupID) = 0;
+		virtual void mutexGroupContains(std::size_t mutexGroupID, const AssignedVariable &fact) = 0;
+		virtual void axiomRule(std::size_t axiomRuleID) = 0;
+		virtual void axiomRulePrecondition(std::size_t axiomRuleID, const AssignedVariable &fact) = 0;
+		virtual void axiomRulePostcondition(std::size_t axiomRuleID, const AssignedVariable &fact) = 0;
+
+		virtual void initialState(const AssignedVariable &fact) = 0;
+		virtual void goal(const AssignedVariable &fact) = 0;
+
+		// Sinks supporting chunks receive the facts of operators and initial state facts from multiple
+		// threads if requested. Contiguous chunks of them are passed to separate sinks obtained with
+		// makeChunkSink (which must be thread-safe), and these are appended in order once complete.
+		// Other sinks receive all facts sequentially
+		virtual bool supportsChunks() const;
+		virtual std::unique_ptr<FactSink> makeChunkSink();
+		virtual void appendChunk(FactSink &chunkSink);
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+
+#endif
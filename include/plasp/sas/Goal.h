@@ -23,10 +23,13 @@ class Goal
 		using Facts = AssignedVariables;
 
 		static Goal fromSAS(tokenize::Tokenizer<> &tokenizer, const Variables &variables);
+		static Goal fromBinary(BinaryReader &reader, const Variables &variables);
 
 	public:
 		const Facts &facts() const;
 
+		void writeBinary(BinaryWriter &writer) const;
+
 	private:
 		Goal() = default;
 
@@ -23,10 +23,13 @@ class InitialState
 		using Facts = AssignedVariables;
 
 		static InitialState fromSAS(tokenize::Tokenizer<> &tokenizer, const Variables &variables);
+		static InitialState fromBinary(BinaryReader &reader, const Variables &variables);
 
 	public:
 		const Facts &facts() const;
 
+		void writeBinary(BinaryWriter &writer) const;
+
 	private:
 		InitialState() = default;
 
@@ -30,10 +30,13 @@ class MutexGroup
 		using Facts = AssignedVariables;
 
 		static MutexGroup fromSAS(tokenize::Tokenizer<> &tokenizer, const Variables &variables);
+		static MutexGroup fromBinary(BinaryReader &reader, const Variables &variables);
 
 	public:
 		const Facts &facts() const;
 
+		void writeBinary(BinaryWriter &writer) const;
+
 	private:
 		MutexGroup() = default;
 
@@ -37,6 +37,7 @@ class Operator
 		using Conditions = AssignedVariables;
 
 		static Operator fromSAS(tokenize::Tokenizer<> &tokenizer, const Variables &variables);
+		static Operator fromBinary(BinaryReader &reader, const Variables &variables);
 
 	public:
 		void printPredicateAsASP(colorlog::ColorStream &stream) const;
@@ -46,6 +47,8 @@ class Operator
 		const Effects &effects() const;
 		size_t costs() const;
 
+		void writeBinary(BinaryWriter &writer) const;
+
 	private:
 		Operator() = default;
 
@@ -9,6 +9,8 @@
 
 #include <colorlog/ColorStream.h>
 
+#include <plasp/sas/Binary.h>
+
 namespace plasp
 {
 namespace sas
@@ -24,12 +26,14 @@ class Predicate
 {
 	public:
 		static Predicate fromSAS(tokenize::Tokenizer<> &tokenizer);
+		static Predicate fromBinary(BinaryReader &reader);
 
 		using Arguments = std::vector<std::string>;
 
 	public:
 		void printAsSAS(colorlog::ColorStream &stream) const;
 		void printAsASP(colorlog::ColorStream &stream) const;
+		void writeBinary(BinaryWriter &writer) const;
 
 		const std::string &name() const;
 		const Arguments &arguments() const;
@@ -0,0 +1,69 @@
+#ifndef __PLASP__SAS__RELEVANCE_H
+#define __PLASP__SAS__RELEVANCE_H
+
+#include <vector>
+
+#include <plasp/sas/Description.h>
+
+namespace plasp
+{
+namespace sas
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Relevance
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+enum class PruningMode
+{
+	None,
+	// Keeps only operators and values reachable from the initial state (forward chaining)
+	Forward,
+	// Keeps only operators and variables that may contribute to the goal (backward regression)
+	Backward,
+	Both
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Relevance analysis as performed by encodings/strips/preprocess.lp, computed natively. Operators
+// that are inconsistent or do not change any variable are never relevant. Backward regression is
+// skipped for descriptions with axiom rules, as derived variables may also be needed to stay false
+class Relevance
+{
+	public:
+		static Relevance analyze(const Description &description, PruningMode pruningMode);
+
+	public:
+		bool isRelevant(const Variable &variable) const;
+		bool isRelevant(const AssignedVariable &assignedVariable) const;
+		bool isRelevant(const Operator &operator_) const;
+		bool isRelevant(const Effect &effect) const;
+		bool isRelevant(const AxiomRule &axiomRule) const;
+		bool isRelevant(const MutexGroup &mutexGroup) const;
+
+	private:
+		explicit Relevance(const Description &description);
+
+		size_t variableID(const Variable &variable) const;
+		size_t factID(const AssignedVariable &assignedVariable) const;
+
+		const Description &m_description;
+
+		// Facts are numbered consecutively by variable and value
+		std::vector<size_t> m_factIDOffsets;
+
+		std::vector<bool> m_relevantVariables;
+		std::vector<bool> m_relevantFacts;
+		std::vector<bool> m_relevantOperators;
+		std::vector<bool> m_relevantAxiomRules;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+
+#endif
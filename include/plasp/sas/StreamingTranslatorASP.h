@@ -0,0 +1,48 @@
+#ifndef __PLASP__SAS__STREAMING_TRANSLATOR_ASP_H
+#define __PLASP__SAS__STREAMING_TRANSLATOR_ASP_H
+
+#include <colorlog/ColorStream.h>
+
+#include <tokenize/Tokenizer.h>
+
+#include <plasp/Statistics.h>
+
+namespace plasp
+{
+namespace sas
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// StreamingTranslatorASP
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Translates a SAS description while parsing it. Operators and axiom rules are translated as soon as
+// they are parsed and are discarded afterward. Only the sections preceding them are kept in memory.
+// The output is written by a separate thread. It contains the same facts as that of TranslatorASP.
+// The feature requirements come last, because they depend on all operators
+class StreamingTranslatorASP
+{
+	public:
+		explicit StreamingTranslatorASP(tokenize::Tokenizer<> &&tokenizer, colorlog::ColorStream &outputStream);
+
+		void translate();
+
+		// Counts the translated actions and derived predicates (axiom rules)
+		void collectStatistics(Statistics &statistics) const;
+
+	private:
+		tokenize::Tokenizer<> m_tokenizer;
+		colorlog::ColorStream &m_outputStream;
+
+		size_t m_numberOfOperators;
+		size_t m_numberOfAxiomRules;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+
+#endif
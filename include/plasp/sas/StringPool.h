@@ -0,0 +1,46 @@
+#ifndef __PLASP__SAS__STRING_POOL_H
+#define __PLASP__SAS__STRING_POOL_H
+
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace plasp
+{
+namespace sas
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// StringPool
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Stores the names of variables and values contiguously in large blocks instead of one allocation
+// per name. Added strings never move, so the returned views stay valid as long as the pool exists,
+// even if the pool itself is moved
+class StringPool
+{
+	public:
+		StringPool();
+
+		StringPool(const StringPool &other) = delete;
+		StringPool &operator=(const StringPool &other) = delete;
+		StringPool(StringPool &&other) = default;
+		StringPool &operator=(StringPool &&other) = default;
+
+		// Copies the string into the pool (null-terminated, so that data() can be passed to C APIs)
+		std::string_view add(std::string_view string);
+
+	private:
+		std::vector<std::unique_ptr<char[]>> m_blocks;
+		size_t m_blockSize;
+		size_t m_blockPosition;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+
+#endif
@@ -0,0 +1,99 @@
+#ifndef __PLASP__SAS__TEXT_FACT_SINK_H
+#define __PLASP__SAS__TEXT_FACT_SINK_H
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <colorlog/ColorStream.h>
+
+#include <plasp/sas/Description.h>
+#include <plasp/sas/FactSink.h>
+
+namespace plasp
+{
+namespace sas
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TextFactSink
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Writes the facts as ASP text to an output stream (the regular output of plasp)
+class TextFactSink : public FactSink
+{
+	public:
+		explicit TextFactSink(const Description &description, colorlog::ColorStream &outputStream);
+
+		void beginSection(Section section) override;
+
+		void requiresFeature(Feature feature) override;
+
+		void variable(std::size_t variableID) override;
+		void contains(const AssignedVariable &fact) override;
+
+		void action(const Operator &operator_) override;
+		void precondition(const Operator &operator_, const AssignedVariable &fact) override;
+		void postcondition(const Operator &operator_, std::size_t effectID, const AssignedVariable &fact) override;
+		void effectCondition(std::size_t effectID, const AssignedVariable &fact) override;
+		void costs(const Operator &operator_) override;
+
+		void mutexGroup(std::size_t mutexGroupID) override;
+		void mutexGroupContains(std::size_t mutexGroupID, const AssignedVariable &fact) override;
+		void axiomRule(std::size_t axiomRuleID) override;
+		void axiomRulePrecondition(std::size_t axiomRuleID, const AssignedVariable &fact) override;
+		void axiomRulePostcondition(std::size_t axiomRuleID, const AssignedVariable &fact) override;
+
+		void initialState(const AssignedVariable &fact) override;
+		void goal(const AssignedVariable &fact) override;
+
+		bool supportsChunks() const override;
+		std::unique_ptr<FactSink> makeChunkSink() override;
+		void appendChunk(FactSink &chunkSink) override;
+
+	private:
+		// Variable and value arguments of all facts, formatted once for the output stream, which the
+		// translation of each condition and effect then only needs to copy
+		struct RenderedFacts
+		{
+			// Facts are numbered consecutively by variable and value
+			std::vector<std::size_t> factIDOffsets;
+			// Rendered arguments of all facts, delimited by the offsets indexed by fact ID
+			std::string text;
+			std::vector<std::size_t> textOffsets;
+		};
+
+		// Output of chunk sinks, rendered into a string
+		struct ChunkOutput
+		{
+			explicit ChunkOutput(const colorlog::ColorStream &outputStream);
+
+			std::ostringstream stringStream;
+			colorlog::ColorStream stream;
+		};
+
+		explicit TextFactSink(const Description &description, std::unique_ptr<ChunkOutput> &&chunkOutput,
+			std::shared_ptr<const RenderedFacts> renderedFacts);
+
+		// Renders the facts with the colors and symbol table of the output stream at that time
+		void renderFacts();
+		// Writes the variable and value as the last two arguments of a fact
+		void writeFact(const AssignedVariable &fact);
+
+		const Description &m_description;
+		// Declared before the output stream, which refers to it in chunk sinks
+		std::unique_ptr<ChunkOutput> m_chunkOutput;
+		colorlog::ColorStream &m_outputStream;
+		std::shared_ptr<const RenderedFacts> m_renderedFacts;
+		bool m_isFirstSection;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+
+#endif
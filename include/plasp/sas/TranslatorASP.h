@@ -2,10 +2,19 @@
 #define __PLASP__SAS__TRANSLATOR_ASP_H
 
 #include <iosfwd>
+#include <memory>
+#include <string>
+#include <vector>
 
 #include <colorlog/ColorStream.h>
+#include <colorlog/SymbolTable.h>
+
+#include <plasp/Statistics.h>
 
 #include <plasp/sas/Description.h>
+#include <plasp/sas/FactSink.h>
+#include <plasp/sas/Relevance.h>
+#include <plasp/sas/TextFactSink.h>
 
 namespace plasp
 {
@@ -18,24 +27,59 @@ namespace sas
 //
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+// Translates a SAS description to facts, which are written as text to an output stream or passed
+// to a fact sink
 class TranslatorASP
 {
 	public:
 		explicit TranslatorASP(const Description &description, colorlog::ColorStream &outputStream);
+		explicit TranslatorASP(const Description &description, FactSink &sink);
+
+		// Operators and initial state facts are translated in parallel if more than one thread is used
+		// (0: one thread per CPU core) and the sink supports chunks; the output does not depend on the
+		// number of threads
+		void setNumberOfThreads(size_t numberOfThreads);
+
+		// Adds all names used in the output to the symbol table (for integer symbol ID output)
+		void collectSymbols(colorlog::SymbolTable &symbolTable) const;
+		// Counts the translated actions and derived predicates (axiom rules)
+		void collectStatistics(Statistics &statistics) const;
+
+		// Omits operators, variables, and values that are irrelevant for reaching the goal
+		void prune(PruningMode pruningMode);
 
 		void translate() const;
 
 	private:
-		void translateRequirements() const;
+		// The streaming translator reuses the translation of the individual sections
+		friend class StreamingTranslatorASP;
+
+		void translateRequirements(bool usesActionCosts, bool usesAxiomRules, bool usesConditionalEffects) const;
 		void translateInitialState() const;
 		void translateGoal() const;
 		void translateVariables() const;
 		void translateActions() const;
+		void translateOperator(FactSink &sink, const Operator &operator_, size_t &currentEffectID) const;
 		void translateMutexes() const;
 		void translateAxiomRules() const;
+		void translateAxiomRule(const AxiomRule &axiomRule, size_t axiomRuleID) const;
+		// Calls translateElement(sink, index) for the elements 0, …, numberOfElements - 1, using chunk
+		// sinks on multiple threads if supported
+		template<class TranslateElement>
+		void translateInParallel(size_t numberOfElements, TranslateElement translateElement) const;
+
+		template<class Element>
+		bool isRelevant(const Element &element) const
+		{
+			return !m_relevance || m_relevance->isRelevant(element);
+		}
 
 		const Description &m_description;
-		colorlog::ColorStream &m_outputStream;
+		// Text output, if the translator is constructed with an output stream
+		std::unique_ptr<TextFactSink> m_textSink;
+		FactSink &m_sink;
+		size_t m_numberOfThreads;
+		std::unique_ptr<Relevance> m_relevance;
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,47 @@
+#ifndef __PLASP__SAS__TRANSLATOR_ASPIF_H
+#define __PLASP__SAS__TRANSLATOR_ASPIF_H
+
+#include <colorlog/ColorStream.h>
+
+#include <plasp/Statistics.h>
+
+#include <plasp/sas/Description.h>
+
+namespace plasp
+{
+namespace sas
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TranslatorAspif
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Writes the ground program of encodings/sequential-horizon.lp for a SAS description in clingo’s
+// aspif format, which can be solved by clasp directly, without grounding the translated facts
+class TranslatorAspif
+{
+	public:
+		explicit TranslatorAspif(const Description &description, colorlog::ColorStream &outputStream);
+
+		// Number of time steps (the horizon constant of the encoding)
+		void setHorizon(size_t horizon);
+
+		// Counts the translated actions
+		void collectStatistics(Statistics &statistics) const;
+
+		void translate() const;
+
+	private:
+		const Description &m_description;
+		colorlog::ColorStream &m_outputStream;
+		size_t m_horizon;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+
+#endif
@@ -2,13 +2,16 @@
 #define __PLASP__SAS__VALUE_H
 
 #include <iosfwd>
-#include <string>
+#include <string_view>
 #include <vector>
 
 #include <tokenize/Tokenizer.h>
 
 #include <colorlog/ColorStream.h>
 
+#include <plasp/sas/Binary.h>
+#include <plasp/sas/StringPool.h>
+
 namespace plasp
 {
 namespace sas
@@ -40,26 +43,33 @@ struct Value
 		static const Value Any;
 		static const Value None;
 
-		static Value fromSAS(tokenize::Tokenizer<> &tokenizer);
-		static const Value &referenceFromSAS(tokenize::Tokenizer<> &tokenizer, const Variable &variable);
+		// Index by which references to Value::Any are stored
+		static constexpr int AnyID = -1;
+
+		static Value fromSAS(tokenize::Tokenizer<> &tokenizer, StringPool &names);
+		static Value fromBinary(BinaryReader &reader);
+		// Returns the index of the referenced value of the variable (or AnyID)
+		static int referenceFromSAS(tokenize::Tokenizer<> &tokenizer, const Variable &variable);
 
 	public:
 		Value negated() const;
 
 		void printAsSAS(colorlog::ColorStream &stream) const;
 		void printAsASPPredicate(colorlog::ColorStream &stream) const;
+		void writeBinary(BinaryWriter &writer) const;
 
 		Sign sign() const;
-		const std::string &name() const;
+		std::string_view name() const;
 
 	private:
-		static const Value reserved(const std::string &name);
+		static const Value reserved(const char *name);
 
 	private:
 		Value();
 
+		// Points into the string pool or the mapped binary file of the description
+		std::string_view m_name;
 		Sign m_sign;
-		std::string m_name;
 		bool m_hasArguments;
 };
 
@@ -2,13 +2,15 @@
 #define __PLASP__SAS__VARIABLE_H
 
 #include <iosfwd>
-#include <string>
+#include <string_view>
 #include <vector>
 
 #include <tokenize/Tokenizer.h>
 
 #include <colorlog/ColorStream.h>
 
+#include <plasp/sas/Binary.h>
+#include <plasp/sas/StringPool.h>
 #include <plasp/sas/Value.h>
 
 namespace plasp
@@ -30,20 +32,24 @@ using Variables = std::vector<Variable>;
 class Variable
 {
 	public:
-		static Variable fromSAS(tokenize::Tokenizer<> &tokenizer);
-		static const Variable &referenceFromSAS(tokenize::Tokenizer<> &tokenizer, const Variables &variables);
+		static Variable fromSAS(tokenize::Tokenizer<> &tokenizer, StringPool &names);
+		static Variable fromBinary(BinaryReader &reader);
+		// Returns the index of the referenced variable
+		static size_t referenceFromSAS(tokenize::Tokenizer<> &tokenizer, const Variables &variables);
 
 	public:
 		void printNameAsASPPredicate(colorlog::ColorStream &outputStream) const;
+		void writeBinary(BinaryWriter &writer) const;
 
-		const std::string &name() const;
+		std::string_view name() const;
 		int axiomLayer() const;
 		const Values &values() const;
 
 	private:
 		Variable();
 
-		std::string m_name;
+		// Points into the string pool or the mapped binary file of the description
+		std::string_view m_name;
 		int m_axiomLayer;
 		Values m_values;
 };
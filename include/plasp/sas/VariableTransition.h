@@ -30,16 +30,17 @@ class VariableTransition
 		static VariableTransition fromSAS(tokenize::Tokenizer<> &tokenizer, const Variables &variables);
 
 	public:
-		const Variable &variable() const;
-		const Value &valueBefore() const;
-		const Value &valueAfter() const;
+		size_t variableID() const;
+		// Value::AnyID if the transition applies to any value
+		int valueBeforeID() const;
+		int valueAfterID() const;
 
 	private:
 		VariableTransition();
 
-		const Variable *m_variable;
-		const Value *m_valueBefore;
-		const Value *m_valueAfter;
+		size_t m_variableID;
+		int m_valueBeforeID;
+		int m_valueAfterID;
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
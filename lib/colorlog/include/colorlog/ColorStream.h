@@ -2,8 +2,12 @@
 #define __COLOR_LOG__COLOR_STREAM_H
 
 #include <iostream>
+#include <memory>
 #include <unistd.h>
 
+#include <colorlog/OutputBuffer.h>
+#include <colorlog/SymbolTable.h>
+
 namespace colorlog
 {
 
@@ -26,41 +30,84 @@ class ColorStream
 	private:
 		using CharacterType = std::ostream::char_type;
 		using TraitsType = std::ostream::traits_type;
+		using StreamManipulator = std::basic_ostream<CharacterType, TraitsType> &(*)(std::basic_ostream<CharacterType, TraitsType> &);
 
 	public:
 		ColorStream(std::ostream &stream)
 		:	m_stream{stream},
 			m_colorPolicy{ColorPolicy::Auto}
 		{
+			updateColorSupport();
 		}
 
 		void setColorPolicy(ColorPolicy colorPolicy)
 		{
 			m_colorPolicy = colorPolicy;
+			updateColorSupport();
 		}
 
-		bool supportsColor() const
+		// Route all output through a large buffer with hand-rolled number formatting, which is
+		// considerably faster than std::ostream for big outputs; buffered output is never colored,
+		// and copies of this stream share the same buffer
+		void enableOutputBuffer(std::size_t capacity = OutputBuffer::DefaultCapacity)
 		{
-			if (m_colorPolicy == ColorPolicy::Never)
-				return false;
+			if (!m_outputBuffer)
+				m_outputBuffer = std::make_shared<OutputBuffer>(m_stream, capacity);
 
-			if (m_colorPolicy == ColorPolicy::Always)
-				return true;
+			updateColorSupport();
+		}
 
-			if (&m_stream == &std::cout)
-				return isatty(fileno(stdout));
+		// Additionally write full buffers on a separate thread, so that producing the output overlaps
+		// with writing it, for instance, to a slow pipe
+		void enableAsynchronousOutput(std::size_t numberOfBuffers = OutputBuffer::DefaultNumberOfBuffers)
+		{
+			enableOutputBuffer();
+			m_outputBuffer->enableAsynchronousWriting(numberOfBuffers);
+		}
 
-			if (&m_stream == &std::cerr)
-				return isatty(fileno(stderr));
+		bool isBuffered() const
+		{
+			return static_cast<bool>(m_outputBuffer);
+		}
 
-			return false;
+		void flush()
+		{
+			if (m_outputBuffer)
+				m_outputBuffer->flush();
+
+			m_stream.flush();
+		}
+
+		// Decided only when the color policy or buffering changes, so that formatted output does not
+		// query the terminal for every token
+		bool supportsColor() const
+		{
+			return m_supportsColor;
+		}
+
+		// Strings known to the symbol table are printed as their integer IDs, which must be
+		// complete before output starts, as the table is shared with copies of this stream
+		void setSymbolTable(std::shared_ptr<const SymbolTable> symbolTable)
+		{
+			m_symbolTable = std::move(symbolTable);
 		}
 
+		const std::shared_ptr<const SymbolTable> &symbolTable() const
+		{
+			return m_symbolTable;
+		}
+
+		// Pending buffered output is written first to keep the output in order
 		std::ostream &stream()
 		{
+			if (m_outputBuffer)
+				m_outputBuffer->flush();
+
 			return m_stream;
 		}
 
+		inline ColorStream &write(const char *data, std::size_t size);
+
 		inline ColorStream &operator<<(short value);
 		inline ColorStream &operator<<(unsigned short value);
 		inline ColorStream &operator<<(int value);
@@ -80,21 +127,69 @@ class ColorStream
 		inline ColorStream &operator<<(std::basic_streambuf<CharacterType, TraitsType> *sb);
 		inline ColorStream &operator<<(std::ios_base &(*func)(std::ios_base &));
 		inline ColorStream &operator<<(std::basic_ios<CharacterType, TraitsType> &(*func)(std::basic_ios<CharacterType, TraitsType> &));
-		inline ColorStream &operator<<(std::basic_ostream<CharacterType, TraitsType> &(*func)(std::basic_ostream<CharacterType, TraitsType> &));
+		inline ColorStream &operator<<(StreamManipulator func);
 
 		inline ColorStream &operator<<(char value);
 		inline ColorStream &operator<<(signed char value);
 		inline ColorStream &operator<<(unsigned char value);
 
 	private:
+		void updateColorSupport()
+		{
+			m_supportsColor = isColorSupported();
+		}
+
+		bool isColorSupported() const
+		{
+			if (m_outputBuffer)
+				return false;
+
+			if (m_colorPolicy == ColorPolicy::Never)
+				return false;
+
+			if (m_colorPolicy == ColorPolicy::Always)
+				return true;
+
+			if (&m_stream == &std::cout)
+				return isatty(fileno(stdout));
+
+			if (&m_stream == &std::cerr)
+				return isatty(fileno(stderr));
+
+			return false;
+		}
+
 		std::ostream &m_stream;
 		ColorPolicy m_colorPolicy;
+		bool m_supportsColor;
+		std::shared_ptr<OutputBuffer> m_outputBuffer;
+		std::shared_ptr<const SymbolTable> m_symbolTable;
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+ColorStream &ColorStream::write(const char *data, std::size_t size)
+{
+	if (m_outputBuffer)
+	{
+		m_outputBuffer->write(data, size);
+		return *this;
+	}
+
+	m_stream.write(data, static_cast<std::streamsize>(size));
+	return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 ColorStream &ColorStream::operator<<(short value)
 {
+	if (m_outputBuffer)
+	{
+		m_outputBuffer->writeInteger(value);
+		return *this;
+	}
+
 	m_stream << value;
 	return *this;
 }
@@ -103,6 +198,12 @@ ColorStream &ColorStream::operator<<(short value)
 
 ColorStream &ColorStream::operator<<(unsigned short value)
 {
+	if (m_outputBuffer)
+	{
+		m_outputBuffer->writeInteger(value);
+		return *this;
+	}
+
 	m_stream << value;
 	return *this;
 }
@@ -111,6 +212,12 @@ ColorStream &ColorStream::operator<<(unsigned short value)
 
 ColorStream &ColorStream::operator<<(int value)
 {
+	if (m_outputBuffer)
+	{
+		m_outputBuffer->writeInteger(value);
+		return *this;
+	}
+
 	m_stream << value;
 	return *this;
 }
@@ -119,6 +226,12 @@ ColorStream &ColorStream::operator<<(int value)
 
 ColorStream &ColorStream::operator<<(unsigned int value)
 {
+	if (m_outputBuffer)
+	{
+		m_outputBuffer->writeInteger(value);
+		return *this;
+	}
+
 	m_stream << value;
 	return *this;
 }
@@ -127,6 +240,12 @@ ColorStream &ColorStream::operator<<(unsigned int value)
 
 ColorStream &ColorStream::operator<<(long value)
 {
+	if (m_outputBuffer)
+	{
+		m_outputBuffer->writeInteger(value);
+		return *this;
+	}
+
 	m_stream << value;
 	return *this;
 }
@@ -135,6 +254,12 @@ ColorStream &ColorStream::operator<<(long value)
 
 ColorStream &ColorStream::operator<<(unsigned long value)
 {
+	if (m_outputBuffer)
+	{
+		m_outputBuffer->writeInteger(value);
+		return *this;
+	}
+
 	m_stream << value;
 	return *this;
 }
@@ -143,6 +268,12 @@ ColorStream &ColorStream::operator<<(unsigned long value)
 
 ColorStream &ColorStream::operator<<(long long value)
 {
+	if (m_outputBuffer)
+	{
+		m_outputBuffer->writeInteger(value);
+		return *this;
+	}
+
 	m_stream << value;
 	return *this;
 }
@@ -151,6 +282,12 @@ ColorStream &ColorStream::operator<<(long long value)
 
 ColorStream &ColorStream::operator<<(unsigned long long value)
 {
+	if (m_outputBuffer)
+	{
+		m_outputBuffer->writeInteger(value);
+		return *this;
+	}
+
 	m_stream << value;
 	return *this;
 }
@@ -159,7 +296,7 @@ ColorStream &ColorStream::operator<<(unsigned long long value)
 
 ColorStream &ColorStream::operator<<(float value)
 {
-	m_stream << value;
+	stream() << value;
 	return *this;
 }
 
@@ -167,7 +304,7 @@ ColorStream &ColorStream::operator<<(float value)
 
 ColorStream &ColorStream::operator<<(double value)
 {
-	m_stream << value;
+	stream() << value;
 	return *this;
 }
 
@@ -175,7 +312,7 @@ ColorStream &ColorStream::operator<<(double value)
 
 ColorStream &ColorStream::operator<<(long double value)
 {
-	m_stream << value;
+	stream() << value;
 	return *this;
 }
 
@@ -183,7 +320,7 @@ ColorStream &ColorStream::operator<<(long double value)
 
 ColorStream &ColorStream::operator<<(bool value)
 {
-	m_stream << value;
+	stream() << value;
 	return *this;
 }
 
@@ -191,7 +328,7 @@ ColorStream &ColorStream::operator<<(bool value)
 
 ColorStream &ColorStream::operator<<(const void *value)
 {
-	m_stream << value;
+	stream() << value;
 	return *this;
 }
 
@@ -199,6 +336,12 @@ ColorStream &ColorStream::operator<<(const void *value)
 
 ColorStream &ColorStream::operator<<(const char *value)
 {
+	if (m_outputBuffer)
+	{
+		m_outputBuffer->write(value);
+		return *this;
+	}
+
 	m_stream << value;
 	return *this;
 }
@@ -207,6 +350,12 @@ ColorStream &ColorStream::operator<<(const char *value)
 
 ColorStream &ColorStream::operator<<(const signed char *value)
 {
+	if (m_outputBuffer)
+	{
+		m_outputBuffer->write(reinterpret_cast<const char *>(value));
+		return *this;
+	}
+
 	m_stream << value;
 	return *this;
 }
@@ -215,6 +364,12 @@ ColorStream &ColorStream::operator<<(const signed char *value)
 
 ColorStream &ColorStream::operator<<(const unsigned char *value)
 {
+	if (m_outputBuffer)
+	{
+		m_outputBuffer->write(reinterpret_cast<const char *>(value));
+		return *this;
+	}
+
 	m_stream << value;
 	return *this;
 }
@@ -223,7 +378,7 @@ ColorStream &ColorStream::operator<<(const unsigned char *value)
 
 ColorStream &ColorStream::operator<<(std::basic_streambuf<CharacterType, TraitsType>* sb)
 {
-	m_stream << sb;
+	stream() << sb;
 	return *this;
 }
 
@@ -231,7 +386,7 @@ ColorStream &ColorStream::operator<<(std::basic_streambuf<CharacterType, TraitsT
 
 ColorStream &ColorStream::operator<<(std::ios_base &(*func)(std::ios_base &))
 {
-	m_stream << func;
+	stream() << func;
 	return *this;
 }
 
@@ -239,15 +394,31 @@ ColorStream &ColorStream::operator<<(std::ios_base &(*func)(std::ios_base &))
 
 ColorStream &ColorStream::operator<<(std::basic_ios<CharacterType, TraitsType> &(*func)(std::basic_ios<CharacterType, TraitsType> &))
 {
-	m_stream << func;
+	stream() << func;
 	return *this;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-ColorStream &ColorStream::operator<<(std::basic_ostream<CharacterType, TraitsType> &(*func)(std::basic_ostream<CharacterType, TraitsType> &))
+ColorStream &ColorStream::operator<<(StreamManipulator func)
 {
-	m_stream << func;
+	if (m_outputBuffer)
+	{
+		// Buffered output is only flushed when the buffer is full, even if std::endl is used
+		if (func == static_cast<StreamManipulator>(std::endl))
+		{
+			m_outputBuffer->put('\n');
+			return *this;
+		}
+
+		if (func == static_cast<StreamManipulator>(std::flush))
+		{
+			flush();
+			return *this;
+		}
+	}
+
+	stream() << func;
 	return *this;
 }
 
@@ -256,7 +427,7 @@ ColorStream &ColorStream::operator<<(std::basic_ostream<CharacterType, TraitsTyp
 template<class CharacterType, class Traits, class Allocator>
 inline ColorStream &operator<<(ColorStream &colorStream, const std::basic_string<CharacterType, Traits, Allocator> &string)
 {
-	colorStream.stream() << string;
+	colorStream.write(string.data(), string.size());
 	return colorStream;
 }
 
@@ -264,6 +435,12 @@ inline ColorStream &operator<<(ColorStream &colorStream, const std::basic_string
 
 ColorStream &ColorStream::operator<<(char value)
 {
+	if (m_outputBuffer)
+	{
+		m_outputBuffer->put(value);
+		return *this;
+	}
+
 	m_stream << value;
 	return *this;
 }
@@ -272,6 +449,12 @@ ColorStream &ColorStream::operator<<(char value)
 
 ColorStream &ColorStream::operator<<(signed char value)
 {
+	if (m_outputBuffer)
+	{
+		m_outputBuffer->put(static_cast<char>(value));
+		return *this;
+	}
+
 	m_stream << value;
 	return *this;
 }
@@ -280,6 +463,12 @@ ColorStream &ColorStream::operator<<(signed char value)
 
 ColorStream &ColorStream::operator<<(unsigned char value)
 {
+	if (m_outputBuffer)
+	{
+		m_outputBuffer->put(static_cast<char>(value));
+		return *this;
+	}
+
 	m_stream << value;
 	return *this;
 }
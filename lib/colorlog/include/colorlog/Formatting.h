@@ -1,6 +1,9 @@
 #ifndef __COLOR_LOG__FORMATTING_H
 #define __COLOR_LOG__FORMATTING_H
 
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
 #include <iostream>
 
 #include <colorlog/ColorStream.h>
@@ -53,15 +56,61 @@ struct Format
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+// Escape sequences are assembled without going through std::ostream, so that they can be computed
+// at compile time for the fixed formats of the wrappers below and emitted with a single write
+struct EscapeSequence
+{
+	// Long enough for "\033[" followed by two 2-digit codes, a separator, and the "m" suffix
+	char data[12] = {};
+	std::size_t size = 0;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail
+{
+
+constexpr void appendCode(EscapeSequence &escapeSequence, int code)
+{
+	if (code >= 10)
+		escapeSequence.data[escapeSequence.size++] = static_cast<char>('0' + code / 10);
+
+	escapeSequence.data[escapeSequence.size++] = static_cast<char>('0' + code % 10);
+}
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+constexpr EscapeSequence makeEscapeSequence(const Format &format)
+{
+	EscapeSequence escapeSequence;
+
+	escapeSequence.data[escapeSequence.size++] = '\033';
+	escapeSequence.data[escapeSequence.size++] = '[';
+	detail::appendCode(escapeSequence, static_cast<int>(format.fontWeight));
+	escapeSequence.data[escapeSequence.size++] = ';';
+	detail::appendCode(escapeSequence, static_cast<int>(format.color));
+	escapeSequence.data[escapeSequence.size++] = 'm';
+
+	return escapeSequence;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+constexpr const char ResetSequence[] = "\033[0m";
+constexpr std::size_t ResetSequenceSize = sizeof(ResetSequence) - 1;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 inline ColorStream &operator<<(ColorStream &stream, const Format &format)
 {
 	if (!stream.supportsColor())
 		return stream;
 
-	const auto fontWeightCode = static_cast<int>(format.fontWeight);
-	const auto colorCode = static_cast<int>(format.color);
+	const auto escapeSequence = makeEscapeSequence(format);
 
-	return (stream << "\033[" << fontWeightCode << ";" << colorCode << "m");
+	return stream.write(escapeSequence.data, escapeSequence.size);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -77,7 +126,83 @@ inline ColorStream &operator<<(ColorStream &stream, const ResetFormat &)
 	if (!stream.supportsColor())
 		return stream;
 
-	return (stream << "\033[0m");
+	return stream.write(ResetSequence, ResetSequenceSize);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail
+{
+
+// Without color, formatted values are plain appends; otherwise, the escape sequence for the format
+// is a compile-time constant
+template<Color color, FontWeight fontWeight, class T>
+inline ColorStream &writeFormatted(ColorStream &stream, const T &value)
+{
+	if (!stream.supportsColor())
+		return (stream << value);
+
+	static constexpr auto escapeSequence = makeEscapeSequence({color, fontWeight});
+
+	stream.write(escapeSequence.data, escapeSequence.size);
+	stream << value;
+
+	return stream.write(ResetSequence, ResetSequenceSize);
+}
+
+// Text is written along with the escape sequences (and the optional quotation marks) in a single
+// write if it is short enough to be assembled on the stack, which names and strings usually are
+inline ColorStream &writeFormattedText(ColorStream &stream, const EscapeSequence &escapeSequence,
+	const char *text, char quotationMark = '\0')
+{
+	constexpr std::size_t MaximumSize = 256;
+
+	const auto textSize = std::strlen(text);
+	const std::size_t quotationMarksSize = (quotationMark != '\0') ? 2 : 0;
+	const auto size = escapeSequence.size + quotationMarksSize + textSize + ResetSequenceSize;
+
+	if (size > MaximumSize)
+	{
+		stream.write(escapeSequence.data, escapeSequence.size);
+
+		if (quotationMark != '\0')
+			stream << quotationMark;
+
+		stream.write(text, textSize);
+
+		if (quotationMark != '\0')
+			stream << quotationMark;
+
+		return stream.write(ResetSequence, ResetSequenceSize);
+	}
+
+	char buffer[MaximumSize];
+	auto *position = std::copy_n(escapeSequence.data, escapeSequence.size, buffer);
+
+	if (quotationMark != '\0')
+		*position++ = quotationMark;
+
+	position = std::copy_n(text, textSize, position);
+
+	if (quotationMark != '\0')
+		*position++ = quotationMark;
+
+	std::copy_n(ResetSequence, ResetSequenceSize, position);
+
+	return stream.write(buffer, size);
+}
+
+template<Color color, FontWeight fontWeight>
+inline ColorStream &writeFormatted(ColorStream &stream, const char *text)
+{
+	if (!stream.supportsColor())
+		return (stream << text);
+
+	static constexpr auto escapeSequence = makeEscapeSequence({color, fontWeight});
+
+	return writeFormattedText(stream, escapeSequence, text);
+}
+
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -96,10 +221,7 @@ struct Function
 
 inline ColorStream &operator<<(ColorStream &stream, const Function &function)
 {
-	return (stream
-		<< Format({Color::White, FontWeight::Normal})
-		<< function.name
-		<< ResetFormat());
+	return detail::writeFormatted<Color::White, FontWeight::Normal>(stream, function.name);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -118,10 +240,7 @@ struct Keyword
 
 inline ColorStream &operator<<(ColorStream &stream, const Keyword &keyword)
 {
-	return (stream
-		<< Format({Color::Blue, FontWeight::Normal})
-		<< keyword.name
-		<< ResetFormat());
+	return detail::writeFormatted<Color::Blue, FontWeight::Normal>(stream, keyword.name);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -161,10 +280,7 @@ struct Number
 template<typename T>
 inline ColorStream &operator<<(ColorStream &stream, const Number<T> &number)
 {
-	return (stream
-		<< Format({Color::Yellow, FontWeight::Normal})
-		<< number.value
-		<< ResetFormat());
+	return detail::writeFormatted<Color::Yellow, FontWeight::Normal>(stream, number.value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -183,10 +299,7 @@ struct Variable
 
 inline ColorStream &operator<<(ColorStream &stream, const Variable &variable)
 {
-	return (stream
-		<< Format({Color::Green, FontWeight::Bold})
-		<< variable.name
-		<< ResetFormat());
+	return detail::writeFormatted<Color::Green, FontWeight::Bold>(stream, variable.name);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -205,10 +318,20 @@ struct String
 
 inline ColorStream &operator<<(ColorStream &stream, const String &string)
 {
-	return (stream
-		<< Format({Color::Green, FontWeight::Normal})
-		<< "\"" << string.content << "\""
-		<< ResetFormat());
+	if (stream.symbolTable())
+	{
+		const auto symbolID = stream.symbolTable()->find(string.content);
+
+		if (symbolID != SymbolTable::UnknownSymbol)
+			return (stream << Number<std::size_t>(symbolID));
+	}
+
+	if (!stream.supportsColor())
+		return (stream << '"' << string.content << '"');
+
+	static constexpr auto escapeSequence = makeEscapeSequence({Color::Green, FontWeight::Normal});
+
+	return detail::writeFormattedText(stream, escapeSequence, string.content, '"');
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -227,10 +350,7 @@ struct Boolean
 
 inline ColorStream &operator<<(ColorStream &stream, const Boolean &boolean)
 {
-	return (stream
-		<< Format({Color::Red, FontWeight::Normal})
-		<< boolean.value
-		<< ResetFormat());
+	return detail::writeFormatted<Color::Red, FontWeight::Normal>(stream, boolean.value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -249,10 +369,7 @@ struct Reserved
 
 inline ColorStream &operator<<(ColorStream &stream, const Reserved &reserved)
 {
-	return (stream
-		<< Format({Color::White, FontWeight::Normal})
-		<< reserved.name
-		<< ResetFormat());
+	return detail::writeFormatted<Color::White, FontWeight::Normal>(stream, reserved.name);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,282 @@
+#ifndef __COLOR_LOG__OUTPUT_BUFFER_H
+#define __COLOR_LOG__OUTPUT_BUFFER_H
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace colorlog
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// OutputBuffer
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Collects uncolored output in one large contiguous buffer and hands it to the underlying stream
+// buffer in big chunks, bypassing the per-call overhead of std::ostream. Optionally, full buffers are
+// written by a separate thread while the next buffer is filled
+class OutputBuffer
+{
+	public:
+		static constexpr std::size_t DefaultCapacity = 4 * 1024 * 1024;
+		static constexpr std::size_t DefaultNumberOfBuffers = 3;
+
+		explicit OutputBuffer(std::ostream &stream, std::size_t capacity = DefaultCapacity)
+		:	m_stream{stream},
+			m_size{0}
+		{
+			m_buffer.resize(capacity < MinimumCapacity ? MinimumCapacity : capacity);
+		}
+
+		~OutputBuffer()
+		{
+			flush();
+		}
+
+		// Hands full buffers to a writer thread instead of writing them right away, cycling through
+		// the given number of buffers (at least two). The underlying stream must not be used by others
+		// until the next flush
+		void enableAsynchronousWriting(std::size_t numberOfBuffers = DefaultNumberOfBuffers)
+		{
+			if (m_writer)
+				return;
+
+			writeBuffer();
+			m_writer = std::make_unique<Writer>(m_stream, m_buffer.size(), std::max(numberOfBuffers, static_cast<std::size_t>(2)));
+		}
+
+		OutputBuffer(const OutputBuffer &other) = delete;
+		OutputBuffer &operator=(const OutputBuffer &other) = delete;
+		OutputBuffer(OutputBuffer &&other) = delete;
+		OutputBuffer &operator=(OutputBuffer &&other) = delete;
+
+		void put(char character)
+		{
+			if (m_size == m_buffer.size())
+				writeBuffer();
+
+			m_buffer[m_size++] = character;
+		}
+
+		void write(const char *data, std::size_t size)
+		{
+			if (size > m_buffer.size() - m_size)
+			{
+				// Pass huge chunks through directly instead of splitting them up
+				if (size >= m_buffer.size())
+				{
+					flush();
+					writeThrough(data, size);
+					return;
+				}
+
+				writeBuffer();
+			}
+
+			std::memcpy(m_buffer.data() + m_size, data, size);
+			m_size += size;
+		}
+
+		void write(const char *string)
+		{
+			write(string, std::strlen(string));
+		}
+
+		template<class T>
+		void writeInteger(T value)
+		{
+			static_assert(std::is_integral<T>::value, "only integral types can be formatted");
+
+			using UnsignedType = typename std::make_unsigned<T>::type;
+
+			// Enough for the decimal digits of any 64-bit value plus sign
+			char digits[24];
+			char *end = digits + sizeof(digits);
+			char *begin = end;
+
+			const bool isNegative = (value < 0);
+			// Negate in the unsigned domain to support the minimum value of signed types
+			auto magnitude = isNegative ? UnsignedType(0) - static_cast<UnsignedType>(value) : static_cast<UnsignedType>(value);
+
+			do
+			{
+				*--begin = static_cast<char>('0' + magnitude % 10);
+				magnitude /= 10;
+			}
+			while (magnitude != 0);
+
+			if (isNegative)
+				*--begin = '-';
+
+			write(begin, static_cast<std::size_t>(end - begin));
+		}
+
+		// Writes all buffered output, waiting for the writer thread if needed
+		void flush()
+		{
+			writeBuffer();
+
+			if (m_writer && !m_writer->wait())
+				m_stream.setstate(std::ios::badbit);
+		}
+
+		std::ostream &stream()
+		{
+			return m_stream;
+		}
+
+	private:
+		static constexpr std::size_t MinimumCapacity = 64;
+
+		// Writes full buffers on a separate thread and returns them for reuse once written
+		class Writer
+		{
+			public:
+				Writer(std::ostream &stream, std::size_t capacity, std::size_t numberOfBuffers)
+				:	m_stream{stream},
+					m_isWriting{false},
+					m_hasFailed{false},
+					m_isStopping{false}
+				{
+					// One buffer is filled by the output buffer itself
+					m_freeBuffers.resize(numberOfBuffers - 1, std::vector<char>(capacity));
+					m_thread = std::thread([&](){run();});
+				}
+
+				~Writer()
+				{
+					{
+						std::lock_guard<std::mutex> lock(m_mutex);
+						m_isStopping = true;
+					}
+
+					m_changed.notify_all();
+					m_thread.join();
+				}
+
+				Writer(const Writer &other) = delete;
+				Writer &operator=(const Writer &other) = delete;
+
+				// Queues the first size bytes of the buffer and replaces it with a free one, blocking
+				// until a buffer is free
+				void submit(std::vector<char> &buffer, std::size_t size)
+				{
+					std::unique_lock<std::mutex> lock(m_mutex);
+					m_changed.wait(lock, [&](){return !m_freeBuffers.empty();});
+
+					m_pendingBuffers.emplace_back(std::move(buffer), size);
+					buffer = std::move(m_freeBuffers.back());
+					m_freeBuffers.pop_back();
+					lock.unlock();
+
+					m_changed.notify_all();
+				}
+
+				// Waits until all queued buffers are written and returns whether all writes succeeded
+				bool wait()
+				{
+					std::unique_lock<std::mutex> lock(m_mutex);
+					m_changed.wait(lock, [&](){return m_pendingBuffers.empty() && !m_isWriting;});
+
+					return !m_hasFailed;
+				}
+
+			private:
+				void run()
+				{
+					std::unique_lock<std::mutex> lock(m_mutex);
+
+					while (true)
+					{
+						m_changed.wait(lock, [&](){return !m_pendingBuffers.empty() || m_isStopping;});
+
+						if (m_pendingBuffers.empty())
+							return;
+
+						auto pendingBuffer = std::move(m_pendingBuffers.front());
+						m_pendingBuffers.pop_front();
+						m_isWriting = true;
+
+						// After a failed write, the remaining output is discarded
+						const auto isWritten = m_hasFailed;
+						lock.unlock();
+
+						bool hasFailed = false;
+
+						if (!isWritten)
+						{
+							try
+							{
+								const auto size = static_cast<std::streamsize>(pendingBuffer.second);
+								hasFailed = (m_stream.rdbuf()->sputn(pendingBuffer.first.data(), size) != size);
+							}
+							catch (...)
+							{
+								hasFailed = true;
+							}
+						}
+
+						lock.lock();
+						m_hasFailed |= hasFailed;
+						m_isWriting = false;
+						m_freeBuffers.emplace_back(std::move(pendingBuffer.first));
+						m_changed.notify_all();
+					}
+				}
+
+				std::ostream &m_stream;
+
+				std::deque<std::pair<std::vector<char>, std::size_t>> m_pendingBuffers;
+				std::vector<std::vector<char>> m_freeBuffers;
+				bool m_isWriting;
+				bool m_hasFailed;
+				bool m_isStopping;
+				std::mutex m_mutex;
+				std::condition_variable m_changed;
+
+				std::thread m_thread;
+		};
+
+		// Hands the buffered output to the writer thread if enabled and writes it otherwise
+		void writeBuffer()
+		{
+			if (m_size == 0)
+				return;
+
+			if (m_writer)
+				m_writer->submit(m_buffer, m_size);
+			else
+				writeThrough(m_buffer.data(), m_size);
+
+			m_size = 0;
+		}
+
+		void writeThrough(const char *data, std::size_t size)
+		{
+			const auto written = m_stream.rdbuf()->sputn(data, static_cast<std::streamsize>(size));
+
+			if (written != static_cast<std::streamsize>(size))
+				m_stream.setstate(std::ios::badbit);
+		}
+
+		std::ostream &m_stream;
+		std::vector<char> m_buffer;
+		std::size_t m_size;
+		std::unique_ptr<Writer> m_writer;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+
+#endif
@@ -0,0 +1,70 @@
+#ifndef __COLOR_LOG__SYMBOL_TABLE_H
+#define __COLOR_LOG__SYMBOL_TABLE_H
+
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace colorlog
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// SymbolTable
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Assigns consecutive integer IDs to names, starting at 0. If a symbol table is attached to a
+// ColorStream, strings known to the table are printed as their IDs instead
+class SymbolTable
+{
+	public:
+		static constexpr std::size_t UnknownSymbol = std::numeric_limits<std::size_t>::max();
+
+		// Returns the ID of the name, which is assigned the next free ID if it is not yet known
+		std::size_t add(const std::string &name)
+		{
+			const auto result = m_ids.emplace(name, m_names.size());
+
+			if (result.second)
+				m_names.emplace_back(name);
+
+			return result.first->second;
+		}
+
+		std::size_t find(const std::string &name) const
+		{
+			const auto matchingID = m_ids.find(name);
+
+			if (matchingID == m_ids.cend())
+				return UnknownSymbol;
+
+			return matchingID->second;
+		}
+
+		const std::string &name(std::size_t id) const
+		{
+			return m_names[id];
+		}
+
+		const std::vector<std::string> &names() const
+		{
+			return m_names;
+		}
+
+		std::size_t size() const
+		{
+			return m_names.size();
+		}
+
+	private:
+		std::unordered_map<std::string, std::size_t> m_ids;
+		std::vector<std::string> m_names;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+
+#endif
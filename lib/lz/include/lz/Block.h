@@ -0,0 +1,218 @@
+#ifndef __LZ__BLOCK_H
+#define __LZ__BLOCK_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <lz/Format.h>
+
+namespace lz
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Block
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Compresses blocks greedily, looking up earlier occurrences of each 4-byte sequence in a hash table
+// that keeps only the last position per hash value
+class BlockCompressor
+{
+	public:
+		BlockCompressor()
+		:	m_hashTable(HashTableSize)
+		{
+		}
+
+		// Appends the compressed block to the output
+		void compress(const char *input, std::size_t size, std::string &output)
+		{
+			// Entries are positions plus 1, so that 0 marks empty entries
+			std::fill(m_hashTable.begin(), m_hashTable.end(), 0);
+
+			const auto *data = reinterpret_cast<const unsigned char *>(input);
+
+			// Matches are only searched where a complete 4-byte sequence can be read
+			const std::size_t searchEnd = (size < MinimumMatchLength) ? 0 : size - MinimumMatchLength + 1;
+
+			std::size_t anchor = 0;
+			std::size_t position = 0;
+
+			while (position < searchEnd)
+			{
+				const auto sequence = read(data + position);
+				auto &entry = m_hashTable[hash(sequence)];
+				const auto candidate = entry;
+				entry = static_cast<std::uint32_t>(position + 1);
+
+				if (candidate == 0 || position + 1 - candidate > MaximumMatchOffset
+					|| read(data + candidate - 1) != sequence)
+				{
+					// Skip through incompressible data faster the longer no match is found
+					position += 1 + ((position - anchor) >> SkipShift);
+					continue;
+				}
+
+				const std::size_t matchPosition = candidate - 1;
+				auto length = MinimumMatchLength;
+
+				while (position + length < size && data[matchPosition + length] == data[position + length])
+					length++;
+
+				writeSequence(output, input + anchor, position - anchor, position - matchPosition, length);
+
+				position += length;
+				anchor = position;
+
+				// Index a position within the match to find repetitions continuing after it
+				if (position - 2 < searchEnd)
+					m_hashTable[hash(read(data + position - 2))] = static_cast<std::uint32_t>(position - 1);
+			}
+
+			// The last sequence contains the remaining literals only
+			output.push_back(static_cast<char>(std::min(size - anchor, LengthMask) << 4));
+			writeLength(output, size - anchor);
+			output.append(input + anchor, size - anchor);
+		}
+
+	private:
+		static constexpr std::size_t HashBits = 16;
+		static constexpr std::size_t HashTableSize = std::size_t(1) << HashBits;
+		static constexpr std::size_t SkipShift = 6;
+
+		static std::uint32_t read(const unsigned char *data)
+		{
+			std::uint32_t value;
+			std::memcpy(&value, data, sizeof(value));
+
+			return value;
+		}
+
+		static std::size_t hash(std::uint32_t sequence)
+		{
+			return (sequence * 2654435761u) >> (32 - HashBits);
+		}
+
+		static void writeLength(std::string &output, std::size_t length)
+		{
+			if (length < LengthMask)
+				return;
+
+			length -= LengthMask;
+
+			for (; length >= 255; length -= 255)
+				output.push_back(static_cast<char>(255));
+
+			output.push_back(static_cast<char>(length));
+		}
+
+		static void writeSequence(std::string &output, const char *literals, std::size_t numberOfLiterals,
+			std::size_t offset, std::size_t matchLength)
+		{
+			const auto encodedMatchLength = matchLength - MinimumMatchLength;
+
+			output.push_back(static_cast<char>((std::min(numberOfLiterals, LengthMask) << 4)
+				| std::min(encodedMatchLength, LengthMask)));
+			writeLength(output, numberOfLiterals);
+			output.append(literals, numberOfLiterals);
+			output.push_back(static_cast<char>(offset & 0xff));
+			output.push_back(static_cast<char>(offset >> 8));
+			writeLength(output, encodedMatchLength);
+		}
+
+		std::vector<std::uint32_t> m_hashTable;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Decompresses a block into the output, which must be exactly as large as the decompressed block
+inline void decompressBlock(const char *input, std::size_t inputSize, char *output, std::size_t outputSize)
+{
+	const auto *in = reinterpret_cast<const unsigned char *>(input);
+	const auto *inEnd = in + inputSize;
+	std::size_t outputPosition = 0;
+
+	const auto malformed =
+		[]()
+		{
+			return FormatException("malformed compressed block");
+		};
+
+	const auto readLength =
+		[&](std::size_t length)
+		{
+			if (length != LengthMask)
+				return length;
+
+			while (true)
+			{
+				if (in == inEnd)
+					throw malformed();
+
+				const auto byte = *in++;
+				length += byte;
+
+				if (byte != 255)
+					return length;
+			}
+		};
+
+	while (true)
+	{
+		if (in == inEnd)
+			throw malformed();
+
+		const auto token = *in++;
+
+		const auto numberOfLiterals = readLength(token >> 4);
+
+		if (numberOfLiterals > static_cast<std::size_t>(inEnd - in) || numberOfLiterals > outputSize - outputPosition)
+			throw malformed();
+
+		std::memcpy(output + outputPosition, in, numberOfLiterals);
+		in += numberOfLiterals;
+		outputPosition += numberOfLiterals;
+
+		if (in == inEnd)
+			break;
+
+		if (inEnd - in < 2)
+			throw malformed();
+
+		const std::size_t offset = in[0] | (static_cast<std::size_t>(in[1]) << 8);
+		in += 2;
+
+		if (offset == 0 || offset > outputPosition)
+			throw malformed();
+
+		const auto matchLength = readLength(token & LengthMask) + MinimumMatchLength;
+
+		if (matchLength > outputSize - outputPosition)
+			throw malformed();
+
+		auto *match = output + outputPosition - offset;
+		auto *destination = output + outputPosition;
+
+		// Matches may overlap with the output they produce, repeating short patterns
+		if (offset >= matchLength)
+			std::memcpy(destination, match, matchLength);
+		else
+			for (std::size_t i = 0; i < matchLength; i++)
+				destination[i] = match[i];
+
+		outputPosition += matchLength;
+	}
+
+	if (outputPosition != outputSize)
+		throw FormatException("compressed block has the wrong size");
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+
+#endif
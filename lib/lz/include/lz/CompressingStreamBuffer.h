@@ -0,0 +1,136 @@
+#ifndef __LZ__COMPRESSING_STREAM_BUFFER_H
+#define __LZ__COMPRESSING_STREAM_BUFFER_H
+
+#include <algorithm>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+#include <lz/Block.h>
+#include <lz/Format.h>
+
+namespace lz
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// CompressingStreamBuffer
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Compresses everything written to it block by block and passes the compressed stream on to the
+// target stream buffer. Synchronizing the stream (for example, by flushing it) ends the current
+// block early, so that all output written so far can be decompressed
+class CompressingStreamBuffer : public std::streambuf
+{
+	public:
+		explicit CompressingStreamBuffer(std::streambuf *target, std::size_t blockSize = DefaultBlockSize)
+		:	m_target{target},
+			m_block(std::min(std::max(blockSize, static_cast<std::size_t>(1)), MaximumBlockSize)),
+			m_isFinished{false},
+			m_hasFailed{false}
+		{
+			setp(m_block.data(), m_block.data() + m_block.size());
+			writeToTarget(Magic, MagicSize);
+		}
+
+		~CompressingStreamBuffer()
+		{
+			finish();
+		}
+
+		CompressingStreamBuffer(const CompressingStreamBuffer &other) = delete;
+		CompressingStreamBuffer &operator=(const CompressingStreamBuffer &other) = delete;
+
+		// Writes the remaining output and the end of the stream, returning whether all writes
+		// succeeded
+		bool finish()
+		{
+			if (m_isFinished)
+				return !m_hasFailed;
+
+			writeBlock();
+
+			char endOfStream[BlockHeaderSize] = {};
+			writeToTarget(endOfStream, BlockHeaderSize);
+			m_target->pubsync();
+
+			m_isFinished = true;
+
+			return !m_hasFailed;
+		}
+
+	protected:
+		int_type overflow(int_type character) override
+		{
+			if (m_isFinished || !writeBlock())
+				return traits_type::eof();
+
+			if (!traits_type::eq_int_type(character, traits_type::eof()))
+			{
+				*pptr() = traits_type::to_char_type(character);
+				pbump(1);
+			}
+
+			return traits_type::not_eof(character);
+		}
+
+		int sync() override
+		{
+			if (!m_isFinished && !writeBlock())
+				return -1;
+
+			return (m_target->pubsync() == 0) ? 0 : -1;
+		}
+
+	private:
+		bool writeBlock()
+		{
+			const auto size = static_cast<std::size_t>(pptr() - pbase());
+
+			if (size == 0)
+				return !m_hasFailed;
+
+			m_compressedBlock.assign(BlockHeaderSize, '\0');
+			m_compressor.compress(m_block.data(), size, m_compressedBlock);
+
+			auto storedSize = static_cast<std::uint32_t>(m_compressedBlock.size() - BlockHeaderSize);
+
+			// Blocks that do not shrink are stored as they are
+			if (storedSize >= size)
+			{
+				m_compressedBlock.resize(BlockHeaderSize);
+				m_compressedBlock.append(m_block.data(), size);
+				storedSize = static_cast<std::uint32_t>(size) | StoredBlockFlag;
+			}
+
+			writeUInt32(&m_compressedBlock[0], static_cast<std::uint32_t>(size));
+			writeUInt32(&m_compressedBlock[4], storedSize);
+
+			writeToTarget(m_compressedBlock.data(), m_compressedBlock.size());
+			setp(m_block.data(), m_block.data() + m_block.size());
+
+			return !m_hasFailed;
+		}
+
+		void writeToTarget(const char *data, std::size_t size)
+		{
+			if (m_hasFailed)
+				return;
+
+			m_hasFailed = (m_target->sputn(data, static_cast<std::streamsize>(size)) != static_cast<std::streamsize>(size));
+		}
+
+		std::streambuf *m_target;
+		std::vector<char> m_block;
+		std::string m_compressedBlock;
+		BlockCompressor m_compressor;
+		bool m_isFinished;
+		bool m_hasFailed;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+
+#endif
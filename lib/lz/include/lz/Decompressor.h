@@ -0,0 +1,99 @@
+#ifndef __LZ__DECOMPRESSOR_H
+#define __LZ__DECOMPRESSOR_H
+
+#include <istream>
+#include <string>
+
+#include <lz/Block.h>
+#include <lz/Format.h>
+
+namespace lz
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Decompressor
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Reads a compressed stream block by block, holding only one compressed block in memory
+class Decompressor
+{
+	public:
+		// The magic bytes must already have been read from the input stream
+		explicit Decompressor(std::istream &istream)
+		:	m_istream(istream),
+			m_isFinished{false}
+		{
+		}
+
+		// Appends the next decompressed block to the output and returns false at the end of the stream
+		bool readBlock(std::string &output)
+		{
+			if (m_isFinished)
+				return false;
+
+			char header[BlockHeaderSize];
+			readExactly(header, BlockHeaderSize);
+
+			const auto size = readUInt32(header);
+			const auto storedSize = readUInt32(header + 4);
+
+			if (size == 0)
+			{
+				m_isFinished = true;
+				return false;
+			}
+
+			const auto isStored = (storedSize & StoredBlockFlag) != 0;
+			const auto compressedSize = storedSize & ~StoredBlockFlag;
+
+			if (size > MaximumBlockSize || compressedSize > MaximumBlockSize
+				|| (isStored && compressedSize != size))
+				throw FormatException("malformed compressed block header");
+
+			const auto outputStart = output.size();
+			output.resize(outputStart + size);
+
+			if (isStored)
+			{
+				readExactly(&output[outputStart], size);
+				return true;
+			}
+
+			m_compressedBlock.resize(compressedSize);
+			readExactly(&m_compressedBlock[0], compressedSize);
+
+			decompressBlock(m_compressedBlock.data(), compressedSize, &output[outputStart], size);
+
+			return true;
+		}
+
+		// Appends all remaining decompressed blocks to the output
+		void readAll(std::string &output)
+		{
+			while (readBlock(output));
+		}
+
+	private:
+		void readExactly(char *data, std::size_t size)
+		{
+			if (size == 0)
+				return;
+
+			m_istream.read(data, static_cast<std::streamsize>(size));
+
+			if (static_cast<std::size_t>(m_istream.gcount()) != size)
+				throw FormatException("unexpected end of compressed stream");
+		}
+
+		std::istream &m_istream;
+		std::string m_compressedBlock;
+		bool m_isFinished;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+
+#endif
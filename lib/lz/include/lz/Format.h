@@ -0,0 +1,85 @@
+#ifndef __LZ__FORMAT_H
+#define __LZ__FORMAT_H
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace lz
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Format
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// A compressed stream starts with the magic bytes, followed by independently compressed blocks,
+// each preceded by its decompressed size and its stored size (4 bytes each, little-endian). The
+// highest bit of the stored size marks blocks stored without compression. A block with decompressed
+// size 0 ends the stream.
+//
+// Compressed blocks consist of sequences of literals and a match with an earlier position of the
+// same block. Each sequence starts with a token byte containing the number of literals (high
+// nibble) and the match length minus MinimumMatchLength (low nibble), where 15 indicates that the
+// rest of the length follows in additional bytes, each adding up to 255. The literals and the
+// match offset (2 bytes, little-endian) follow. The last sequence of a block has no match
+
+constexpr char Magic[] = {'P', 'L', 'Z', '\x01'};
+constexpr std::size_t MagicSize = sizeof(Magic);
+
+constexpr std::size_t BlockHeaderSize = 8;
+constexpr std::size_t DefaultBlockSize = 1024 * 1024;
+constexpr std::size_t MaximumBlockSize = 64 * 1024 * 1024;
+constexpr std::uint32_t StoredBlockFlag = 0x80000000;
+
+constexpr std::size_t MinimumMatchLength = 4;
+constexpr std::size_t MaximumMatchOffset = 65535;
+
+// Lengths of literals and matches that do not fit into their nibble of the token byte
+constexpr std::size_t LengthMask = 15;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class FormatException: public std::runtime_error
+{
+	public:
+		explicit FormatException(const std::string &message)
+		:	std::runtime_error(message)
+		{
+		}
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline bool isMagic(const char *data, std::size_t size)
+{
+	return size >= MagicSize && std::memcmp(data, Magic, MagicSize) == 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline void writeUInt32(char *data, std::uint32_t value)
+{
+	for (std::size_t i = 0; i < 4; i++)
+		data[i] = static_cast<char>((value >> (8 * i)) & 0xff);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline std::uint32_t readUInt32(const char *data)
+{
+	std::uint32_t value = 0;
+
+	for (std::size_t i = 0; i < 4; i++)
+		value |= static_cast<std::uint32_t>(static_cast<unsigned char>(data[i])) << (8 * i);
+
+	return value;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+
+#endif
@@ -0,0 +1,99 @@
+#include <catch.hpp>
+
+#include <sstream>
+#include <string>
+
+#include <lz/CompressingStreamBuffer.h>
+#include <lz/Decompressor.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+std::string compress(const std::string &text, std::size_t blockSize = lz::DefaultBlockSize)
+{
+	std::stringstream compressedStream;
+
+	{
+		lz::CompressingStreamBuffer compressingStreamBuffer(compressedStream.rdbuf(), blockSize);
+		std::ostream outputStream(&compressingStreamBuffer);
+		outputStream << text;
+	}
+
+	return compressedStream.str();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::string decompress(const std::string &compressed)
+{
+	std::stringstream compressedStream(compressed);
+
+	char magic[lz::MagicSize];
+	compressedStream.read(magic, lz::MagicSize);
+
+	REQUIRE(lz::isMagic(magic, static_cast<std::size_t>(compressedStream.gcount())));
+
+	std::string text;
+	lz::Decompressor(compressedStream).readAll(text);
+
+	return text;
+}
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("[lz] Compressed streams are decompressed correctly", "[lz]")
+{
+	std::string facts;
+
+	for (int i = 0; i < 20000; i++)
+		facts += "precondition(action((\"move\", \"b" + std::to_string(i % 97) + "\")), variable(\"on\"), value(\"on\", true)).\n";
+
+	SECTION("repetitive text shrinks several-fold")
+	{
+		const auto compressed = compress(facts);
+
+		CHECK(compressed.size() * 5 < facts.size());
+		CHECK(decompress(compressed) == facts);
+	}
+
+	SECTION("small blocks and block boundaries within matches work")
+	{
+		CHECK(decompress(compress(facts, 1000)) == facts);
+		CHECK(decompress(compress(facts, 7)) == facts);
+	}
+
+	SECTION("incompressible and empty input works")
+	{
+		std::string noise;
+		unsigned int state = 1;
+
+		for (int i = 0; i < 100000; i++)
+		{
+			state = state * 1103515245 + 12345;
+			noise.push_back(static_cast<char>(state >> 16));
+		}
+
+		CHECK(decompress(compress(noise)) == noise);
+		CHECK(decompress(compress("")).empty());
+		CHECK(decompress(compress("abc")) == "abc");
+		CHECK(decompress(compress(std::string(100000, 'x'))) == std::string(100000, 'x'));
+	}
+
+	SECTION("truncated and corrupted input is rejected")
+	{
+		const auto compressed = compress(facts);
+
+		CHECK_THROWS_AS(decompress(compressed.substr(0, compressed.size() / 2)), lz::FormatException);
+
+		auto corrupted = compressed;
+
+		for (std::size_t i = lz::MagicSize + lz::BlockHeaderSize; i < corrupted.size(); i += 7)
+			corrupted[i] = static_cast<char>(corrupted[i] ^ 0x5a);
+
+		CHECK_THROWS_AS(decompress(corrupted), lz::FormatException);
+	}
+}
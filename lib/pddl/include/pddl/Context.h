@@ -1,6 +1,7 @@
 #ifndef __PDDL__CONTEXT_H
 #define __PDDL__CONTEXT_H
 
+#include <chrono>
 #include <functional>
 
 #include <pddl/Mode.h>
@@ -24,6 +25,8 @@ struct Context
 
 	// TODO: replace std::string with char *
 	using WarningCallback = std::function<void (tokenize::Location &&, const std::string &)>;
+	// Receives the time spent in individual parsing phases (for instance, for profiling)
+	using PhaseCallback = std::function<void (const char *, std::chrono::steady_clock::duration)>;
 
 	Context() = default;
 	~Context() = default;
@@ -42,6 +45,7 @@ struct Context
 
 	Tokenizer tokenizer;
 	WarningCallback warningCallback;
+	PhaseCallback phaseCallback;
 
 	Mode mode;
 };
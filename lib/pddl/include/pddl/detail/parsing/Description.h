@@ -21,8 +21,19 @@ class DescriptionParser
 		DescriptionParser(Context &context);
 		ast::Description parse();
 
-	private:
+		// Parses only the domain, after which the problem may be parsed incrementally by a
+		// ProblemParser once the tokenizer is positioned with seekProblem
+		ast::DomainPointer parseDomain();
+		bool hasProblem() const;
+		void seekProblem();
+
+		// Removes comments and finds the domain and problem without parsing them, after which the
+		// tokenizer may be positioned with seekDomain and seekProblem (parseDomain does this itself)
 		void findSections();
+		void seekDomain();
+
+	private:
+		void findDomainAndProblem();
 
 		Context &m_context;
 		tokenize::StreamPosition m_domainPosition;
@@ -18,9 +18,24 @@ namespace detail
 class DomainParser
 {
 	public:
+		// The part of the input spanned by a section
+		struct Section
+		{
+			tokenize::StreamPosition begin;
+			tokenize::StreamPosition end;
+		};
+
 		DomainParser(Context &context);
 		ast::DomainPointer parse();
 
+		// Finds the sections without parsing them, which tells which parts of the input changed between
+		// two versions of a domain
+		void findSections();
+		// The domain and its action sections (in the order in which the actions are parsed), known once
+		// the sections are found
+		const Section &extent() const;
+		const std::vector<Section> &actionSections() const;
+
 	private:
 		void findSections(ast::Domain &domain);
 
@@ -37,7 +52,8 @@ class DomainParser
 		tokenize::StreamPosition m_typesPosition;
 		tokenize::StreamPosition m_constantsPosition;
 		tokenize::StreamPosition m_predicatesPosition;
-		std::vector<tokenize::StreamPosition> m_actionPositions;
+		std::vector<Section> m_actionSections;
+		Section m_extent;
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1,6 +1,8 @@
 #ifndef __PDDL__DETAIL__PARSING__INITIAL_STATE_H
 #define __PDDL__DETAIL__PARSING__INITIAL_STATE_H
 
+#include <functional>
+
 #include <pddl/Context.h>
 #include <pddl/detail/ASTContext.h>
 
@@ -17,6 +19,10 @@ namespace detail
 
 ast::InitialState parseInitialState(Context &context, ASTContext &astContext, VariableStack &variableStack);
 
+// Parses the facts of the initial state one by one without storing them
+void parseInitialStateFacts(Context &context, ASTContext &astContext, VariableStack &variableStack,
+	const std::function<void(ast::Fact &&)> &handleFact);
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 }
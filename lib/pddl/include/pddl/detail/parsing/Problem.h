@@ -21,6 +21,13 @@ class ProblemParser
 		ProblemParser(Context &context, ast::Domain &domain);
 		ast::ProblemPointer parse();
 
+		// Incremental parsing: the header (domain, requirements, and objects) is parsed first,
+		// followed by the initial state, whose facts are handed over one at a time instead of being
+		// stored in the problem, and finally the goal
+		ast::ProblemPointer parseHeader();
+		void parseInitialState(ast::Problem &problem, const std::function<void(ast::Fact &&)> &handleFact);
+		void parseGoal(ast::Problem &problem);
+
 	private:
 		void findSections(ast::Problem &problem);
 
@@ -28,7 +35,7 @@ class ProblemParser
 		void parseRequirementSection(ast::Problem &problem);
 		void computeDerivedRequirements(ast::Problem &problem);
 		void parseObjectSection(ast::Problem &problem);
-		void parseInitialStateSection(ast::Problem &problem);
+		void parseInitialStateSection(ast::Problem &problem, const std::function<void(ast::Fact &&)> &handleFact);
 		void parseGoalSection(ast::Problem &problem);
 
 		Context &m_context;
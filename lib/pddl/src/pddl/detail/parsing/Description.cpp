@@ -28,23 +28,13 @@ DescriptionParser::DescriptionParser(Context &context)
 
 ast::Description DescriptionParser::parse()
 {
-	auto &tokenizer = m_context.tokenizer;
-	tokenizer.removeComments(";", "\n", false);
-
-	findSections();
-
-	if (m_domainPosition == tokenize::InvalidStreamPosition)
-		throw ParserException("no PDDL domain specified");
-
-	tokenizer.seek(m_domainPosition);
-
-	auto domain = DomainParser(m_context).parse();
+	auto domain = parseDomain();
 
 	// If no problem is given, return just the domain
-	if (m_problemPosition == tokenize::InvalidStreamPosition)
+	if (!hasProblem())
 		return {std::move(domain), std::experimental::nullopt};
 
-	tokenizer.seek(m_problemPosition);
+	seekProblem();
 
 	auto problem = ProblemParser(m_context, *domain).parse();
 
@@ -59,10 +49,66 @@ ast::Description DescriptionParser::parse()
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+ast::DomainPointer DescriptionParser::parseDomain()
+{
+	findSections();
+	seekDomain();
+
+	return DomainParser(m_context).parse();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void DescriptionParser::findSections()
 {
 	auto &tokenizer = m_context.tokenizer;
 
+	const auto reportPhase =
+		[&](const char *phase, auto startTime)
+		{
+			if (m_context.phaseCallback)
+				m_context.phaseCallback(phase, std::chrono::steady_clock::now() - startTime);
+		};
+
+	auto startTime = std::chrono::steady_clock::now();
+	tokenizer.removeComments(";", "\n", false);
+	reportPhase("removing comments", startTime);
+
+	startTime = std::chrono::steady_clock::now();
+	findDomainAndProblem();
+	reportPhase("finding sections", startTime);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void DescriptionParser::seekDomain()
+{
+	if (m_domainPosition == tokenize::InvalidStreamPosition)
+		throw ParserException("no PDDL domain specified");
+
+	m_context.tokenizer.seek(m_domainPosition);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool DescriptionParser::hasProblem() const
+{
+	return m_problemPosition != tokenize::InvalidStreamPosition;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void DescriptionParser::seekProblem()
+{
+	m_context.tokenizer.seek(m_problemPosition);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void DescriptionParser::findDomainAndProblem()
+{
+	auto &tokenizer = m_context.tokenizer;
+
 	tokenizer.skipWhiteSpace();
 
 	while (!tokenizer.atEnd())
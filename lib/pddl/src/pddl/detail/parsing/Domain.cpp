@@ -26,7 +26,8 @@ DomainParser::DomainParser(Context &context)
 	m_requirementsPosition{tokenize::InvalidStreamPosition},
 	m_typesPosition{tokenize::InvalidStreamPosition},
 	m_constantsPosition{tokenize::InvalidStreamPosition},
-	m_predicatesPosition{tokenize::InvalidStreamPosition}
+	m_predicatesPosition{tokenize::InvalidStreamPosition},
+	m_extent{tokenize::InvalidStreamPosition, tokenize::InvalidStreamPosition}
 {
 }
 
@@ -64,12 +65,11 @@ ast::DomainPointer DomainParser::parse()
 		parsePredicateSection(*domain);
 	}
 
-	for (size_t i = 0; i < m_actionPositions.size(); i++)
-		if (m_actionPositions[i] != tokenize::InvalidStreamPosition)
-		{
-			tokenizer.seek(m_actionPositions[i]);
-			parseActionSection(*domain);
-		}
+	for (const auto &actionSection : m_actionSections)
+	{
+		tokenizer.seek(actionSection.begin);
+		parseActionSection(*domain);
+	}
 
 	computeDerivedRequirements(*domain);
 
@@ -78,10 +78,41 @@ ast::DomainPointer DomainParser::parse()
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void DomainParser::findSections()
+{
+	ast::Domain domain;
+	findSections(domain);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const DomainParser::Section &DomainParser::extent() const
+{
+	return m_extent;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const std::vector<DomainParser::Section> &DomainParser::actionSections() const
+{
+	return m_actionSections;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void DomainParser::findSections(ast::Domain &domain)
 {
 	auto &tokenizer = m_context.tokenizer;
 
+	// The sections may have been found before without parsing them
+	m_requirementsPosition = tokenize::InvalidStreamPosition;
+	m_typesPosition = tokenize::InvalidStreamPosition;
+	m_constantsPosition = tokenize::InvalidStreamPosition;
+	m_predicatesPosition = tokenize::InvalidStreamPosition;
+	m_actionSections.clear();
+
+	m_extent.begin = tokenizer.position();
+
 	tokenizer.expect<std::string>("(");
 	tokenizer.expect<std::string>("define");
 	tokenizer.expect<std::string>("(");
@@ -123,10 +154,7 @@ void DomainParser::findSections(ast::Domain &domain)
 		else if (tokenizer.testIdentifierAndSkip("predicates"))
 			setSectionPosition("predicates", m_predicatesPosition, position, true);
 		else if (tokenizer.testIdentifierAndSkip("action"))
-		{
-			m_actionPositions.emplace_back(tokenize::InvalidStreamPosition);
-			setSectionPosition("action", m_actionPositions.back(), position);
-		}
+			m_actionSections.push_back({position, tokenize::InvalidStreamPosition});
 		else if (tokenizer.testIdentifierAndSkip("functions")
 			|| tokenizer.testIdentifierAndSkip("constraints")
 			|| tokenizer.testIdentifierAndSkip("durative-action")
@@ -145,10 +173,15 @@ void DomainParser::findSections(ast::Domain &domain)
 		// Skip section for now and parse it later
 		skipSection(tokenizer);
 
+		if (!m_actionSections.empty() && m_actionSections.back().begin == position)
+			m_actionSections.back().end = tokenizer.position();
+
 		tokenizer.skipWhiteSpace();
 	}
 
 	tokenizer.expect<std::string>(")");
+
+	m_extent.end = tokenizer.position();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -17,10 +17,24 @@ namespace detail
 
 ast::InitialState parseInitialState(Context &context, ASTContext &astContext, VariableStack &variableStack)
 {
-	auto &tokenizer = context.tokenizer;
-
 	ast::InitialState initialState;
 
+	parseInitialStateFacts(context, astContext, variableStack,
+		[&](ast::Fact &&fact)
+		{
+			initialState.facts.emplace_back(std::move(fact));
+		});
+
+	return initialState;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void parseInitialStateFacts(Context &context, ASTContext &astContext, VariableStack &variableStack,
+	const std::function<void(ast::Fact &&)> &handleFact)
+{
+	auto &tokenizer = context.tokenizer;
+
 	tokenizer.skipWhiteSpace();
 
 	while (tokenizer.currentCharacter() != ')')
@@ -30,12 +44,10 @@ ast::InitialState parseInitialState(Context &context, ASTContext &astContext, Va
 		if (!fact)
 			throw ParserException(tokenizer.location(), "invalid initial state fact");
 
-		initialState.facts.emplace_back(std::move(fact.value()));
+		handleFact(std::move(fact.value()));
 
 		tokenizer.skipWhiteSpace();
 	}
-
-	return initialState;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -34,6 +34,23 @@ ProblemParser::ProblemParser(Context &context, ast::Domain &domain)
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 ast::ProblemPointer ProblemParser::parse()
+{
+	auto problem = parseHeader();
+
+	parseInitialState(*problem,
+		[&](ast::Fact &&fact)
+		{
+			problem->initialState.facts.emplace_back(std::move(fact));
+		});
+
+	parseGoal(*problem);
+
+	return problem;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+ast::ProblemPointer ProblemParser::parseHeader()
 {
 	auto problem = std::make_unique<ast::Problem>(&m_domain);
 
@@ -59,19 +76,33 @@ ast::ProblemPointer ProblemParser::parse()
 		parseObjectSection(*problem);
 	}
 
+	return problem;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void ProblemParser::parseInitialState(ast::Problem &problem, const std::function<void(ast::Fact &&)> &handleFact)
+{
+	auto &tokenizer = m_context.tokenizer;
+
 	if (m_initialStatePosition == tokenize::InvalidStreamPosition)
 		throw ParserException(tokenizer.location(), "problem description does not specify an initial state");
 
 	tokenizer.seek(m_initialStatePosition);
-	parseInitialStateSection(*problem);
+	parseInitialStateSection(problem, handleFact);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void ProblemParser::parseGoal(ast::Problem &problem)
+{
+	auto &tokenizer = m_context.tokenizer;
 
 	if (m_goalPosition == tokenize::InvalidStreamPosition)
 		throw ParserException(tokenizer.location(), "problem description does not specify a goal");
 
 	tokenizer.seek(m_goalPosition);
-	parseGoalSection(*problem);
-
-	return problem;
+	parseGoalSection(problem);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -252,7 +283,7 @@ void ProblemParser::parseObjectSection(ast::Problem &problem)
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void ProblemParser::parseInitialStateSection(ast::Problem &problem)
+void ProblemParser::parseInitialStateSection(ast::Problem &problem, const std::function<void(ast::Fact &&)> &handleFact)
 {
 	auto &tokenizer = m_context.tokenizer;
 
@@ -263,7 +294,7 @@ void ProblemParser::parseInitialStateSection(ast::Problem &problem)
 	ASTContext astContext(problem);
 	VariableStack variableStack;
 
-	problem.initialState = parseInitialState(m_context, astContext, variableStack);
+	parseInitialStateFacts(m_context, astContext, variableStack, handleFact);
 	tokenizer.expect<std::string>(")");
 
 	skipSection(tokenizer);
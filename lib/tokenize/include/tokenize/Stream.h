@@ -10,6 +10,9 @@
 #include <sstream>
 #include <vector>
 
+#include <lz/Decompressor.h>
+#include <lz/Format.h>
+
 #include <tokenize/Location.h>
 #include <tokenize/StreamPosition.h>
 #include <tokenize/TokenizerException.h>
@@ -72,7 +75,28 @@ class Stream
 				istream.clear();
 			}
 
-			std::copy(std::istreambuf_iterator<char>(istream), std::istreambuf_iterator<char>(), std::back_inserter(m_content));
+			// Compressed input is recognized by its magic bytes and decompressed while reading
+			char magic[lz::MagicSize];
+			istream.read(magic, lz::MagicSize);
+			const auto magicSize = static_cast<std::size_t>(istream.gcount());
+
+			if (lz::isMagic(magic, magicSize))
+			{
+				try
+				{
+					lz::Decompressor(istream).readAll(m_content);
+				}
+				catch (const lz::FormatException &exception)
+				{
+					throw std::runtime_error("could not decompress “" + streamName + "”: " + exception.what());
+				}
+			}
+			else
+			{
+				istream.clear();
+				m_content.append(magic, magicSize);
+				std::copy(std::istreambuf_iterator<char>(istream), std::istreambuf_iterator<char>(), std::back_inserter(m_content));
+			}
 
 			for (auto i = contentStartIndex; i < m_content.size(); i++)
 				if (m_content[i] == '\n')
@@ -0,0 +1,315 @@
+#include <plasp/Statistics.h>
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+
+#include <sys/resource.h>
+
+namespace plasp
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Statistics
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+double toSeconds(Statistics::Clock::duration duration)
+{
+	return std::chrono::duration<double>(duration).count();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Statistics::PhaseTimer::PhaseTimer(Statistics &statistics, const char *phase)
+:	m_statistics(statistics),
+	m_phaseID{statistics.m_phases.size()},
+	m_startTime{Clock::now()}
+{
+	m_statistics.m_phases.push_back({phase, m_statistics.m_depth, Clock::duration::zero()});
+	m_statistics.m_depth++;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Statistics::PhaseTimer::~PhaseTimer()
+{
+	m_statistics.m_depth--;
+	m_statistics.m_phases[m_phaseID].duration = Clock::now() - m_startTime;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Statistics::Statistics()
+:	m_startTime{Clock::now()},
+	m_depth{0}
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void Statistics::addPhase(const char *phase, Clock::duration duration)
+{
+	m_phases.push_back({phase, m_depth, duration});
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void Statistics::count(const char *counter, size_t value)
+{
+	auto match = std::find_if(m_counters.begin(), m_counters.end(),
+		[&](const auto &otherCounter)
+		{
+			return otherCounter.first == counter;
+		});
+
+	if (match == m_counters.end())
+	{
+		m_counters.emplace_back(counter, value);
+		return;
+	}
+
+	match->second += value;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void Statistics::print(std::ostream &stream) const
+{
+	constexpr size_t NameWidth = 28;
+
+	const auto printLine =
+		[&](size_t depth, const std::string &name)
+		{
+			const auto indentation = std::string(2 * depth + 2, ' ');
+
+			stream << indentation << name << ":"
+				<< std::string(NameWidth - std::min(NameWidth - 1, indentation.size() + name.size()), ' ');
+		};
+
+	const auto flags = stream.flags();
+	const auto precision = stream.precision();
+
+	stream << std::fixed << std::setprecision(3) << "statistics:" << std::endl;
+
+	printLine(0, "time");
+	stream << toSeconds(Clock::now() - m_startTime) << " s" << std::endl;
+
+	for (const auto &phase : m_phases)
+	{
+		printLine(phase.depth + 1, phase.name);
+		stream << toSeconds(phase.duration) << " s" << std::endl;
+	}
+
+	printLine(0, "peak memory");
+	stream << std::setprecision(1) << static_cast<double>(peakResidentSetSize()) / (1024 * 1024) << " MiB"
+		<< std::endl;
+
+	for (const auto &counter : m_counters)
+	{
+		printLine(0, counter.first);
+		stream << counter.second << std::endl;
+	}
+
+	stream.flags(flags);
+	stream.precision(precision);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void Statistics::printJSON(std::ostream &stream) const
+{
+	const auto flags = stream.flags();
+	const auto precision = stream.precision();
+
+	stream << std::fixed << std::setprecision(6);
+
+	// Prints the phases with the given depth starting at the given position, returning the position
+	// after them
+	std::function<size_t (size_t, size_t)> printPhases =
+		[&](size_t phaseID, size_t depth)
+		{
+			stream << "[";
+
+			for (bool isFirstPhase = true; phaseID < m_phases.size() && m_phases[phaseID].depth == depth; isFirstPhase = false)
+			{
+				const auto &phase = m_phases[phaseID];
+
+				if (!isFirstPhase)
+					stream << ", ";
+
+				stream << "{\"name\": ";
+				printJSONString(stream, phase.name);
+				stream << ", \"time\": " << toSeconds(phase.duration);
+
+				phaseID++;
+
+				if (phaseID < m_phases.size() && m_phases[phaseID].depth > depth)
+				{
+					stream << ", \"phases\": ";
+					phaseID = printPhases(phaseID, depth + 1);
+				}
+
+				stream << "}";
+			}
+
+			stream << "]";
+
+			return phaseID;
+		};
+
+	stream << "{" << std::endl;
+	stream << "  \"time\": " << toSeconds(Clock::now() - m_startTime) << "," << std::endl;
+	stream << "  \"phases\": ";
+	printPhases(0, 0);
+	stream << "," << std::endl;
+	stream << "  \"peak memory\": " << peakResidentSetSize() << "," << std::endl;
+	stream << "  \"counters\": {";
+
+	for (auto i = m_counters.cbegin(); i != m_counters.cend(); i++)
+	{
+		if (i != m_counters.cbegin())
+			stream << ",";
+
+		stream << std::endl << "    ";
+		printJSONString(stream, i->first);
+		stream << ": " << i->second;
+	}
+
+	stream << std::endl << "  }" << std::endl << "}" << std::endl;
+
+	stream.flags(flags);
+	stream.precision(precision);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+size_t Statistics::peakResidentSetSize()
+{
+	struct rusage resourceUsage;
+
+	if (getrusage(RUSAGE_SELF, &resourceUsage) != 0)
+		return 0;
+
+	// Reported in kilobytes on Linux
+	return static_cast<size_t>(resourceUsage.ru_maxrss) * 1024;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void printJSONString(std::ostream &stream, const std::string &string)
+{
+	const auto flags = stream.flags();
+
+	stream << "\"";
+
+	for (const auto character : string)
+	{
+		if (character == '"' || character == '\\')
+			stream << "\\" << character;
+		else if (character == '\n')
+			stream << "\\n";
+		else if (character == '\t')
+			stream << "\\t";
+		else if (static_cast<unsigned char>(character) < 0x20)
+			stream << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(character)
+				<< std::dec << std::setfill(' ');
+		else
+			stream << character;
+	}
+
+	stream << "\"";
+
+	stream.flags(flags);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// OutputCounter
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+OutputCounter::OutputCounter(std::ostream &stream)
+:	m_stream(stream),
+	m_streamBuffer{stream.rdbuf()},
+	m_numberOfBytes{0},
+	m_numberOfFacts{0},
+	m_lastCharacter{'\0'}
+{
+	m_stream.rdbuf(this);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+OutputCounter::~OutputCounter()
+{
+	m_stream.rdbuf(m_streamBuffer);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+OutputCounter::int_type OutputCounter::overflow(int_type character)
+{
+	if (traits_type::eq_int_type(character, traits_type::eof()))
+		return traits_type::not_eof(character);
+
+	const auto data = traits_type::to_char_type(character);
+	countOutput(&data, 1);
+
+	return m_streamBuffer->sputc(data);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::streamsize OutputCounter::xsputn(const char *data, std::streamsize size)
+{
+	const auto written = m_streamBuffer->sputn(data, size);
+	countOutput(data, static_cast<size_t>(std::max(written, static_cast<std::streamsize>(0))));
+
+	return written;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int OutputCounter::sync()
+{
+	return m_streamBuffer->pubsync();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void OutputCounter::countOutput(const char *data, size_t size)
+{
+	if (size == 0)
+		return;
+
+	m_numberOfBytes += size;
+
+	for (const auto *position = static_cast<const char *>(std::memchr(data, '\n', size)); position;)
+	{
+		const auto previousCharacter = (position == data) ? m_lastCharacter : *(position - 1);
+
+		if (previousCharacter == '.')
+			m_numberOfFacts++;
+
+		const auto remainingSize = size - static_cast<size_t>(position + 1 - data);
+		position = static_cast<const char *>(std::memchr(position + 1, '\n', remainingSize));
+	}
+
+	m_lastCharacter = data[size - 1];
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
@@ -0,0 +1,299 @@
+#include <plasp/Symbols.h>
+
+#include <cassert>
+#include <cctype>
+#include <iostream>
+#include <iterator>
+
+#include <tokenize/TokenizerException.h>
+
+namespace plasp
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Symbols
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void printSymbolTable(std::ostream &stream, const colorlog::SymbolTable &symbolTable, Language::Type language)
+{
+	assert(language == Language::Type::PDDL || language == Language::Type::SAS);
+
+	stream << "language(" << (language == Language::Type::SAS ? "sas" : "pddl") << ")." << std::endl;
+
+	const auto &names = symbolTable.names();
+
+	for (size_t i = 0; i < names.size(); i++)
+		stream << "symbol(" << i << ", \"" << names[i] << "\")." << '\n';
+
+	stream.flush();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+SymbolDecoder::SymbolDecoder()
+:	m_language{Language::Type::Unknown}
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+SymbolDecoder SymbolDecoder::fromTokenizer(tokenize::Tokenizer<> &&tokenizer)
+{
+	SymbolDecoder symbolDecoder;
+	symbolDecoder.parseContent(tokenizer);
+
+	return symbolDecoder;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+SymbolDecoder SymbolDecoder::fromFile(const std::experimental::filesystem::path &path)
+{
+	if (!std::experimental::filesystem::is_regular_file(path))
+		throw std::runtime_error("File does not exist: “" + path.string() + "”");
+
+	tokenize::Tokenizer<> tokenizer;
+	tokenizer.read(path);
+
+	return fromTokenizer(std::move(tokenizer));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void SymbolDecoder::parseContent(tokenize::Tokenizer<> &tokenizer)
+{
+	tokenizer.expect<std::string>("language(");
+
+	if (tokenizer.testAndSkip<std::string>("pddl"))
+		m_language = Language::Type::PDDL;
+	else if (tokenizer.testAndSkip<std::string>("sas"))
+		m_language = Language::Type::SAS;
+	else
+		throw tokenize::TokenizerException(tokenizer.location(), "unknown language in symbol table");
+
+	tokenizer.expect<std::string>(").");
+	tokenizer.skipWhiteSpace();
+
+	while (!tokenizer.atEnd())
+	{
+		tokenizer.expect<std::string>("symbol(");
+
+		const auto symbolID = tokenizer.get<size_t>();
+
+		if (symbolID != m_names.size())
+			throw tokenize::TokenizerException(tokenizer.location(), "unexpected symbol ID, expected " + std::to_string(m_names.size()));
+
+		tokenizer.expect<std::string>(",");
+		tokenizer.expect<std::string>("\"");
+
+		std::string name;
+
+		while (tokenizer.currentCharacter() != '"')
+		{
+			name.push_back(tokenizer.currentCharacter());
+			tokenizer.advance();
+		}
+
+		tokenizer.advance();
+		tokenizer.expect<std::string>(").");
+
+		m_names.emplace_back(std::move(name));
+
+		tokenizer.skipWhiteSpace();
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Language::Type SymbolDecoder::language() const
+{
+	return m_language;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const std::vector<std::string> &SymbolDecoder::names() const
+{
+	return m_names;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void SymbolDecoder::decode(std::istream &inputStream, std::ostream &outputStream) const
+{
+	// Function terms and tuples (with empty function names) enclosing the current position
+	struct Term
+	{
+		std::string functionName;
+		size_t argumentIndex;
+	};
+
+	std::vector<Term> terms;
+
+	const auto isSymbolPosition =
+		[&]()
+		{
+			if (terms.empty())
+				return false;
+
+			const auto &term = terms.back();
+
+			// Names directly passed to a function, as in constant(ID) and variable(ID)
+			if (!term.functionName.empty())
+			{
+				if (term.argumentIndex != 0)
+					return false;
+
+				const auto &functionName = term.functionName;
+
+				if (functionName == "type" || functionName == "constant" || functionName == "action"
+					|| functionName == "derivedVariable" || functionName == "derivedPredicate")
+				{
+					return true;
+				}
+
+				// SAS variables are numbered in the input already
+				if (functionName == "variable")
+					return (m_language == Language::Type::PDDL);
+
+				if (functionName == "value")
+					return (m_language == Language::Type::SAS);
+
+				return false;
+			}
+
+			// Names in tuples, as in action((ID, constant(ID))) and variable((ID, constant(ID)))
+			if (terms.size() < 2)
+				return false;
+
+			const auto &parentTerm = terms[terms.size() - 2];
+
+			if (parentTerm.argumentIndex != 0)
+				return false;
+
+			// SAS action arguments are plain names
+			if (parentTerm.functionName == "action")
+				return true;
+
+			return (term.argumentIndex == 0
+				&& (parentTerm.functionName == "variable" || parentTerm.functionName == "derivedVariable"
+					|| parentTerm.functionName == "derivedPredicate"));
+		};
+
+	const auto isIdentifierStart =
+		[](char character)
+		{
+			return std::isalpha(static_cast<unsigned char>(character)) || character == '_';
+		};
+
+	const auto isIdentifierCharacter =
+		[](char character)
+		{
+			return std::isalnum(static_cast<unsigned char>(character)) || character == '_' || character == '\'';
+		};
+
+	std::istreambuf_iterator<char> input(inputStream);
+	const std::istreambuf_iterator<char> inputEnd;
+	std::ostreambuf_iterator<char> output(outputStream);
+
+	// The function name, if the last token was an identifier
+	std::string identifier;
+	char previousCharacter = '\0';
+
+	while (input != inputEnd)
+	{
+		const auto character = *input;
+
+		// Copy strings verbatim
+		if (character == '"')
+		{
+			*output++ = *input++;
+
+			while (input != inputEnd)
+			{
+				const auto stringCharacter = *input++;
+				*output++ = stringCharacter;
+
+				if (stringCharacter == '\\' && input != inputEnd)
+					*output++ = *input++;
+				else if (stringCharacter == '"')
+					break;
+			}
+
+			identifier.clear();
+			previousCharacter = '"';
+			continue;
+		}
+
+		if (isIdentifierStart(character))
+		{
+			identifier.clear();
+
+			while (input != inputEnd && isIdentifierCharacter(*input))
+			{
+				identifier.push_back(*input);
+				*output++ = *input++;
+			}
+
+			previousCharacter = identifier.back();
+			continue;
+		}
+
+		if (std::isdigit(static_cast<unsigned char>(character)))
+		{
+			std::string number;
+
+			while (input != inputEnd && std::isdigit(static_cast<unsigned char>(*input)))
+				number.push_back(*input++);
+
+			// Negative numbers are never symbol IDs
+			const auto isSymbol = (previousCharacter != '-' && number.size() < 20 && isSymbolPosition());
+			const auto symbolID = isSymbol ? std::stoull(number) : 0;
+
+			if (isSymbol && symbolID < m_names.size())
+			{
+				const auto &name = m_names[symbolID];
+
+				*output++ = '"';
+				std::copy(name.cbegin(), name.cend(), output);
+				*output++ = '"';
+			}
+			else
+				std::copy(number.cbegin(), number.cend(), output);
+
+			identifier.clear();
+			previousCharacter = number.back();
+			continue;
+		}
+
+		switch (character)
+		{
+			case '(':
+				terms.push_back({identifier, 0});
+				break;
+			case ',':
+				if (!terms.empty())
+					terms.back().argumentIndex++;
+				break;
+			case ')':
+				if (!terms.empty())
+					terms.pop_back();
+				break;
+			// Atoms never span multiple lines
+			case '\n':
+				terms.clear();
+				break;
+		}
+
+		*output++ = *input++;
+
+		identifier.clear();
+		previousCharacter = character;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
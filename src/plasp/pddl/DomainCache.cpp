@@ -0,0 +1,233 @@
+#include <plasp/pddl/DomainCache.h>
+
+#include <algorithm>
+#include <functional>
+#include <sstream>
+#include <utility>
+
+#include <pddl/Exception.h>
+#include <pddl/Tokenizer.h>
+#include <pddl/detail/normalization/Domain.h>
+#include <pddl/detail/normalization/Problem.h>
+#include <pddl/detail/parsing/Description.h>
+#include <pddl/detail/parsing/Problem.h>
+
+namespace plasp
+{
+namespace pddl
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// DomainCache
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+DomainCache::Lease::Lease(DomainCache &cache, std::shared_ptr<const std::string> domainText,
+	::pddl::Mode mode, std::unique_ptr<Instance> instance)
+:	m_cache{&cache},
+	m_domainText{std::move(domainText)},
+	m_mode{mode},
+	m_instance{std::move(instance)}
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+DomainCache::Lease::~Lease()
+{
+	if (!m_instance)
+		return;
+
+	m_cache->giveBack(std::move(m_domainText), m_mode, std::move(m_instance));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const ::pddl::normalizedAST::Description &DomainCache::Lease::parseProblem(::pddl::Context &context)
+{
+	resetProblem(*m_instance);
+
+	auto &domain = *m_instance->domain;
+	auto &normalizedDomain = *m_instance->description.domain;
+
+	// Normalization moved the declarations that the parser looks up from the domain to the
+	// normalized domain, so they are lent back to the domain while the problem is parsed
+	const auto swapDeclarations =
+		[&]()
+		{
+			std::swap(domain.types, normalizedDomain.types);
+			std::swap(domain.constants, normalizedDomain.constants);
+			std::swap(domain.predicates, normalizedDomain.predicates);
+		};
+
+	auto &tokenizer = context.tokenizer;
+	tokenizer.removeComments(";", "\n", false);
+	tokenizer.skipWhiteSpace();
+
+	::pddl::ast::ProblemPointer problem;
+
+	swapDeclarations();
+
+	try
+	{
+		problem = ::pddl::detail::ProblemParser(context, domain).parse();
+	}
+	catch (...)
+	{
+		swapDeclarations();
+		throw;
+	}
+
+	swapDeclarations();
+
+	m_instance->description.problem = ::pddl::detail::normalize(std::move(problem), &normalizedDomain);
+
+	return m_instance->description;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const ::pddl::normalizedAST::Description &DomainCache::Lease::description() const
+{
+	return m_instance->description;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+DomainCache::DomainCache(std::size_t capacity)
+:	m_capacity{std::max(capacity, static_cast<std::size_t>(1))},
+	m_numberOfHits{0},
+	m_numberOfMisses{0}
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+DomainCache::Lease DomainCache::lease(const std::string &domainText, ::pddl::Mode mode,
+	::pddl::Context::WarningCallback warningCallback, const std::string &domainName)
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		const auto matchingEntry = m_entryForKey.find(key(domainText, mode));
+
+		if (matchingEntry != m_entryForKey.end())
+		{
+			auto &entry = *matchingEntry->second;
+
+			if (entry.mode == mode && *entry.domainText == domainText)
+			{
+				m_entries.splice(m_entries.begin(), m_entries, matchingEntry->second);
+
+				if (!entry.unusedInstances.empty())
+				{
+					auto instance = std::move(entry.unusedInstances.back());
+					entry.unusedInstances.pop_back();
+					m_numberOfHits++;
+
+					return Lease(*this, entry.domainText, mode, std::move(instance));
+				}
+			}
+		}
+	}
+
+	m_numberOfMisses++;
+
+	::pddl::Tokenizer tokenizer;
+	std::istringstream domainStream(domainText);
+	tokenizer.read(domainName, domainStream);
+
+	::pddl::Context context(std::move(tokenizer), warningCallback, mode);
+	::pddl::detail::DescriptionParser descriptionParser(context);
+	auto domain = descriptionParser.parseDomain();
+
+	if (descriptionParser.hasProblem())
+		throw ::pddl::ParserException("cached domain must not contain a problem");
+
+	auto instance = std::make_unique<Instance>();
+	instance->description.domain = ::pddl::detail::normalize(std::move(domain));
+	instance->domain = std::move(domain);
+	instance->domain->name = instance->description.domain->name;
+	instance->numberOfTypes = instance->description.domain->types.size();
+
+	return Lease(*this, std::make_shared<const std::string>(domainText), mode, std::move(instance));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t DomainCache::numberOfHits() const
+{
+	return m_numberOfHits;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t DomainCache::numberOfMisses() const
+{
+	return m_numberOfMisses;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t DomainCache::key(const std::string &domainText, ::pddl::Mode mode)
+{
+	return std::hash<std::string>()(domainText) * 31 + static_cast<std::size_t>(mode);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void DomainCache::resetProblem(Instance &instance)
+{
+	instance.description.problem = std::experimental::nullopt;
+
+	// In compatibility mode, the problem parser declares types that are used without declaration,
+	// which must not be visible to the problems parsed later
+	instance.description.domain->types.resize(instance.numberOfTypes);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void DomainCache::giveBack(std::shared_ptr<const std::string> domainText, ::pddl::Mode mode,
+	std::unique_ptr<Instance> instance)
+{
+	resetProblem(*instance);
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	const auto domainKey = key(*domainText, mode);
+	const auto matchingEntry = m_entryForKey.find(domainKey);
+
+	if (matchingEntry != m_entryForKey.end())
+	{
+		auto &entry = *matchingEntry->second;
+
+		if (entry.mode == mode && *entry.domainText == *domainText)
+		{
+			entry.unusedInstances.emplace_back(std::move(instance));
+			return;
+		}
+
+		// Replace domains with colliding hashes
+		m_entries.erase(matchingEntry->second);
+		m_entryForKey.erase(matchingEntry);
+	}
+
+	m_entries.emplace_front();
+	auto &entry = m_entries.front();
+	entry.domainText = std::move(domainText);
+	entry.mode = mode;
+	entry.unusedInstances.emplace_back(std::move(instance));
+	m_entryForKey.emplace(domainKey, m_entries.begin());
+
+	while (m_entries.size() > m_capacity)
+	{
+		m_entryForKey.erase(key(*m_entries.back().domainText, m_entries.back().mode));
+		m_entries.pop_back();
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
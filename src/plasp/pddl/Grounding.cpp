@@ -0,0 +1,951 @@
+#include <plasp/pddl/Grounding.h>
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <string>
+
+#include <pddl/NormalizedAST.h>
+
+#include <plasp/TranslatorException.h>
+
+#include <plasp/pddl/GroundFactSink.h>
+#include <plasp/pddl/StaticPredicates.h>
+
+namespace plasp
+{
+namespace pddl
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Grounding
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+using ConstantIDs = std::vector<size_t>;
+using GroundAtoms = std::vector<std::set<ConstantIDs>>;
+using VariableBinding = std::map<const ::pddl::normalizedAST::VariableDeclaration *, size_t>;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct TypeMembers
+{
+	std::vector<size_t> constantIDs;
+	std::vector<bool> containsConstant;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class Grounder
+{
+	public:
+		explicit Grounder(const ::pddl::normalizedAST::Description &description);
+
+		Grounding ground();
+		void translate(const Grounding &grounding, GroundFactSink &sink);
+
+	private:
+		const TypeMembers &typeMembers(const ::pddl::normalizedAST::VariableDeclaration &variableDeclaration);
+
+		ConstantIDs groundPredicate(const ::pddl::normalizedAST::Predicate &predicate, const VariableBinding &binding) const;
+		GroundArguments groundArguments(const ConstantIDs &constantIDs) const;
+		ConstantIDs constantIDs(const GroundArguments &groundArguments) const;
+		GroundAtom groundAtom(const ::pddl::normalizedAST::Predicate &predicate, const VariableBinding &binding) const;
+
+		template<class Callback>
+		void bindParameters(const ::pddl::normalizedAST::VariableDeclarations &parameters, size_t parameterIndex,
+			VariableBinding &binding, Callback callback);
+		template<class Callback>
+		void bindPreconditions(const std::vector<const ::pddl::normalizedAST::Predicate *> &predicates,
+			size_t predicateIndex, size_t lastReachedPredicateIndex,
+			const ::pddl::normalizedAST::VariableDeclarations &parameters, VariableBinding &binding, Callback callback);
+
+		bool isReached(size_t predicateID, const ConstantIDs &atom) const;
+		bool holds(const ::pddl::normalizedAST::Precondition &precondition, const VariableBinding &binding) const;
+		void applyEffect(const ::pddl::normalizedAST::Effect &effect, VariableBinding &binding, GroundAtoms &newAtoms);
+
+		void collectAtoms(const ::pddl::normalizedAST::Precondition &precondition, const VariableBinding &binding,
+			GroundAtoms &atoms) const;
+		void collectAtoms(const ::pddl::normalizedAST::Effect &effect, VariableBinding &binding, GroundAtoms &atoms);
+
+		void translateEffect(const ::pddl::normalizedAST::Action &action, const GroundArguments &arguments,
+			const ::pddl::normalizedAST::Effect &effect, VariableBinding &binding, size_t &numberOfConditionalEffects,
+			GroundFactSink &sink);
+
+		const ::pddl::normalizedAST::Description &m_description;
+
+		std::vector<const ::pddl::normalizedAST::ConstantDeclaration *> m_constants;
+		std::map<const ::pddl::normalizedAST::ConstantDeclaration *, size_t> m_constantIDs;
+		std::map<const ::pddl::normalizedAST::PredicateDeclaration *, size_t> m_predicateIDs;
+
+		std::map<std::string, TypeMembers> m_typeMembers;
+		std::map<const ::pddl::normalizedAST::VariableDeclaration *, const TypeMembers *> m_variableTypeMembers;
+
+		// Atoms reached before the last round of the fixpoint computation, and atoms reached in the last
+		// round only
+		GroundAtoms m_reachedAtoms;
+		GroundAtoms m_lastReachedAtoms;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const std::string &typeName(const std::experimental::optional<::pddl::ast::Type> &type)
+{
+	static const std::string objectTypeName = "object";
+
+	if (!type)
+		return objectTypeName;
+
+	if (!type.value().is<::pddl::normalizedAST::PrimitiveTypePointer>())
+		throw TranslatorException("only primitive types supported currently");
+
+	return type.value().get<::pddl::normalizedAST::PrimitiveTypePointer>()->declaration->name;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const ::pddl::normalizedAST::Predicate *predicate(const ::pddl::normalizedAST::Literal &literal, bool &isPositive)
+{
+	const auto handleAtomicFormula =
+		[&](const ::pddl::normalizedAST::AtomicFormula &atomicFormula) -> const ::pddl::normalizedAST::Predicate *
+		{
+			if (!atomicFormula.is<::pddl::normalizedAST::PredicatePointer>())
+				return nullptr;
+
+			return atomicFormula.get<::pddl::normalizedAST::PredicatePointer>().get();
+		};
+
+	if (literal.is<::pddl::normalizedAST::AtomicFormula>())
+	{
+		isPositive = true;
+		return handleAtomicFormula(literal.get<::pddl::normalizedAST::AtomicFormula>());
+	}
+
+	isPositive = false;
+	return handleAtomicFormula(literal.get<::pddl::normalizedAST::NotPointer<::pddl::normalizedAST::AtomicFormula>>()->argument);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<class Container, class Callback>
+void forEachLiteral(const Container &container, Callback callback)
+{
+	const auto handleLiteral =
+		[&](const ::pddl::normalizedAST::Literal &literal)
+		{
+			callback(literal);
+		};
+
+	const auto handleAnd =
+		[&](const ::pddl::normalizedAST::AndPointer<::pddl::normalizedAST::Literal> &and_)
+		{
+			for (const auto &argument : and_->arguments)
+				callback(argument);
+		};
+
+	container.match(handleLiteral, handleAnd);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Collects the predicates of the positive conditions of conditional effects, which are the only ones
+// that can make the conditional effects of known action instances apply later in the relaxation
+void collectConditionPredicates(const ::pddl::normalizedAST::Effect &effect,
+	std::set<const ::pddl::normalizedAST::PredicateDeclaration *> &predicates)
+{
+	const auto handleLiteral =
+		[](const ::pddl::normalizedAST::Literal &)
+		{
+		};
+
+	const auto handleAnd =
+		[&](const ::pddl::normalizedAST::AndPointer<::pddl::normalizedAST::Effect> &and_)
+		{
+			for (const auto &argument : and_->arguments)
+				collectConditionPredicates(argument, predicates);
+		};
+
+	const auto handleForAll =
+		[&](const ::pddl::normalizedAST::ForAllPointer<::pddl::normalizedAST::Effect> &forAll)
+		{
+			collectConditionPredicates(forAll->argument, predicates);
+		};
+
+	const auto handleWhen =
+		[&](const ::pddl::normalizedAST::WhenPointer<::pddl::normalizedAST::Precondition,
+			::pddl::normalizedAST::ConditionalEffect> &when)
+		{
+			forEachLiteral(when->argumentLeft,
+				[&](const ::pddl::normalizedAST::Literal &literal)
+				{
+					bool isPositive;
+					const auto *predicate = ::plasp::pddl::predicate(literal, isPositive);
+
+					if (predicate && isPositive)
+						predicates.insert(predicate->declaration);
+				});
+		};
+
+	effect.match(handleLiteral, handleAnd, handleForAll, handleWhen);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Grounder::Grounder(const ::pddl::normalizedAST::Description &description)
+:	m_description(description)
+{
+	if (!description.problem)
+		throw TranslatorException("grounding requires a problem description");
+
+	const auto &domain = description.domain;
+	const auto &problem = description.problem.value();
+
+	const auto addConstants =
+		[&](const auto &constants)
+		{
+			for (const auto &constant : constants)
+			{
+				m_constantIDs.emplace(constant.get(), m_constants.size());
+				m_constants.emplace_back(constant.get());
+			}
+		};
+
+	addConstants(domain->constants);
+	addConstants(problem->objects);
+
+	for (size_t i = 0; i < domain->predicates.size(); i++)
+		m_predicateIDs.emplace(domain->predicates[i].get(), i);
+
+	m_reachedAtoms.resize(domain->predicates.size());
+	m_lastReachedAtoms.resize(domain->predicates.size());
+
+	// A constant is of its declared type and of all the type’s ancestors, as with inherits/2
+	std::map<std::string, const ::pddl::normalizedAST::PrimitiveTypeDeclaration *> typeDeclarations;
+
+	for (const auto &type : domain->types)
+		typeDeclarations.emplace(type->name, type.get());
+
+	for (size_t constantID = 0; constantID < m_constants.size(); constantID++)
+	{
+		std::set<std::string> visitedTypeNames;
+		std::vector<std::string> typeNames = {typeName(m_constants[constantID]->type)};
+
+		while (!typeNames.empty())
+		{
+			const auto currentTypeName = std::move(typeNames.back());
+			typeNames.pop_back();
+
+			if (!visitedTypeNames.insert(currentTypeName).second)
+				continue;
+
+			auto &typeMembers = m_typeMembers[currentTypeName];
+			typeMembers.constantIDs.emplace_back(constantID);
+			typeMembers.containsConstant.resize(m_constants.size(), false);
+			typeMembers.containsConstant[constantID] = true;
+
+			const auto matchingTypeDeclaration = typeDeclarations.find(currentTypeName);
+
+			if (matchingTypeDeclaration == typeDeclarations.cend())
+				continue;
+
+			for (const auto &parentType : matchingTypeDeclaration->second->parentTypes)
+				typeNames.emplace_back(parentType->declaration->name);
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const TypeMembers &Grounder::typeMembers(const ::pddl::normalizedAST::VariableDeclaration &variableDeclaration)
+{
+	const auto matchingTypeMembers = m_variableTypeMembers.find(&variableDeclaration);
+
+	if (matchingTypeMembers != m_variableTypeMembers.cend())
+		return *matchingTypeMembers->second;
+
+	auto &typeMembers = m_typeMembers[typeName(variableDeclaration.type)];
+	typeMembers.containsConstant.resize(m_constants.size(), false);
+
+	m_variableTypeMembers.emplace(&variableDeclaration, &typeMembers);
+
+	return typeMembers;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+ConstantIDs Grounder::groundPredicate(const ::pddl::normalizedAST::Predicate &predicate, const VariableBinding &binding) const
+{
+	ConstantIDs constantIDs;
+	constantIDs.reserve(predicate.arguments.size());
+
+	for (const auto &argument : predicate.arguments)
+	{
+		if (argument.is<::pddl::normalizedAST::ConstantPointer>())
+			constantIDs.emplace_back(m_constantIDs.at(argument.get<::pddl::normalizedAST::ConstantPointer>()->declaration));
+		else
+			constantIDs.emplace_back(binding.at(argument.get<::pddl::normalizedAST::VariablePointer>()->declaration));
+	}
+
+	return constantIDs;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+GroundArguments Grounder::groundArguments(const ConstantIDs &constantIDs) const
+{
+	GroundArguments groundArguments;
+	groundArguments.reserve(constantIDs.size());
+
+	for (const auto constantID : constantIDs)
+		groundArguments.emplace_back(m_constants[constantID]);
+
+	return groundArguments;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+ConstantIDs Grounder::constantIDs(const GroundArguments &groundArguments) const
+{
+	ConstantIDs constantIDs;
+	constantIDs.reserve(groundArguments.size());
+
+	for (const auto *constant : groundArguments)
+		constantIDs.emplace_back(m_constantIDs.at(constant));
+
+	return constantIDs;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+GroundAtom Grounder::groundAtom(const ::pddl::normalizedAST::Predicate &predicate, const VariableBinding &binding) const
+{
+	return {predicate.declaration, groundArguments(groundPredicate(predicate, binding))};
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Binds the parameters that are not bound yet to all constants of matching types
+template<class Callback>
+void Grounder::bindParameters(const ::pddl::normalizedAST::VariableDeclarations &parameters, size_t parameterIndex,
+	VariableBinding &binding, Callback callback)
+{
+	if (parameterIndex == parameters.size())
+	{
+		callback();
+		return;
+	}
+
+	const auto *parameter = parameters[parameterIndex].get();
+
+	if (binding.find(parameter) != binding.cend())
+	{
+		bindParameters(parameters, parameterIndex + 1, binding, callback);
+		return;
+	}
+
+	for (const auto constantID : typeMembers(*parameter).constantIDs)
+	{
+		binding[parameter] = constantID;
+		bindParameters(parameters, parameterIndex + 1, binding, callback);
+	}
+
+	binding.erase(parameter);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Binds variables by joining the positive preconditions with the atoms reached so far, such that the
+// precondition at lastReachedPredicateIndex matches an atom reached in the last round (semi-naive
+// evaluation). The preconditions before it only match atoms reached earlier, so that each binding is
+// enumerated once
+template<class Callback>
+void Grounder::bindPreconditions(const std::vector<const ::pddl::normalizedAST::Predicate *> &predicates,
+	size_t predicateIndex, size_t lastReachedPredicateIndex,
+	const ::pddl::normalizedAST::VariableDeclarations &parameters, VariableBinding &binding, Callback callback)
+{
+	if (predicateIndex == predicates.size())
+	{
+		bindParameters(parameters, 0, binding, callback);
+		return;
+	}
+
+	const auto &predicate = *predicates[predicateIndex];
+	const auto &arguments = predicate.arguments;
+	const auto predicateID = m_predicateIDs.at(predicate.declaration);
+
+	std::vector<const ::pddl::normalizedAST::VariableDeclaration *> boundVariables;
+	boundVariables.reserve(arguments.size());
+
+	const auto bindAtom =
+		[&](const ConstantIDs &atom)
+		{
+			bool isMatching = true;
+
+			for (size_t i = 0; i < arguments.size() && isMatching; i++)
+			{
+				const auto &argument = arguments[i];
+
+				if (argument.is<::pddl::normalizedAST::ConstantPointer>())
+				{
+					isMatching = (m_constantIDs.at(argument.get<::pddl::normalizedAST::ConstantPointer>()->declaration) == atom[i]);
+					continue;
+				}
+
+				const auto *variable = argument.get<::pddl::normalizedAST::VariablePointer>()->declaration;
+				const auto matchingBinding = binding.find(variable);
+
+				if (matchingBinding != binding.cend())
+				{
+					isMatching = (matchingBinding->second == atom[i]);
+					continue;
+				}
+
+				isMatching = typeMembers(*variable).containsConstant[atom[i]];
+
+				if (isMatching)
+				{
+					binding.emplace(variable, atom[i]);
+					boundVariables.emplace_back(variable);
+				}
+			}
+
+			if (isMatching)
+				bindPreconditions(predicates, predicateIndex + 1, lastReachedPredicateIndex, parameters, binding, callback);
+
+			for (const auto *variable : boundVariables)
+				binding.erase(variable);
+
+			boundVariables.clear();
+		};
+
+	if (predicateIndex != lastReachedPredicateIndex)
+		for (const auto &atom : m_reachedAtoms[predicateID])
+			bindAtom(atom);
+
+	if (predicateIndex >= lastReachedPredicateIndex)
+		for (const auto &atom : m_lastReachedAtoms[predicateID])
+			bindAtom(atom);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool Grounder::isReached(size_t predicateID, const ConstantIDs &atom) const
+{
+	return m_reachedAtoms[predicateID].find(atom) != m_reachedAtoms[predicateID].cend()
+		|| m_lastReachedAtoms[predicateID].find(atom) != m_lastReachedAtoms[predicateID].cend();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool Grounder::holds(const ::pddl::normalizedAST::Precondition &precondition, const VariableBinding &binding) const
+{
+	bool result = true;
+
+	forEachLiteral(precondition,
+		[&](const ::pddl::normalizedAST::Literal &literal)
+		{
+			bool isPositive;
+			const auto *predicate = ::plasp::pddl::predicate(literal, isPositive);
+
+			if (!result || !predicate || !isPositive)
+				return;
+
+			result = isReached(m_predicateIDs.at(predicate->declaration), groundPredicate(*predicate, binding));
+		});
+
+	return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void Grounder::applyEffect(const ::pddl::normalizedAST::Effect &effect, VariableBinding &binding, GroundAtoms &newAtoms)
+{
+	const auto handleLiteral =
+		[&](const ::pddl::normalizedAST::Literal &literal)
+		{
+			bool isPositive;
+			const auto *predicate = ::plasp::pddl::predicate(literal, isPositive);
+
+			// Delete effects are ignored in the relaxation
+			if (!predicate || !isPositive)
+				return;
+
+			const auto predicateID = m_predicateIDs.at(predicate->declaration);
+			auto atom = groundPredicate(*predicate, binding);
+
+			if (!isReached(predicateID, atom))
+				newAtoms[predicateID].emplace(std::move(atom));
+		};
+
+	const auto handleAnd =
+		[&](const ::pddl::normalizedAST::AndPointer<::pddl::normalizedAST::Effect> &and_)
+		{
+			for (const auto &argument : and_->arguments)
+				applyEffect(argument, binding, newAtoms);
+		};
+
+	const auto handleForAll =
+		[&](const ::pddl::normalizedAST::ForAllPointer<::pddl::normalizedAST::Effect> &forAll)
+		{
+			bindParameters(forAll->parameters, 0, binding,
+				[&]()
+				{
+					applyEffect(forAll->argument, binding, newAtoms);
+				});
+		};
+
+	const auto handleWhen =
+		[&](const ::pddl::normalizedAST::WhenPointer<::pddl::normalizedAST::Precondition,
+			::pddl::normalizedAST::ConditionalEffect> &when)
+		{
+			if (!holds(when->argumentLeft, binding))
+				return;
+
+			forEachLiteral(when->argumentRight, handleLiteral);
+		};
+
+	effect.match(handleLiteral, handleAnd, handleForAll, handleWhen);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void Grounder::collectAtoms(const ::pddl::normalizedAST::Precondition &precondition, const VariableBinding &binding,
+	GroundAtoms &atoms) const
+{
+	forEachLiteral(precondition,
+		[&](const ::pddl::normalizedAST::Literal &literal)
+		{
+			bool isPositive;
+			const auto *predicate = ::plasp::pddl::predicate(literal, isPositive);
+
+			if (predicate)
+				atoms[m_predicateIDs.at(predicate->declaration)].emplace(groundPredicate(*predicate, binding));
+		});
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void Grounder::collectAtoms(const ::pddl::normalizedAST::Effect &effect, VariableBinding &binding, GroundAtoms &atoms)
+{
+	const auto handleLiteral =
+		[&](const ::pddl::normalizedAST::Literal &literal)
+		{
+			bool isPositive;
+			const auto *predicate = ::plasp::pddl::predicate(literal, isPositive);
+
+			if (predicate)
+				atoms[m_predicateIDs.at(predicate->declaration)].emplace(groundPredicate(*predicate, binding));
+		};
+
+	const auto handleAnd =
+		[&](const ::pddl::normalizedAST::AndPointer<::pddl::normalizedAST::Effect> &and_)
+		{
+			for (const auto &argument : and_->arguments)
+				collectAtoms(argument, binding, atoms);
+		};
+
+	const auto handleForAll =
+		[&](const ::pddl::normalizedAST::ForAllPointer<::pddl::normalizedAST::Effect> &forAll)
+		{
+			bindParameters(forAll->parameters, 0, binding,
+				[&]()
+				{
+					collectAtoms(forAll->argument, binding, atoms);
+				});
+		};
+
+	const auto handleWhen =
+		[&](const ::pddl::normalizedAST::WhenPointer<::pddl::normalizedAST::Precondition,
+			::pddl::normalizedAST::ConditionalEffect> &when)
+		{
+			collectAtoms(when->argumentLeft, binding, atoms);
+			forEachLiteral(when->argumentRight, handleLiteral);
+		};
+
+	effect.match(handleLiteral, handleAnd, handleForAll, handleWhen);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Grounding Grounder::ground()
+{
+	const auto &domain = m_description.domain;
+	const auto &problem = m_description.problem.value();
+	const auto &actions = domain->actions;
+
+	for (const auto &fact : problem->initialState.facts)
+	{
+		bool isPositive;
+		const auto *predicate = ::plasp::pddl::predicate(fact, isPositive);
+
+		if (predicate && isPositive)
+			m_lastReachedAtoms[m_predicateIDs.at(predicate->declaration)].emplace(groundPredicate(*predicate, {}));
+	}
+
+	// Only positive preconditions constrain the instances in the relaxation, except for negative
+	// preconditions on static predicates, which keep their initial values
+	const auto staticPredicates = detectStaticPredicates(*domain);
+
+	std::vector<std::vector<const ::pddl::normalizedAST::Predicate *>> positivePreconditions(actions.size());
+	std::vector<std::vector<const ::pddl::normalizedAST::Predicate *>> negativeStaticPreconditions(actions.size());
+
+	for (size_t actionID = 0; actionID < actions.size(); actionID++)
+	{
+		const auto &action = *actions[actionID];
+
+		if (!action.precondition)
+			continue;
+
+		forEachLiteral(action.precondition.value(),
+			[&](const ::pddl::normalizedAST::Literal &literal)
+			{
+				bool isPositive;
+				const auto *predicate = ::plasp::pddl::predicate(literal, isPositive);
+
+				if (!predicate)
+					return;
+
+				if (isPositive)
+					positivePreconditions[actionID].emplace_back(predicate);
+				else if (staticPredicates.find(predicate->declaration) != staticPredicates.cend())
+					negativeStaticPreconditions[actionID].emplace_back(predicate);
+			});
+	}
+
+	std::vector<std::set<ConstantIDs>> actionInstances(actions.size());
+
+	const auto bindActionParameters =
+		[&](size_t actionID, VariableBinding &binding) -> ConstantIDs
+		{
+			const auto &parameters = actions[actionID]->parameters;
+
+			ConstantIDs constantIDs;
+			constantIDs.reserve(parameters.size());
+
+			for (const auto &parameter : parameters)
+				constantIDs.emplace_back(binding.at(parameter.get()));
+
+			return constantIDs;
+		};
+
+	std::vector<std::vector<size_t>> conditionPredicateIDs(actions.size());
+
+	for (size_t actionID = 0; actionID < actions.size(); actionID++)
+	{
+		if (!actions[actionID]->effect)
+			continue;
+
+		std::set<const ::pddl::normalizedAST::PredicateDeclaration *> conditionPredicates;
+		collectConditionPredicates(actions[actionID]->effect.value(), conditionPredicates);
+
+		for (const auto *predicate : conditionPredicates)
+			conditionPredicateIDs[actionID].emplace_back(m_predicateIDs.at(predicate));
+	}
+
+	const auto applyActionInstance =
+		[&](size_t actionID, VariableBinding &binding, GroundAtoms &newAtoms)
+		{
+			const auto &action = *actions[actionID];
+
+			for (const auto *predicate : negativeStaticPreconditions[actionID])
+				if (isReached(m_predicateIDs.at(predicate->declaration), groundPredicate(*predicate, binding)))
+					return;
+
+			// The effects of known instances cannot reach new atoms, except for conditional effects,
+			// which are applied again below
+			if (actionInstances[actionID].emplace(bindActionParameters(actionID, binding)).second && action.effect)
+				applyEffect(action.effect.value(), binding, newAtoms);
+		};
+
+	// Apply the effects of all applicable action instances until no new atoms are reached. Only
+	// instances with a precondition reached in the last round can be new, except for instances of
+	// actions without positive preconditions, which are all found in the first round
+	for (bool isFirstRound = true; ; isFirstRound = false)
+	{
+		GroundAtoms newAtoms(m_reachedAtoms.size());
+
+		// The conditions of conditional effects may only hold in later rounds than the instances are
+		// found, but only if atoms of the conditions were reached in the last round
+		for (size_t actionID = 0; actionID < actions.size(); actionID++)
+		{
+			const auto &predicateIDs = conditionPredicateIDs[actionID];
+
+			if (std::none_of(predicateIDs.cbegin(), predicateIDs.cend(),
+				[&](const auto predicateID){return !m_lastReachedAtoms[predicateID].empty();}))
+			{
+				continue;
+			}
+
+			const auto &action = *actions[actionID];
+
+			for (const auto &constantIDs : actionInstances[actionID])
+			{
+				VariableBinding binding;
+
+				for (size_t i = 0; i < constantIDs.size(); i++)
+					binding.emplace(action.parameters[i].get(), constantIDs[i]);
+
+				applyEffect(action.effect.value(), binding, newAtoms);
+			}
+		}
+
+		for (size_t actionID = 0; actionID < actions.size(); actionID++)
+		{
+			const auto &action = *actions[actionID];
+			const auto &preconditions = positivePreconditions[actionID];
+
+			VariableBinding binding;
+
+			if (preconditions.empty() && isFirstRound)
+				bindParameters(action.parameters, 0, binding,
+					[&]()
+					{
+						applyActionInstance(actionID, binding, newAtoms);
+					});
+
+			for (size_t lastReachedPredicateIndex = 0; lastReachedPredicateIndex < preconditions.size();
+				lastReachedPredicateIndex++)
+			{
+				bindPreconditions(preconditions, 0, lastReachedPredicateIndex, action.parameters, binding,
+					[&]()
+					{
+						applyActionInstance(actionID, binding, newAtoms);
+					});
+			}
+		}
+
+		bool hasNewAtoms = false;
+
+		for (size_t predicateID = 0; predicateID < newAtoms.size(); predicateID++)
+		{
+			hasNewAtoms |= !newAtoms[predicateID].empty();
+			m_reachedAtoms[predicateID].insert(m_lastReachedAtoms[predicateID].cbegin(),
+				m_lastReachedAtoms[predicateID].cend());
+			m_lastReachedAtoms[predicateID] = std::move(newAtoms[predicateID]);
+		}
+
+		if (!hasNewAtoms)
+			break;
+	}
+
+	Grounding grounding;
+	grounding.actions.resize(actions.size());
+
+	for (size_t actionID = 0; actionID < actions.size(); actionID++)
+		for (const auto &constantIDs : actionInstances[actionID])
+			grounding.actions[actionID].emplace_back(groundArguments(constantIDs));
+
+	// Derived predicates are translated as lifted rules, which may refer to any predicate instance
+	if (!domain->derivedPredicates.empty() || !problem->derivedPredicates.empty())
+		return grounding;
+
+	// Besides the reachable atoms, the variables comprise all atoms that reachable action
+	// instances and the goal refer to, such as atoms in negative preconditions
+	auto atoms = m_reachedAtoms;
+
+	for (size_t actionID = 0; actionID < actions.size(); actionID++)
+	{
+		const auto &action = *actions[actionID];
+
+		for (const auto &constantIDs : actionInstances[actionID])
+		{
+			VariableBinding binding;
+
+			for (size_t i = 0; i < constantIDs.size(); i++)
+				binding.emplace(action.parameters[i].get(), constantIDs[i]);
+
+			if (action.precondition)
+				collectAtoms(action.precondition.value(), binding, atoms);
+
+			if (action.effect)
+				collectAtoms(action.effect.value(), binding, atoms);
+		}
+	}
+
+	if (problem->goal)
+		collectAtoms(problem->goal.value(), {}, atoms);
+
+	grounding.predicates.resize(atoms.size());
+	grounding.hasGroundPredicates = true;
+
+	for (size_t predicateID = 0; predicateID < atoms.size(); predicateID++)
+		for (const auto &constantIDs : atoms[predicateID])
+			grounding.predicates[predicateID].emplace_back(groundArguments(constantIDs));
+
+	return grounding;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void Grounder::translateEffect(const ::pddl::normalizedAST::Action &action, const GroundArguments &arguments,
+	const ::pddl::normalizedAST::Effect &effect, VariableBinding &binding, size_t &numberOfConditionalEffects,
+	GroundFactSink &sink)
+{
+	const auto handleLiteral =
+		[&](const ::pddl::normalizedAST::Literal &literal)
+		{
+			bool isPositive;
+			const auto *predicate = ::plasp::pddl::predicate(literal, isPositive);
+
+			if (predicate)
+				sink.postcondition(action, arguments, GroundFactSink::UnconditionalEffect, groundAtom(*predicate, binding),
+					isPositive);
+		};
+
+	const auto handleAnd =
+		[&](const ::pddl::normalizedAST::AndPointer<::pddl::normalizedAST::Effect> &and_)
+		{
+			for (const auto &argument : and_->arguments)
+				translateEffect(action, arguments, argument, binding, numberOfConditionalEffects, sink);
+		};
+
+	const auto handleForAll =
+		[&](const ::pddl::normalizedAST::ForAllPointer<::pddl::normalizedAST::Effect> &forAll)
+		{
+			bindParameters(forAll->parameters, 0, binding,
+				[&]()
+				{
+					translateEffect(action, arguments, forAll->argument, binding, numberOfConditionalEffects, sink);
+				});
+		};
+
+	// Each instance of a conditional effect is a separate conditional effect
+	const auto handleWhen =
+		[&](const ::pddl::normalizedAST::WhenPointer<::pddl::normalizedAST::Precondition,
+			::pddl::normalizedAST::ConditionalEffect> &when)
+		{
+			const auto effectID = numberOfConditionalEffects++;
+
+			forEachLiteral(when->argumentLeft,
+				[&](const ::pddl::normalizedAST::Literal &literal)
+				{
+					bool isPositive;
+					const auto *predicate = ::plasp::pddl::predicate(literal, isPositive);
+
+					if (predicate)
+						sink.effectCondition(effectID, groundAtom(*predicate, binding), isPositive);
+				});
+
+			forEachLiteral(when->argumentRight,
+				[&](const ::pddl::normalizedAST::Literal &literal)
+				{
+					bool isPositive;
+					const auto *predicate = ::plasp::pddl::predicate(literal, isPositive);
+
+					if (predicate)
+						sink.postcondition(action, arguments, effectID, groundAtom(*predicate, binding), isPositive);
+				});
+		};
+
+	effect.match(handleLiteral, handleAnd, handleForAll, handleWhen);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void Grounder::translate(const Grounding &grounding, GroundFactSink &sink)
+{
+	if (!grounding.hasGroundPredicates)
+		throw TranslatorException("ground facts are only available for descriptions without derived predicates");
+
+	const auto &domain = m_description.domain;
+	const auto &problem = m_description.problem.value();
+	const auto &predicates = domain->predicates;
+	const auto &actions = domain->actions;
+
+	for (size_t predicateID = 0; predicateID < predicates.size(); predicateID++)
+		for (const auto &groundArguments : grounding.predicates[predicateID])
+			sink.variable({predicates[predicateID].get(), groundArguments});
+
+	size_t numberOfConditionalEffects = 0;
+
+	for (size_t actionID = 0; actionID < actions.size(); actionID++)
+	{
+		const auto &action = *actions[actionID];
+
+		for (const auto &groundArguments : grounding.actions[actionID])
+		{
+			const auto actionConstantIDs = constantIDs(groundArguments);
+
+			VariableBinding binding;
+
+			for (size_t i = 0; i < actionConstantIDs.size(); i++)
+				binding.emplace(action.parameters[i].get(), actionConstantIDs[i]);
+
+			sink.action(action, groundArguments);
+
+			if (action.precondition)
+				forEachLiteral(action.precondition.value(),
+					[&](const ::pddl::normalizedAST::Literal &literal)
+					{
+						bool isPositive;
+						const auto *predicate = ::plasp::pddl::predicate(literal, isPositive);
+
+						if (predicate)
+							sink.precondition(action, groundArguments, groundAtom(*predicate, binding), isPositive);
+					});
+
+			if (action.effect)
+				translateEffect(action, groundArguments, action.effect.value(), binding, numberOfConditionalEffects, sink);
+		}
+	}
+
+	// As with the text output, variables are false unless stated to be true
+	GroundAtoms initialAtoms(predicates.size());
+
+	for (const auto &fact : problem->initialState.facts)
+	{
+		bool isPositive;
+		const auto *predicate = ::plasp::pddl::predicate(fact, isPositive);
+
+		if (predicate && isPositive)
+			initialAtoms[m_predicateIDs.at(predicate->declaration)].emplace(groundPredicate(*predicate, {}));
+	}
+
+	for (size_t predicateID = 0; predicateID < predicates.size(); predicateID++)
+	{
+		const auto &atoms = initialAtoms[predicateID];
+
+		for (const auto &groundArguments : grounding.predicates[predicateID])
+			sink.initialState({predicates[predicateID].get(), groundArguments},
+				atoms.find(constantIDs(groundArguments)) != atoms.cend());
+	}
+
+	if (problem->goal)
+		forEachLiteral(problem->goal.value(),
+			[&](const ::pddl::normalizedAST::Literal &literal)
+			{
+				bool isPositive;
+				const auto *predicate = ::plasp::pddl::predicate(literal, isPositive);
+
+				if (predicate)
+					sink.goal(groundAtom(*predicate, {}), isPositive);
+			});
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Grounding groundReachableInstances(const ::pddl::normalizedAST::Description &description)
+{
+	return Grounder(description).ground();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void translateGrounding(const ::pddl::normalizedAST::Description &description, const Grounding &grounding,
+	GroundFactSink &sink)
+{
+	Grounder(description).translate(grounding, sink);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
@@ -0,0 +1,458 @@
+#include <plasp/pddl/IncrementalTranslatorASP.h>
+
+#include <algorithm>
+#include <cctype>
+#include <limits>
+#include <sstream>
+#include <unordered_map>
+#include <utility>
+
+#include <colorlog/ColorStream.h>
+#include <colorlog/Formatting.h>
+
+#include <pddl/detail/normalization/Action.h>
+#include <pddl/detail/normalization/Domain.h>
+#include <pddl/detail/normalization/NormalizationContext.h>
+#include <pddl/detail/normalization/Problem.h>
+#include <pddl/detail/parsing/Action.h>
+#include <pddl/detail/parsing/Description.h>
+#include <pddl/detail/parsing/Problem.h>
+
+#include <plasp/pddl/TranslatorASP.h>
+#include <plasp/pddl/translation/Action.h>
+#include <plasp/pddl/translation/Effect.h>
+
+namespace plasp
+{
+namespace pddl
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// IncrementalTranslatorASP
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Marks actions that have not been translated yet
+constexpr auto UntranslatedAction = std::numeric_limits<std::size_t>::max();
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Whitespace between sections does not affect the parsed description, so it is ignored when
+// comparing versions
+void appendTrimmed(std::string &text, const std::string &content, std::size_t begin, std::size_t end)
+{
+	while (begin < end && std::isspace(static_cast<unsigned char>(content[begin])))
+		begin++;
+
+	while (end > begin && std::isspace(static_cast<unsigned char>(content[end - 1])))
+		end--;
+
+	if (begin == end)
+		return;
+
+	text.append(content, begin, end - begin);
+	text.push_back(' ');
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<class Translate>
+std::string render(Translate translate)
+{
+	std::ostringstream outputStream;
+
+	{
+		colorlog::ColorStream colorStream(outputStream);
+		colorStream.setColorPolicy(colorlog::ColorStream::ColorPolicy::Never);
+
+		translate(colorStream);
+	}
+
+	return outputStream.str();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+IncrementalTranslatorASP::Update IncrementalTranslatorASP::update(::pddl::Context &context)
+{
+	::pddl::detail::DescriptionParser descriptionParser(context);
+	descriptionParser.findSections();
+	descriptionParser.seekDomain();
+
+	::pddl::detail::DomainParser domainParser(context);
+	domainParser.findSections();
+
+	// Split the input into the action sections, the rest of the domain, and everything else, which
+	// belongs to the problem
+	const auto &content = context.tokenizer.content();
+	const auto &extent = domainParser.extent();
+	const auto &actionSections = domainParser.actionSections();
+
+	std::string declarationsText;
+	std::vector<std::string> actionTexts;
+	actionTexts.reserve(actionSections.size());
+
+	auto position = extent.begin;
+
+	for (const auto &actionSection : actionSections)
+	{
+		appendTrimmed(declarationsText, content, position, actionSection.begin);
+		actionTexts.emplace_back(content, actionSection.begin, actionSection.end - actionSection.begin);
+		position = actionSection.end;
+	}
+
+	appendTrimmed(declarationsText, content, position, extent.end);
+
+	std::string problemText;
+	appendTrimmed(problemText, content, 0, extent.begin);
+	appendTrimmed(problemText, content, extent.end, content.size());
+
+	if (!m_description.domain || declarationsText != m_declarationsText)
+		return translateCompletely(context, descriptionParser, std::move(declarationsText),
+			std::move(actionTexts), std::move(problemText));
+
+	Update update;
+
+	if (!updateActions(context, actionSections, actionTexts, update))
+		return translateCompletely(context, descriptionParser, std::move(declarationsText),
+			std::move(actionTexts), std::move(problemText));
+
+	updateProblem(context, descriptionParser, std::move(problemText), update);
+
+	return update;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void IncrementalTranslatorASP::write(std::ostream &outputStream) const
+{
+	outputStream << m_declarationsOutput;
+
+	if (!m_actions.empty())
+	{
+		outputStream << render(
+			[](auto &colorStream)
+			{
+				colorStream << std::endl << colorlog::Heading2("actions");
+			});
+
+		for (const auto &action : m_actions)
+			outputStream << action.output;
+	}
+
+	outputStream << m_problemOutput;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t IncrementalTranslatorASP::numberOfActions() const
+{
+	return m_actions.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+IncrementalTranslatorASP::Update IncrementalTranslatorASP::translateCompletely(::pddl::Context &context,
+	::pddl::detail::DescriptionParser &descriptionParser, std::string &&declarationsText,
+	std::vector<std::string> &&actionTexts, std::string &&problemText)
+{
+	descriptionParser.seekDomain();
+
+	auto domain = ::pddl::detail::DomainParser(context).parse();
+	const auto numberOfDomainTypes = domain->types.size();
+
+	::pddl::ast::ProblemPointer problem;
+
+	if (descriptionParser.hasProblem())
+	{
+		descriptionParser.seekProblem();
+		problem = ::pddl::detail::ProblemParser(context, *domain).parse();
+	}
+
+	// Only replace the previous version once everything is parsed
+	m_description.problem = std::experimental::nullopt;
+	m_description.domain = ::pddl::detail::normalize(std::move(domain));
+	m_domain = std::move(domain);
+	m_domain->name = m_description.domain->name;
+	m_numberOfDomainTypes = numberOfDomainTypes;
+
+	if (problem)
+		m_description.problem = ::pddl::detail::normalize(std::move(problem), m_description.domain.get());
+
+	m_declarationsText = std::move(declarationsText);
+	m_problemText = std::move(problemText);
+	m_isProblemCurrent = true;
+
+	m_actions.clear();
+	m_actions.reserve(actionTexts.size());
+
+	for (auto &actionText : actionTexts)
+		m_actions.push_back({std::move(actionText), UntranslatedAction, {}});
+
+	translateDeclarations();
+	translateActions();
+	translateProblem();
+
+	Update update;
+	update.isComplete = true;
+	update.numberOfParsedActions = m_actions.size();
+	update.isProblemParsed = static_cast<bool>(m_description.problem);
+
+	return update;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool IncrementalTranslatorASP::updateActions(::pddl::Context &context,
+	const std::vector<::pddl::detail::DomainParser::Section> &actionSections,
+	std::vector<std::string> &actionTexts, Update &update)
+{
+	auto &normalizedDomain = *m_description.domain;
+
+	const auto isUnchanged = (actionTexts.size() == m_actions.size())
+		&& std::equal(actionTexts.cbegin(), actionTexts.cend(), m_actions.cbegin(),
+			[](const auto &actionText, const auto &action)
+			{
+				return actionText == action.text;
+			});
+
+	if (isUnchanged)
+		return true;
+
+	// Derived predicates are numbered across all actions, and types declared by the problem in
+	// compatibility mode could be looked up by the actions
+	if (!normalizedDomain.derivedPredicates.empty() || normalizedDomain.types.size() != m_numberOfDomainTypes)
+		return false;
+
+	// Unchanged actions are kept even if they moved, and the others are parsed
+	std::unordered_map<std::string, std::vector<std::size_t>> previousActionIDs;
+
+	for (std::size_t i = m_actions.size(); i-- > 0;)
+		previousActionIDs[m_actions[i].text].emplace_back(i);
+
+	constexpr auto NoPreviousAction = std::numeric_limits<std::size_t>::max();
+	std::vector<std::size_t> previousActionIDForAction(actionTexts.size(), NoPreviousAction);
+	std::vector<std::size_t> changedActionIDs;
+
+	for (std::size_t i = 0; i < actionTexts.size(); i++)
+	{
+		auto matchingActions = previousActionIDs.find(actionTexts[i]);
+
+		if (matchingActions == previousActionIDs.end() || matchingActions->second.empty())
+		{
+			changedActionIDs.emplace_back(i);
+			continue;
+		}
+
+		previousActionIDForAction[i] = matchingActions->second.back();
+		matchingActions->second.pop_back();
+	}
+
+	// Parse the changed actions before anything is replaced, so that the previous version is kept if
+	// parsing fails
+	std::vector<::pddl::normalizedAST::ActionPointer> parsedActions;
+	parsedActions.reserve(changedActionIDs.size());
+
+	::pddl::normalizedAST::DerivedPredicateDeclarations derivedPredicates;
+	::pddl::detail::NormalizationContext normalizationContext(derivedPredicates);
+
+	swapDeclarations();
+
+	const auto numberOfTypes = m_domain->types.size();
+
+	try
+	{
+		for (const auto actionID : changedActionIDs)
+		{
+			context.tokenizer.seek(actionSections[actionID].begin);
+			auto action = ::pddl::detail::ActionParser(context, *m_domain).parse();
+			parsedActions.emplace_back(::pddl::detail::normalize(std::move(action), normalizationContext));
+		}
+	}
+	catch (...)
+	{
+		m_domain->types.resize(numberOfTypes);
+		swapDeclarations();
+		throw;
+	}
+
+	const auto declaresTypes = (m_domain->types.size() != numberOfTypes);
+
+	m_domain->types.resize(numberOfTypes);
+	swapDeclarations();
+
+	if (declaresTypes || !derivedPredicates.empty())
+		return false;
+
+	::pddl::normalizedAST::Actions actions;
+	actions.reserve(actionTexts.size());
+
+	std::vector<Action> actionStates;
+	actionStates.reserve(actionTexts.size());
+
+	auto parsedAction = parsedActions.begin();
+
+	for (std::size_t i = 0; i < actionTexts.size(); i++)
+	{
+		const auto previousActionID = previousActionIDForAction[i];
+
+		if (previousActionID == NoPreviousAction)
+		{
+			actions.emplace_back(std::move(*parsedAction));
+			parsedAction++;
+			actionStates.push_back({std::move(actionTexts[i]), UntranslatedAction, {}});
+			continue;
+		}
+
+		actions.emplace_back(std::move(normalizedDomain.actions[previousActionID]));
+		actionStates.emplace_back(std::move(m_actions[previousActionID]));
+	}
+
+	normalizedDomain.actions = std::move(actions);
+	m_actions = std::move(actionStates);
+
+	translateActions();
+
+	update.numberOfParsedActions = changedActionIDs.size();
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void IncrementalTranslatorASP::updateProblem(::pddl::Context &context,
+	::pddl::detail::DescriptionParser &descriptionParser, std::string &&problemText, Update &update)
+{
+	if (m_isProblemCurrent && problemText == m_problemText)
+		return;
+
+	auto &normalizedDomain = *m_description.domain;
+
+	// The previous problem is discarded before the types that it declared are removed
+	m_description.problem = std::experimental::nullopt;
+	m_isProblemCurrent = false;
+	normalizedDomain.types.resize(m_numberOfDomainTypes);
+
+	if (descriptionParser.hasProblem())
+	{
+		descriptionParser.seekProblem();
+
+		::pddl::ast::ProblemPointer problem;
+
+		swapDeclarations();
+
+		try
+		{
+			problem = ::pddl::detail::ProblemParser(context, *m_domain).parse();
+		}
+		catch (...)
+		{
+			m_domain->types.resize(m_numberOfDomainTypes);
+			swapDeclarations();
+			throw;
+		}
+
+		swapDeclarations();
+
+		m_description.problem = ::pddl::detail::normalize(std::move(problem), &normalizedDomain);
+	}
+
+	m_problemText = std::move(problemText);
+	m_isProblemCurrent = true;
+
+	// Types declared by the previous or the current problem appear in the domain’s translation
+	if (m_numberOfTranslatedTypes != m_numberOfDomainTypes || normalizedDomain.types.size() != m_numberOfDomainTypes)
+		translateDeclarations();
+
+	translateProblem();
+
+	update.isProblemParsed = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void IncrementalTranslatorASP::swapDeclarations()
+{
+	auto &normalizedDomain = *m_description.domain;
+
+	std::swap(m_domain->types, normalizedDomain.types);
+	std::swap(m_domain->constants, normalizedDomain.constants);
+	std::swap(m_domain->predicates, normalizedDomain.predicates);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void IncrementalTranslatorASP::translateDeclarations()
+{
+	m_declarationsOutput = render(
+		[&](auto &colorStream)
+		{
+			TranslatorASP(m_description, colorStream).translateDomainDeclarations();
+		});
+
+	m_numberOfTranslatedTypes = m_description.domain->types.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void IncrementalTranslatorASP::translateActions()
+{
+	const auto &actions = m_description.domain->actions;
+
+	// Conditional effects are numbered consecutively across all actions, so actions following a
+	// changed one are translated again if their first conditional effect ID changed
+	std::size_t numberOfConditionalEffects{0};
+
+	for (std::size_t i = 0; i < actions.size(); i++)
+	{
+		const auto &action = *actions[i];
+		auto &actionState = m_actions[i];
+
+		if (actionState.conditionalEffectIDOffset != numberOfConditionalEffects)
+		{
+			actionState.conditionalEffectIDOffset = numberOfConditionalEffects;
+			actionState.output = render(
+				[&](auto &colorStream)
+				{
+					auto conditionalEffectID = actionState.conditionalEffectIDOffset;
+					translateAction(colorStream, action, conditionalEffectID);
+				});
+		}
+
+		if (action.effect)
+			numberOfConditionalEffects += countConditionalEffects(action.effect.value());
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void IncrementalTranslatorASP::translateProblem()
+{
+	if (!m_description.problem)
+	{
+		m_problemOutput.clear();
+		return;
+	}
+
+	m_problemOutput = render(
+		[&](auto &colorStream)
+		{
+			colorStream << std::endl;
+			TranslatorASP(m_description, colorStream).translateProblem();
+		});
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
@@ -0,0 +1,622 @@
+#include <plasp/pddl/InvariantSynthesis.h>
+
+#include <algorithm>
+#include <deque>
+#include <map>
+#include <set>
+
+#include <pddl/NormalizedAST.h>
+
+#include <plasp/pddl/StaticPredicates.h>
+
+namespace plasp
+{
+namespace pddl
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// InvariantSynthesis
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+// Bounds the number of candidates examined, as the refinement may explode on large domains
+constexpr size_t MaximumNumberOfCandidates = 10000;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Action parameters and constants are identified by their declarations
+using Term = const void *;
+
+struct Atom
+{
+	const ::pddl::normalizedAST::PredicateDeclaration *predicate;
+	std::vector<Term> arguments;
+
+	bool operator==(const Atom &other) const
+	{
+		return predicate == other.predicate && arguments == other.arguments;
+	}
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct ActionSummary
+{
+	std::vector<Atom> positivePreconditions;
+	std::vector<Atom> negativePreconditions;
+	std::vector<Atom> addEffects;
+	std::vector<Atom> deleteEffects;
+	// Add effects under conditions or universal quantifiers, which the checks do not support
+	std::set<const ::pddl::normalizedAST::PredicateDeclaration *> complexAddEffectPredicates;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Candidates map the predicates of their parts to the argument positions of the parameters
+struct Candidate
+{
+	size_t numberOfParameters;
+	std::map<const ::pddl::normalizedAST::PredicateDeclaration *, std::vector<size_t>> parts;
+
+	bool operator<(const Candidate &other) const
+	{
+		if (numberOfParameters != other.numberOfParameters)
+			return numberOfParameters < other.numberOfParameters;
+
+		return parts < other.parts;
+	}
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Atom makeAtom(const ::pddl::normalizedAST::Predicate &predicate)
+{
+	Atom atom{predicate.declaration, {}};
+	atom.arguments.reserve(predicate.arguments.size());
+
+	for (const auto &argument : predicate.arguments)
+	{
+		if (argument.is<::pddl::normalizedAST::ConstantPointer>())
+			atom.arguments.emplace_back(argument.get<::pddl::normalizedAST::ConstantPointer>()->declaration);
+		else
+			atom.arguments.emplace_back(argument.get<::pddl::normalizedAST::VariablePointer>()->declaration);
+	}
+
+	return atom;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Calls the callback with the predicate and sign of the literal, skipping derived predicates
+template<class Callback>
+void handleLiteral(const ::pddl::normalizedAST::Literal &literal, Callback callback)
+{
+	const auto isPositive = literal.is<::pddl::normalizedAST::AtomicFormula>();
+	const auto &atomicFormula = isPositive
+		? literal.get<::pddl::normalizedAST::AtomicFormula>()
+		: literal.get<::pddl::normalizedAST::NotPointer<::pddl::normalizedAST::AtomicFormula>>()->argument;
+
+	if (atomicFormula.is<::pddl::normalizedAST::PredicatePointer>())
+		callback(*atomicFormula.get<::pddl::normalizedAST::PredicatePointer>(), isPositive);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void summarizeEffect(const ::pddl::normalizedAST::Effect &effect, bool isComplex, ActionSummary &actionSummary)
+{
+	const auto handleEffectLiteral =
+		[&](const ::pddl::normalizedAST::Literal &literal)
+		{
+			handleLiteral(literal,
+				[&](const ::pddl::normalizedAST::Predicate &predicate, bool isPositive)
+				{
+					if (isComplex)
+					{
+						if (isPositive)
+							actionSummary.complexAddEffectPredicates.insert(predicate.declaration);
+
+						return;
+					}
+
+					if (isPositive)
+						actionSummary.addEffects.emplace_back(makeAtom(predicate));
+					else
+						actionSummary.deleteEffects.emplace_back(makeAtom(predicate));
+				});
+		};
+
+	const auto handleAnd =
+		[&](const ::pddl::normalizedAST::AndPointer<::pddl::normalizedAST::Effect> &and_)
+		{
+			for (const auto &argument : and_->arguments)
+				summarizeEffect(argument, isComplex, actionSummary);
+		};
+
+	const auto handleForAll =
+		[&](const ::pddl::normalizedAST::ForAllPointer<::pddl::normalizedAST::Effect> &forAll)
+		{
+			summarizeEffect(forAll->argument, true, actionSummary);
+		};
+
+	const auto handleWhen =
+		[&](const ::pddl::normalizedAST::WhenPointer<::pddl::normalizedAST::Precondition,
+			::pddl::normalizedAST::ConditionalEffect> &when)
+		{
+			const auto handleConditionalEffectLiteral =
+				[&](const ::pddl::normalizedAST::Literal &literal)
+				{
+					handleLiteral(literal,
+						[&](const ::pddl::normalizedAST::Predicate &predicate, bool isPositive)
+						{
+							if (isPositive)
+								actionSummary.complexAddEffectPredicates.insert(predicate.declaration);
+						});
+				};
+
+			const auto handleConditionalEffectAnd =
+				[&](const ::pddl::normalizedAST::AndPointer<::pddl::normalizedAST::Literal> &and_)
+				{
+					for (const auto &argument : and_->arguments)
+						handleConditionalEffectLiteral(argument);
+				};
+
+			when->argumentRight.match(handleConditionalEffectLiteral, handleConditionalEffectAnd);
+		};
+
+	effect.match(handleEffectLiteral, handleAnd, handleForAll, handleWhen);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+ActionSummary summarizeAction(const ::pddl::normalizedAST::Action &action)
+{
+	ActionSummary actionSummary;
+
+	if (action.precondition)
+	{
+		const auto handlePreconditionLiteral =
+			[&](const ::pddl::normalizedAST::Literal &literal)
+			{
+				handleLiteral(literal,
+					[&](const ::pddl::normalizedAST::Predicate &predicate, bool isPositive)
+					{
+						if (isPositive)
+							actionSummary.positivePreconditions.emplace_back(makeAtom(predicate));
+						else
+							actionSummary.negativePreconditions.emplace_back(makeAtom(predicate));
+					});
+			};
+
+		const auto handleAnd =
+			[&](const ::pddl::normalizedAST::AndPointer<::pddl::normalizedAST::Literal> &and_)
+			{
+				for (const auto &argument : and_->arguments)
+					handlePreconditionLiteral(argument);
+			};
+
+		action.precondition.value().match(handlePreconditionLiteral, handleAnd);
+	}
+
+	if (action.effect)
+		summarizeEffect(action.effect.value(), false, actionSummary);
+
+	return actionSummary;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool contains(const std::vector<Atom> &atoms, const Atom &atom)
+{
+	return std::find(atoms.cbegin(), atoms.cend(), atom) != atoms.cend();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class InvariantFinder
+{
+	public:
+		explicit InvariantFinder(const ::pddl::normalizedAST::Description &description);
+
+		std::vector<Invariant> findInvariants();
+
+	private:
+		bool isCovered(const Candidate &candidate, const Atom &atom) const;
+		std::vector<Term> parameterTerms(const Candidate &candidate, const Atom &atom) const;
+
+		bool isTooHeavy(const Candidate &candidate, const ActionSummary &actionSummary,
+			const Atom &addEffect1, const Atom &addEffect2) const;
+		bool isBalanced(const Candidate &candidate, const ActionSummary &actionSummary,
+			const Atom &addEffect) const;
+		void refine(const Candidate &candidate, const ActionSummary &actionSummary, const Atom &addEffect);
+
+		// Returns true if the candidate is an invariant, or adds refined candidates otherwise
+		bool check(const Candidate &candidate);
+		bool holdsInInitialState(const Candidate &candidate) const;
+
+		void addCandidate(Candidate &&candidate);
+
+		const ::pddl::normalizedAST::Description &m_description;
+
+		std::vector<ActionSummary> m_actionSummaries;
+		std::set<const ::pddl::normalizedAST::PredicateDeclaration *> m_fluentPredicates;
+		std::set<Term> m_constants;
+
+		std::set<Candidate> m_visitedCandidates;
+		std::deque<Candidate> m_candidates;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+InvariantFinder::InvariantFinder(const ::pddl::normalizedAST::Description &description)
+:	m_description(description)
+{
+	const auto &domain = *description.domain;
+
+	for (const auto &action : domain.actions)
+		m_actionSummaries.emplace_back(summarizeAction(*action));
+
+	for (const auto &constant : domain.constants)
+		m_constants.insert(constant.get());
+
+	for (const auto &object : description.problem.value()->objects)
+		m_constants.insert(object.get());
+
+	const auto staticPredicates = detectStaticPredicates(domain);
+
+	for (const auto &predicate : domain.predicates)
+		if (staticPredicates.find(predicate.get()) == staticPredicates.cend())
+			m_fluentPredicates.insert(predicate.get());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool InvariantFinder::isCovered(const Candidate &candidate, const Atom &atom) const
+{
+	return candidate.parts.find(atom.predicate) != candidate.parts.cend();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::vector<Term> InvariantFinder::parameterTerms(const Candidate &candidate, const Atom &atom) const
+{
+	const auto &parameterPositions = candidate.parts.at(atom.predicate);
+
+	std::vector<Term> terms;
+	terms.reserve(parameterPositions.size());
+
+	for (const auto parameterPosition : parameterPositions)
+		terms.emplace_back(atom.arguments[parameterPosition]);
+
+	return terms;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Checks whether the action may add two distinct atoms of the same mutex group, which are both
+// false beforehand. Unless the precondition contradicts all such cases syntactically, the action
+// is assumed to be too heavy
+bool InvariantFinder::isTooHeavy(const Candidate &candidate, const ActionSummary &actionSummary,
+	const Atom &addEffect1, const Atom &addEffect2) const
+{
+	const auto isConstant =
+		[&](Term term)
+		{
+			return m_constants.find(term) != m_constants.cend();
+		};
+
+	// Union-find over the terms, unifying the parameter terms of both atoms
+	std::map<Term, Term> representatives;
+
+	const auto find =
+		[&](Term term)
+		{
+			while (true)
+			{
+				const auto matchingRepresentative = representatives.find(term);
+
+				if (matchingRepresentative == representatives.cend() || matchingRepresentative->second == term)
+					return term;
+
+				term = matchingRepresentative->second;
+			}
+		};
+
+	const auto parameterTerms1 = parameterTerms(candidate, addEffect1);
+	const auto parameterTerms2 = parameterTerms(candidate, addEffect2);
+
+	for (size_t i = 0; i < parameterTerms1.size(); i++)
+	{
+		const auto representative1 = find(parameterTerms1[i]);
+		const auto representative2 = find(parameterTerms2[i]);
+
+		if (representative1 == representative2)
+			continue;
+
+		const auto isConstant1 = isConstant(representative1);
+		const auto isConstant2 = isConstant(representative2);
+
+		// Distinct constants never unify, so the atoms always belong to different mutex groups
+		if (isConstant1 && isConstant2)
+			return false;
+
+		// Keep constants as representatives
+		if (isConstant1)
+			representatives[representative2] = representative1;
+		else
+			representatives[representative1] = representative2;
+	}
+
+	const auto normalize =
+		[&](const Atom &atom)
+		{
+			auto normalizedAtom = atom;
+
+			for (auto &argument : normalizedAtom.arguments)
+				argument = find(argument);
+
+			return normalizedAtom;
+		};
+
+	const auto normalizedAddEffect1 = normalize(addEffect1);
+	const auto normalizedAddEffect2 = normalize(addEffect2);
+
+	// The atoms are identical in all cases
+	if (normalizedAddEffect1 == normalizedAddEffect2)
+		return false;
+
+	std::vector<Atom> trueAtoms;
+	std::vector<Atom> falseAtoms = {normalizedAddEffect1, normalizedAddEffect2};
+
+	for (const auto &atom : actionSummary.positivePreconditions)
+		trueAtoms.emplace_back(normalize(atom));
+
+	for (const auto &atom : actionSummary.negativePreconditions)
+		falseAtoms.emplace_back(normalize(atom));
+
+	for (const auto &atom : trueAtoms)
+		if (contains(falseAtoms, atom))
+			return false;
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// An add effect is balanced if its atom is true already or if the action deletes an atom of the
+// same mutex group that is required to be true (and not added again)
+bool InvariantFinder::isBalanced(const Candidate &candidate, const ActionSummary &actionSummary,
+	const Atom &addEffect) const
+{
+	if (contains(actionSummary.positivePreconditions, addEffect))
+		return true;
+
+	const auto addEffectParameterTerms = parameterTerms(candidate, addEffect);
+
+	for (const auto &deleteEffect : actionSummary.deleteEffects)
+	{
+		if (!isCovered(candidate, deleteEffect)
+			|| parameterTerms(candidate, deleteEffect) != addEffectParameterTerms
+			|| !contains(actionSummary.positivePreconditions, deleteEffect))
+		{
+			continue;
+		}
+
+		const auto isAddedAgain = std::any_of(actionSummary.addEffects.cbegin(), actionSummary.addEffects.cend(),
+			[&](const auto &otherAddEffect)
+			{
+				return !(otherAddEffect == addEffect) && otherAddEffect == deleteEffect;
+			});
+
+		if (!isAddedAgain)
+			return true;
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Adds candidates extended by a part for a deleted atom that might balance the add effect
+void InvariantFinder::refine(const Candidate &candidate, const ActionSummary &actionSummary, const Atom &addEffect)
+{
+	const auto addEffectParameterTerms = parameterTerms(candidate, addEffect);
+	const auto numberOfParameters = candidate.numberOfParameters;
+
+	for (const auto &deleteEffect : actionSummary.deleteEffects)
+	{
+		if (isCovered(candidate, deleteEffect))
+			continue;
+
+		const auto arity = deleteEffect.arguments.size();
+
+		if (arity != numberOfParameters && arity != numberOfParameters + 1)
+			continue;
+
+		// Enumerate all ways to bind the parameters to arguments of the deleted atom
+		std::vector<size_t> parameterPositions;
+
+		const auto bindParameter =
+			[&](const auto &bindParameter, size_t parameterIndex) -> void
+			{
+				if (parameterIndex == numberOfParameters)
+				{
+					auto refinedCandidate = candidate;
+					refinedCandidate.parts.emplace(deleteEffect.predicate, parameterPositions);
+					addCandidate(std::move(refinedCandidate));
+
+					return;
+				}
+
+				for (size_t position = 0; position < arity; position++)
+				{
+					if (deleteEffect.arguments[position] != addEffectParameterTerms[parameterIndex]
+						|| std::find(parameterPositions.cbegin(), parameterPositions.cend(), position) != parameterPositions.cend())
+					{
+						continue;
+					}
+
+					parameterPositions.emplace_back(position);
+					bindParameter(bindParameter, parameterIndex + 1);
+					parameterPositions.pop_back();
+				}
+			};
+
+		bindParameter(bindParameter, 0);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool InvariantFinder::check(const Candidate &candidate)
+{
+	for (const auto &actionSummary : m_actionSummaries)
+	{
+		for (const auto *predicate : actionSummary.complexAddEffectPredicates)
+			if (candidate.parts.find(predicate) != candidate.parts.cend())
+				return false;
+
+		std::vector<const Atom *> addEffects;
+
+		for (const auto &addEffect : actionSummary.addEffects)
+			if (isCovered(candidate, addEffect))
+				addEffects.emplace_back(&addEffect);
+
+		for (size_t i = 0; i < addEffects.size(); i++)
+			for (size_t j = i + 1; j < addEffects.size(); j++)
+				if (isTooHeavy(candidate, actionSummary, *addEffects[i], *addEffects[j]))
+					return false;
+
+		for (const auto *addEffect : addEffects)
+			if (!isBalanced(candidate, actionSummary, *addEffect))
+			{
+				refine(candidate, actionSummary, *addEffect);
+				return false;
+			}
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool InvariantFinder::holdsInInitialState(const Candidate &candidate) const
+{
+	std::set<std::vector<Term>> coveredMutexGroups;
+
+	for (const auto &fact : m_description.problem.value()->initialState.facts)
+	{
+		bool isViolated = false;
+
+		handleLiteral(fact,
+			[&](const ::pddl::normalizedAST::Predicate &predicate, bool isPositive)
+			{
+				const auto atom = makeAtom(predicate);
+
+				if (!isPositive || !isCovered(candidate, atom))
+					return;
+
+				isViolated = !coveredMutexGroups.insert(parameterTerms(candidate, atom)).second;
+			});
+
+		if (isViolated)
+			return false;
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void InvariantFinder::addCandidate(Candidate &&candidate)
+{
+	if (m_visitedCandidates.size() >= MaximumNumberOfCandidates)
+		return;
+
+	if (!m_visitedCandidates.insert(candidate).second)
+		return;
+
+	m_candidates.emplace_back(std::move(candidate));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::vector<Invariant> InvariantFinder::findInvariants()
+{
+	// Start with single predicates, each with either none or one of its arguments counted
+	for (const auto &predicate : m_description.domain->predicates)
+	{
+		if (m_fluentPredicates.find(predicate.get()) == m_fluentPredicates.cend())
+			continue;
+
+		const auto arity = predicate->parameters.size();
+
+		for (size_t countedPosition = 0; countedPosition <= arity; countedPosition++)
+		{
+			Candidate candidate{countedPosition == arity ? arity : arity - 1, {}};
+			auto &parameterPositions = candidate.parts[predicate.get()];
+
+			for (size_t position = 0; position < arity; position++)
+				if (position != countedPosition)
+					parameterPositions.emplace_back(position);
+
+			addCandidate(std::move(candidate));
+		}
+	}
+
+	std::vector<Invariant> invariants;
+
+	while (!m_candidates.empty())
+	{
+		const auto candidate = std::move(m_candidates.front());
+		m_candidates.pop_front();
+
+		if (!check(candidate) || !holdsInInitialState(candidate))
+			continue;
+
+		// With a single part and no counted argument, each mutex group would contain only one atom
+		if (candidate.parts.size() == 1
+			&& candidate.parts.cbegin()->second.size() == candidate.parts.cbegin()->first->parameters.size())
+		{
+			continue;
+		}
+
+		Invariant invariant{candidate.numberOfParameters, {}};
+
+		// Keep the parts in the order of the predicate declarations
+		for (const auto &predicate : m_description.domain->predicates)
+		{
+			const auto matchingPart = candidate.parts.find(predicate.get());
+
+			if (matchingPart != candidate.parts.cend())
+				invariant.parts.push_back({predicate.get(), matchingPart->second});
+		}
+
+		invariants.emplace_back(std::move(invariant));
+	}
+
+	return invariants;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::vector<Invariant> synthesizeInvariants(const ::pddl::normalizedAST::Description &description)
+{
+	// The invariants are checked against the initial state
+	if (!description.problem)
+		return {};
+
+	return InvariantFinder(description).findInvariants();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
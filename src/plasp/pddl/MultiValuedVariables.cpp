@@ -0,0 +1,329 @@
+#include <plasp/pddl/MultiValuedVariables.h>
+
+#include <algorithm>
+#include <numeric>
+
+#include <pddl/NormalizedAST.h>
+
+namespace plasp
+{
+namespace pddl
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// MultiValuedVariables
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+using PredicateDeclarations = std::set<const ::pddl::normalizedAST::PredicateDeclaration *>;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Action parameters and constants are identified by their declarations
+using Terms = std::vector<const void *>;
+
+Terms arguments(const ::pddl::normalizedAST::Predicate &predicate)
+{
+	Terms terms;
+	terms.reserve(predicate.arguments.size());
+
+	for (const auto &argument : predicate.arguments)
+	{
+		if (argument.is<::pddl::normalizedAST::ConstantPointer>())
+			terms.emplace_back(argument.get<::pddl::normalizedAST::ConstantPointer>()->declaration);
+		else
+			terms.emplace_back(argument.get<::pddl::normalizedAST::VariablePointer>()->declaration);
+	}
+
+	return terms;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<class Callback>
+void forEachPredicate(const ::pddl::normalizedAST::Literal &literal, Callback callback)
+{
+	const auto isPositive = literal.is<::pddl::normalizedAST::AtomicFormula>();
+	const auto &atomicFormula = isPositive
+		? literal.get<::pddl::normalizedAST::AtomicFormula>()
+		: literal.get<::pddl::normalizedAST::NotPointer<::pddl::normalizedAST::AtomicFormula>>()->argument;
+
+	if (atomicFormula.is<::pddl::normalizedAST::PredicatePointer>())
+		callback(*atomicFormula.get<::pddl::normalizedAST::PredicatePointer>(), isPositive);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<class Argument, class Callback>
+void forEachPredicate(const ::pddl::normalizedAST::AndPointer<Argument> &and_, Callback callback)
+{
+	for (const auto &argument : and_->arguments)
+		forEachPredicate(argument, callback);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<class Callback>
+void forEachPredicate(const ::pddl::normalizedAST::OrPointer<::pddl::normalizedAST::Literal> &or_, Callback callback)
+{
+	for (const auto &argument : or_->arguments)
+		forEachPredicate(argument, callback);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<class Variant, class Callback>
+void forEachPredicateInVariant(const Variant &variant, Callback callback)
+{
+	variant.match(
+		[&](const auto &argument)
+		{
+			forEachPredicate(argument, callback);
+		});
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct ActionEffects
+{
+	std::vector<const ::pddl::normalizedAST::Predicate *> positivePreconditions;
+	std::vector<const ::pddl::normalizedAST::Predicate *> addEffects;
+	std::vector<const ::pddl::normalizedAST::Predicate *> deleteEffects;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Collects the unconditional effects, and marks all predicates in other effects as unsupported
+void collectEffects(const ::pddl::normalizedAST::Effect &effect, ActionEffects &actionEffects,
+	PredicateDeclarations &unsupportedPredicates)
+{
+	const auto markUnsupported =
+		[&](const ::pddl::normalizedAST::Predicate &predicate, bool)
+		{
+			unsupportedPredicates.insert(predicate.declaration);
+		};
+
+	const auto handleLiteral =
+		[&](const ::pddl::normalizedAST::Literal &literal)
+		{
+			forEachPredicate(literal,
+				[&](const ::pddl::normalizedAST::Predicate &predicate, bool isPositive)
+				{
+					if (isPositive)
+						actionEffects.addEffects.emplace_back(&predicate);
+					else
+						actionEffects.deleteEffects.emplace_back(&predicate);
+				});
+		};
+
+	const auto handleAnd =
+		[&](const ::pddl::normalizedAST::AndPointer<::pddl::normalizedAST::Effect> &and_)
+		{
+			for (const auto &argument : and_->arguments)
+				collectEffects(argument, actionEffects, unsupportedPredicates);
+		};
+
+	const auto handleForAll =
+		[&](const ::pddl::normalizedAST::ForAllPointer<::pddl::normalizedAST::Effect> &forAll)
+		{
+			ActionEffects quantifiedEffects;
+			collectEffects(forAll->argument, quantifiedEffects, unsupportedPredicates);
+
+			for (const auto *predicate : quantifiedEffects.addEffects)
+				markUnsupported(*predicate, true);
+
+			for (const auto *predicate : quantifiedEffects.deleteEffects)
+				markUnsupported(*predicate, false);
+		};
+
+	const auto handleWhen =
+		[&](const ::pddl::normalizedAST::WhenPointer<::pddl::normalizedAST::Precondition,
+			::pddl::normalizedAST::ConditionalEffect> &when)
+		{
+			forEachPredicateInVariant(when->argumentLeft, markUnsupported);
+			forEachPredicateInVariant(when->argumentRight, markUnsupported);
+		};
+
+	effect.match(handleLiteral, handleAnd, handleForAll, handleWhen);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+MultiValuedVariables selectMultiValuedVariables(const ::pddl::normalizedAST::Description &description,
+	const std::vector<Invariant> &invariants)
+{
+	const auto &domain = *description.domain;
+
+	// Predicates that cannot be expressed by assignments to multi-valued variables
+	PredicateDeclarations unsupportedPredicates;
+
+	const auto markUnsupported =
+		[&](const ::pddl::normalizedAST::Predicate &predicate, bool)
+		{
+			unsupportedPredicates.insert(predicate.declaration);
+		};
+
+	const auto markUnsupportedIfNegative =
+		[&](const ::pddl::normalizedAST::Predicate &predicate, bool isPositive)
+		{
+			if (!isPositive)
+				unsupportedPredicates.insert(predicate.declaration);
+		};
+
+	std::vector<ActionEffects> actionEffects(domain.actions.size());
+
+	for (size_t actionID = 0; actionID < domain.actions.size(); actionID++)
+	{
+		const auto &action = *domain.actions[actionID];
+
+		if (action.precondition)
+			forEachPredicateInVariant(action.precondition.value(),
+				[&](const ::pddl::normalizedAST::Predicate &predicate, bool isPositive)
+				{
+					markUnsupportedIfNegative(predicate, isPositive);
+
+					if (isPositive)
+						actionEffects[actionID].positivePreconditions.emplace_back(&predicate);
+				});
+
+		if (action.effect)
+			collectEffects(action.effect.value(), actionEffects[actionID], unsupportedPredicates);
+	}
+
+	const auto markDerivedPredicatePredicates =
+		[&](const ::pddl::normalizedAST::DerivedPredicateDeclarations &derivedPredicates)
+		{
+			for (const auto &derivedPredicate : derivedPredicates)
+				if (derivedPredicate->precondition)
+					forEachPredicateInVariant(derivedPredicate->precondition.value(), markUnsupported);
+		};
+
+	markDerivedPredicatePredicates(domain.derivedPredicates);
+
+	if (description.problem)
+	{
+		const auto &problem = description.problem.value();
+
+		markDerivedPredicatePredicates(problem->derivedPredicates);
+
+		if (problem->goal)
+			forEachPredicateInVariant(problem->goal.value(), markUnsupportedIfNegative);
+	}
+
+	MultiValuedVariables multiValuedVariables;
+
+	// Prefer invariants with more parts, which merge more atoms into one variable
+	std::vector<size_t> invariantIDs(invariants.size());
+	std::iota(invariantIDs.begin(), invariantIDs.end(), 0);
+	std::stable_sort(invariantIDs.begin(), invariantIDs.end(),
+		[&](size_t invariantID1, size_t invariantID2)
+		{
+			return invariants[invariantID1].parts.size() > invariants[invariantID2].parts.size();
+		});
+
+	for (const auto invariantID : invariantIDs)
+	{
+		const auto &invariant = invariants[invariantID];
+
+		std::map<const ::pddl::normalizedAST::PredicateDeclaration *, const InvariantPart *> parts;
+
+		const auto isSupported =
+			[&](const auto &part)
+			{
+				return unsupportedPredicates.find(part.predicate) == unsupportedPredicates.cend()
+					&& multiValuedVariables.parts.find(part.predicate) == multiValuedVariables.parts.cend();
+			};
+
+		if (!std::all_of(invariant.parts.cbegin(), invariant.parts.cend(), isSupported))
+			continue;
+
+		for (const auto &part : invariant.parts)
+			parts.emplace(part.predicate, &part);
+
+		const auto parameterTerms =
+			[&](const ::pddl::normalizedAST::Predicate &predicate)
+			{
+				const auto terms = arguments(predicate);
+
+				Terms parameterTerms;
+
+				for (const auto parameterPosition : parts.at(predicate.declaration)->parameterPositions)
+					parameterTerms.emplace_back(terms[parameterPosition]);
+
+				return parameterTerms;
+			};
+
+		const auto isCovered =
+			[&](const ::pddl::normalizedAST::Predicate *predicate)
+			{
+				return parts.find(predicate->declaration) != parts.cend();
+			};
+
+		std::set<const ::pddl::normalizedAST::Predicate *> impliedDeleteEffects;
+		bool isSelectable = true;
+
+		for (const auto &effects : actionEffects)
+		{
+			std::vector<Terms> addEffectParameterTerms;
+
+			for (const auto *addEffect : effects.addEffects)
+				if (isCovered(addEffect))
+					addEffectParameterTerms.emplace_back(parameterTerms(*addEffect));
+
+			for (const auto *deleteEffect : effects.deleteEffects)
+			{
+				if (!isCovered(deleteEffect))
+					continue;
+
+				// The added atom replaces the deleted one as the value of the variable
+				if (std::find(addEffectParameterTerms.cbegin(), addEffectParameterTerms.cend(),
+					parameterTerms(*deleteEffect)) != addEffectParameterTerms.cend())
+				{
+					impliedDeleteEffects.insert(deleteEffect);
+					continue;
+				}
+
+				// Otherwise, the variable is reset to false, which requires the deleted atom to be true
+				const auto isRequired = std::any_of(effects.positivePreconditions.cbegin(), effects.positivePreconditions.cend(),
+					[&](const auto *precondition)
+					{
+						return precondition->declaration == deleteEffect->declaration
+							&& arguments(*precondition) == arguments(*deleteEffect);
+					});
+
+				if (!isRequired || !addEffectParameterTerms.empty())
+				{
+					isSelectable = false;
+					break;
+				}
+			}
+
+			if (!isSelectable)
+				break;
+		}
+
+		if (!isSelectable)
+			continue;
+
+		for (const auto &part : invariant.parts)
+			multiValuedVariables.parts.emplace(part.predicate,
+				MultiValuedVariablePart{invariantID, invariant.numberOfParameters, part.parameterPositions});
+
+		multiValuedVariables.impliedDeleteEffects.insert(impliedDeleteEffects.cbegin(), impliedDeleteEffects.cend());
+	}
+
+	return multiValuedVariables;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
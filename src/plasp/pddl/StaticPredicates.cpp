@@ -0,0 +1,174 @@
+#include <plasp/pddl/StaticPredicates.h>
+
+#include <pddl/NormalizedAST.h>
+
+namespace plasp
+{
+namespace pddl
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// StaticPredicates
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+void collectPredicates(const ::pddl::normalizedAST::Literal &literal, StaticPredicates &predicates)
+{
+	const auto handleAtomicFormula =
+		[&](const ::pddl::normalizedAST::AtomicFormula &atomicFormula)
+		{
+			if (atomicFormula.is<::pddl::normalizedAST::PredicatePointer>())
+				predicates.insert(atomicFormula.get<::pddl::normalizedAST::PredicatePointer>()->declaration);
+		};
+
+	const auto handleNot =
+		[&](const ::pddl::normalizedAST::NotPointer<::pddl::normalizedAST::AtomicFormula> &not_)
+		{
+			handleAtomicFormula(not_->argument);
+		};
+
+	literal.match(handleAtomicFormula, handleNot);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<class Argument>
+void collectPredicates(const ::pddl::normalizedAST::AndPointer<Argument> &and_, StaticPredicates &predicates)
+{
+	for (const auto &argument : and_->arguments)
+		collectPredicates(argument, predicates);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void collectPredicates(const ::pddl::normalizedAST::OrPointer<::pddl::normalizedAST::Literal> &or_,
+	StaticPredicates &predicates)
+{
+	for (const auto &argument : or_->arguments)
+		collectPredicates(argument, predicates);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<class Variant>
+void collectPredicatesInVariant(const Variant &variant, StaticPredicates &predicates)
+{
+	variant.match(
+		[&](const auto &argument)
+		{
+			collectPredicates(argument, predicates);
+		});
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Collects the predicates in effects, and those in effect conditions separately
+void collectPredicates(const ::pddl::normalizedAST::Effect &effect, StaticPredicates &effectPredicates,
+	StaticPredicates &conditionPredicates)
+{
+	const auto handleLiteral =
+		[&](const ::pddl::normalizedAST::Literal &literal)
+		{
+			collectPredicates(literal, effectPredicates);
+		};
+
+	const auto handleAnd =
+		[&](const ::pddl::normalizedAST::AndPointer<::pddl::normalizedAST::Effect> &and_)
+		{
+			for (const auto &argument : and_->arguments)
+				collectPredicates(argument, effectPredicates, conditionPredicates);
+		};
+
+	const auto handleForAll =
+		[&](const ::pddl::normalizedAST::ForAllPointer<::pddl::normalizedAST::Effect> &forAll)
+		{
+			collectPredicates(forAll->argument, effectPredicates, conditionPredicates);
+		};
+
+	const auto handleWhen =
+		[&](const ::pddl::normalizedAST::WhenPointer<::pddl::normalizedAST::Precondition,
+			::pddl::normalizedAST::ConditionalEffect> &when)
+		{
+			collectPredicatesInVariant(when->argumentLeft, conditionPredicates);
+			collectPredicatesInVariant(when->argumentRight, effectPredicates);
+		};
+
+	effect.match(handleLiteral, handleAnd, handleForAll, handleWhen);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+StaticPredicates detectStaticPredicates(const ::pddl::normalizedAST::Domain &domain,
+	StaticPredicates &conditionPredicates)
+{
+	StaticPredicates effectPredicates;
+
+	for (const auto &action : domain.actions)
+		if (action->effect)
+			collectPredicates(action->effect.value(), effectPredicates, conditionPredicates);
+
+	StaticPredicates staticPredicates;
+
+	for (const auto &predicate : domain.predicates)
+		if (effectPredicates.find(predicate.get()) == effectPredicates.cend())
+			staticPredicates.insert(predicate.get());
+
+	return staticPredicates;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+StaticPredicates detectStaticPredicates(const ::pddl::normalizedAST::Domain &domain)
+{
+	StaticPredicates conditionPredicates;
+
+	return detectStaticPredicates(domain, conditionPredicates);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+StaticPredicates detectCompilableStaticPredicates(const ::pddl::normalizedAST::Description &description)
+{
+	// Predicates referred to at time steps other than action preconditions remain variables
+	StaticPredicates conditionPredicates;
+
+	auto staticPredicates = detectStaticPredicates(*description.domain, conditionPredicates);
+
+	const auto collectDerivedPredicatePredicates =
+		[&](const ::pddl::normalizedAST::DerivedPredicateDeclarations &derivedPredicates)
+		{
+			for (const auto &derivedPredicate : derivedPredicates)
+				if (derivedPredicate->precondition)
+					collectPredicatesInVariant(derivedPredicate->precondition.value(), conditionPredicates);
+		};
+
+	collectDerivedPredicatePredicates(description.domain->derivedPredicates);
+
+	if (description.problem)
+	{
+		const auto &problem = description.problem.value();
+
+		collectDerivedPredicatePredicates(problem->derivedPredicates);
+
+		if (problem->goal)
+			collectPredicatesInVariant(problem->goal.value(), conditionPredicates);
+	}
+
+	for (const auto *predicate : conditionPredicates)
+		staticPredicates.erase(predicate);
+
+	return staticPredicates;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
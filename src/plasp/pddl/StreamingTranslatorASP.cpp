@@ -0,0 +1,161 @@
+#include <plasp/pddl/StreamingTranslatorASP.h>
+
+#include <experimental/optional>
+#include <utility>
+
+#include <colorlog/Formatting.h>
+
+#include <pddl/AST.h>
+#include <pddl/NormalizedAST.h>
+#include <pddl/detail/normalization/Domain.h>
+#include <pddl/detail/normalization/Fact.h>
+#include <pddl/detail/normalization/Precondition.h>
+#include <pddl/detail/parsing/Description.h>
+#include <pddl/detail/parsing/Problem.h>
+
+#include <plasp/StreamingOutput.h>
+
+#include <plasp/pddl/TranslatorASP.h>
+
+namespace plasp
+{
+namespace pddl
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// StreamingTranslatorASP
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+StreamingTranslatorASP::StreamingTranslatorASP(::pddl::Context &context, colorlog::ColorStream &outputStream)
+:	m_context(context),
+	m_outputStream(outputStream),
+	m_numberOfActions{0},
+	m_numberOfDerivedPredicates{0}
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void StreamingTranslatorASP::translate()
+{
+	::pddl::detail::DescriptionParser descriptionParser(m_context);
+	auto domain = descriptionParser.parseDomain();
+
+	std::experimental::optional<::pddl::detail::ProblemParser> problemParser;
+	::pddl::ast::ProblemPointer problem;
+
+	// The problem’s objects are parsed before the domain is normalized, as they may refer to types
+	if (descriptionParser.hasProblem())
+	{
+		descriptionParser.seekProblem();
+		problemParser.emplace(m_context, *domain);
+		problem = problemParser.value().parseHeader();
+	}
+
+	::pddl::normalizedAST::Description description;
+	description.domain = ::pddl::detail::normalize(std::move(domain));
+
+	StreamingOutput output(m_outputStream);
+	auto &outputStream = output.stream();
+
+	TranslatorASP translator(description, outputStream);
+
+	translator.translateDomain();
+
+	m_numberOfActions = description.domain->actions.size();
+	m_numberOfDerivedPredicates = description.domain->derivedPredicates.size();
+
+	if (!problem)
+	{
+		output.finish();
+		return;
+	}
+
+	description.problem = std::make_unique<::pddl::normalizedAST::Problem>(description.domain.get());
+
+	auto &normalizedDomain = *description.domain;
+	auto &normalizedProblem = *description.problem.value();
+
+	normalizedProblem.name = problem->name;
+
+	// Normalization moved the declarations that the parser looks up from the domain to the
+	// normalized domain, so they are lent back to the domain while the problem is parsed
+	const auto swapDeclarations =
+		[&]()
+		{
+			std::swap(domain->types, normalizedDomain.types);
+			std::swap(domain->constants, normalizedDomain.constants);
+			std::swap(domain->predicates, normalizedDomain.predicates);
+		};
+
+	outputStream << std::endl << colorlog::Heading1("problem");
+
+	// The objects are moved to the normalized problem only after parsing, as the parser looks them up
+	if (!problem->objects.empty())
+	{
+		outputStream << std::endl;
+		translator.translateConstants("objects", problem->objects);
+	}
+
+	outputStream << std::endl << colorlog::Heading2("initial state");
+
+	// Write everything up to the initial state right away
+	output.flush();
+
+	swapDeclarations();
+
+	problemParser.value().parseInitialState(*problem,
+		[&](::pddl::ast::Fact &&fact)
+		{
+			const auto normalizedFact = ::pddl::detail::normalize(std::move(fact));
+
+			translator.translateInitialStateFact(outputStream, normalizedFact);
+			output.commit();
+		});
+
+	translator.translateDefaultInitialState();
+
+	problemParser.value().parseGoal(*problem);
+
+	swapDeclarations();
+
+	normalizedProblem.objects = std::move(problem->objects);
+
+	if (problem->goal)
+	{
+		::pddl::detail::NormalizationContext normalizationContext(normalizedProblem.derivedPredicates);
+		normalizationContext.derivedPredicateIDStart = normalizedDomain.derivedPredicates.size() + 1;
+		normalizedProblem.goal = ::pddl::detail::normalize(std::move(problem->goal.value()), normalizationContext);
+	}
+
+	m_numberOfDerivedPredicates += normalizedProblem.derivedPredicates.size();
+
+	if (!normalizedProblem.derivedPredicates.empty())
+	{
+		outputStream << std::endl;
+		translator.translateDerivedPredicates(normalizedProblem.derivedPredicates);
+	}
+
+	if (normalizedProblem.goal)
+	{
+		outputStream << std::endl;
+		translator.translateGoal();
+	}
+
+	output.finish();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void StreamingTranslatorASP::collectStatistics(Statistics &statistics) const
+{
+	statistics.count("actions", m_numberOfActions);
+	statistics.count("derived predicates", m_numberOfDerivedPredicates);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
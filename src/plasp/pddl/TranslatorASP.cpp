@@ -1,17 +1,21 @@
 #include <plasp/pddl/TranslatorASP.h>
 
+#include <algorithm>
 #include <cassert>
 
 #include <colorlog/Formatting.h>
 
 #include <pddl/NormalizedAST.h>
 
+#include <plasp/ParallelTranslation.h>
 #include <plasp/TranslatorException.h>
 
+#include <plasp/pddl/translation/Action.h>
 #include <plasp/pddl/translation/DerivedPredicate.h>
 #include <plasp/pddl/translation/DerivedPredicatePrecondition.h>
 #include <plasp/pddl/translation/Effect.h>
 #include <plasp/pddl/translation/Fact.h>
+#include <plasp/pddl/translation/GroundArguments.h>
 #include <plasp/pddl/translation/Goal.h>
 #include <plasp/pddl/translation/Precondition.h>
 #include <plasp/pddl/translation/Predicate.h>
@@ -29,10 +33,130 @@ namespace pddl
 //
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Names the parameters of an invariant X1, X2, etc., followed by the counted argument, so that all
+// parts of the invariant refer to the same mutex group
+VariableIDMap invariantVariableIDs(const ::pddl::normalizedAST::PredicateDeclaration &predicate,
+	const std::vector<size_t> &parameterPositions, size_t numberOfParameters)
+{
+	VariableIDMap variableIDs;
+
+	for (size_t i = 0; i < parameterPositions.size(); i++)
+		variableIDs.emplace(predicate.parameters[parameterPositions[i]].get(), i + 1);
+
+	for (const auto &parameter : predicate.parameters)
+		variableIDs.emplace(parameter.get(), numberOfParameters + 1);
+
+	return variableIDs;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 TranslatorASP::TranslatorASP(const ::pddl::normalizedAST::Description &description, colorlog::ColorStream &outputStream)
 :	m_description{description},
-	m_outputStream(outputStream)
+	m_outputStream(outputStream),
+	m_numberOfThreads{1}
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TranslatorASP::setNumberOfThreads(size_t numberOfThreads)
+{
+	m_numberOfThreads = numberOfThreads;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TranslatorASP::collectSymbols(colorlog::SymbolTable &symbolTable) const
+{
+	const auto addSymbols =
+		[&](const auto &declarations)
+		{
+			for (const auto &declaration : declarations)
+				symbolTable.add(declaration->name);
+		};
+
+	symbolTable.add("object");
+
+	const auto &domain = m_description.domain;
+
+	addSymbols(domain->types);
+	addSymbols(domain->constants);
+	addSymbols(domain->predicates);
+	addSymbols(domain->derivedPredicates);
+	addSymbols(domain->actions);
+
+	if (m_description.problem)
+	{
+		const auto &problem = m_description.problem.value();
+
+		addSymbols(problem->derivedPredicates);
+		addSymbols(problem->objects);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TranslatorASP::collectStatistics(Statistics &statistics) const
+{
+	const auto &domain = m_description.domain;
+
+	// Actions without reachable instances are omitted when grounding
+	if (!m_grounding)
+		statistics.count("actions", domain->actions.size());
+	else
+		statistics.count("actions", std::count_if(m_grounding->actions.cbegin(), m_grounding->actions.cend(),
+			[](const auto &groundInstances)
+			{
+				return !groundInstances.empty();
+			}));
+
+	statistics.count("derived predicates", domain->derivedPredicates.size());
+
+	if (m_description.problem)
+		statistics.count("derived predicates", m_description.problem.value()->derivedPredicates.size());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TranslatorASP::ground()
+{
+	m_grounding = std::make_unique<Grounding>(groundReachableInstances(m_description));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TranslatorASP::compileStaticPredicates()
+{
+	m_staticPredicates = detectCompilableStaticPredicates(m_description);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TranslatorASP::synthesizeMutexGroups()
+{
+	m_invariants = synthesizeInvariants(m_description);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TranslatorASP::useMultiValuedVariables()
 {
+	// Invariant synthesis is deterministic, so the multi-valued variables are numbered consistently
+	// with the mutex groups
+	const auto invariants = m_invariants.empty() ? synthesizeInvariants(m_description) : m_invariants;
+
+	m_multiValuedVariables = std::make_unique<MultiValuedVariables>(
+		selectMultiValuedVariables(m_description, invariants));
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -50,7 +174,34 @@ void TranslatorASP::translate() const
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void TranslatorASP::translate(GroundFactSink &sink) const
+{
+	if (!m_grounding)
+		throw TranslatorException("ground facts require grounding the description first");
+
+	if (!m_staticPredicates.empty() || !m_invariants.empty() || m_multiValuedVariables)
+		throw TranslatorException("ground facts are only available with Boolean variables");
+
+	translateGrounding(m_description, *m_grounding, sink);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void TranslatorASP::translateDomain() const
+{
+	translateDomainDeclarations();
+
+	// Actions
+	if (!m_description.domain->actions.empty())
+	{
+		m_outputStream << std::endl;
+		translateActions();
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TranslatorASP::translateDomainDeclarations() const
 {
 	m_outputStream << colorlog::Heading1("domain");
 
@@ -84,13 +235,6 @@ void TranslatorASP::translateDomain() const
 		m_outputStream << std::endl;
 		translateDerivedPredicates(domain->derivedPredicates);
 	}
-
-	// Actions
-	if (!domain->actions.empty())
-	{
-		m_outputStream << std::endl;
-		translateActions();
-	}
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -166,36 +310,145 @@ void TranslatorASP::translatePredicates() const
 
 	const auto &predicates = m_description.domain->predicates;
 
-	for (const auto &predicate : predicates)
-	{
-		VariableIDMap variableIDs;
+	const auto isStaticPredicate =
+		[&](const auto &predicate)
+		{
+			return m_staticPredicates.find(&predicate) != m_staticPredicates.cend();
+		};
 
-		m_outputStream << std::endl << colorlog::Function("variable") << "(";
+	const auto isMultiValuedPredicate =
+		[&](const auto &predicate)
+		{
+			return m_multiValuedVariables
+				&& m_multiValuedVariables->parts.find(&predicate) != m_multiValuedVariables->parts.cend();
+		};
 
-		translatePredicateDeclaration(m_outputStream, *predicate, variableIDs);
+	const auto isBooleanPredicate =
+		[&](const auto &predicate)
+		{
+			return !isStaticPredicate(predicate) && !isMultiValuedPredicate(predicate);
+		};
 
-		m_outputStream << ")";
+	if (m_grounding && m_grounding->hasGroundPredicates)
+	{
+		for (size_t predicateID = 0; predicateID < predicates.size(); predicateID++)
+		{
+			if (!isBooleanPredicate(*predicates[predicateID]))
+				continue;
 
-		if (!predicate->parameters.empty())
+			for (const auto &groundArguments : m_grounding->predicates[predicateID])
+			{
+				m_outputStream
+					<< std::endl << colorlog::Function("variable") << "("
+					<< colorlog::Keyword("variable") << "(";
+				translateGroundInstance(m_outputStream, *predicates[predicateID], groundArguments);
+				m_outputStream << ")).";
+			}
+		}
+	}
+	else
+	{
+		for (const auto &predicate : predicates)
 		{
-			m_outputStream << " :- ";
+			if (!isBooleanPredicate(*predicate))
+				continue;
 
 			VariableIDMap variableIDs;
 
-			translateVariablesForRuleBody(m_outputStream, predicate->parameters, variableIDs);
+			m_outputStream << std::endl << colorlog::Function("variable") << "(";
+
+			translatePredicateDeclaration(m_outputStream, *predicate, variableIDs);
+
+			m_outputStream << ")";
+
+			if (!predicate->parameters.empty())
+			{
+				m_outputStream << " :- ";
+
+				VariableIDMap variableIDs;
+
+				translateVariablesForRuleBody(m_outputStream, predicate->parameters, variableIDs);
+			}
+
+			m_outputStream << ".";
 		}
+	}
+
+	if (!m_multiValuedVariables || m_multiValuedVariables->parts.empty())
+	{
+		m_outputStream
+			<< std::endl << std::endl
+			<< colorlog::Function("contains") << "("
+			<< colorlog::Variable("X") << ", "
+			<< colorlog::Keyword("value") << "(" << colorlog::Variable("X") << ", " << colorlog::Variable("B") << ")) :- "
+			<< colorlog::Function("variable") << "(" << colorlog::Variable("X") << "), "
+			<< colorlog::Function("boolean") << "(" << colorlog::Variable("B") << ")."
+			<< std::endl;
 
+		return;
+	}
+
+	// Multi-valued variables are declared by rules over the types even if the predicates are ground,
+	// as the mutex groups are lifted
+	for (const auto &predicate : predicates)
+	{
+		if (!isMultiValuedPredicate(*predicate))
+			continue;
+
+		const auto &part = m_multiValuedVariables->parts.at(predicate.get());
+		auto variableIDs = invariantVariableIDs(*predicate, part.parameterPositions, part.numberOfParameters);
+
+		const auto printRuleBody =
+			[&]()
+			{
+				if (predicate->parameters.empty())
+					return;
+
+				m_outputStream << " :- ";
+				translateVariablesForRuleBody(m_outputStream, predicate->parameters, variableIDs);
+			};
+
+		m_outputStream << std::endl << colorlog::Function("variable") << "(";
+		translateMultiValuedVariable(m_outputStream, part,
+			[&](size_t position)
+			{
+				translateVariableDeclaration(m_outputStream, *predicate->parameters[position], variableIDs);
+			});
+		m_outputStream << ")";
+		printRuleBody();
+		m_outputStream << ".";
+
+		m_outputStream << std::endl << colorlog::Function("contains") << "(";
+		translatePredicateDeclarationToVariable(m_outputStream, *predicate, variableIDs, m_multiValuedVariables.get());
+		m_outputStream << ")";
+		printRuleBody();
 		m_outputStream << ".";
 	}
 
+	// All variables may be false, while only Boolean variables may be true
 	m_outputStream
 		<< std::endl << std::endl
 		<< colorlog::Function("contains") << "("
 		<< colorlog::Variable("X") << ", "
-		<< colorlog::Keyword("value") << "(" << colorlog::Variable("X") << ", " << colorlog::Variable("B") << ")) :- "
-		<< colorlog::Function("variable") << "(" << colorlog::Variable("X") << "), "
-		<< colorlog::Function("boolean") << "(" << colorlog::Variable("B") << ")."
+		<< colorlog::Keyword("value") << "(" << colorlog::Variable("X") << ", " << colorlog::Boolean("false") << ")) :- "
+		<< colorlog::Function("variable") << "(" << colorlog::Variable("X") << ")."
 		<< std::endl;
+
+	for (const auto &predicate : predicates)
+	{
+		if (!isBooleanPredicate(*predicate))
+			continue;
+
+		VariableIDMap variableIDs;
+
+		m_outputStream << std::endl << colorlog::Function("contains") << "(";
+		translatePredicateDeclarationToVariable(m_outputStream, *predicate, variableIDs);
+		m_outputStream << ") :- " << colorlog::Function("variable") << "(";
+		translatePredicateDeclaration(m_outputStream, *predicate, variableIDs);
+		m_outputStream << ").";
+	}
+
+	m_outputStream << std::endl;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -307,63 +560,43 @@ void TranslatorASP::translateActions() const
 
 	const auto &actions = m_description.domain->actions;
 
+	// Conditional effects are numbered consecutively across all actions, so the first conditional
+	// effect ID of each action is fixed up front to translate the actions independently
+	std::vector<size_t> conditionalEffectIDOffsets;
+	conditionalEffectIDOffsets.reserve(actions.size());
+
 	size_t numberOfConditionalEffects{0};
 
 	for (const auto &action : actions)
 	{
-		VariableIDMap variableIDs;
-
-		const auto printActionName =
-			[&]()
-			{
-				m_outputStream << colorlog::Keyword("action") << "(";
+		conditionalEffectIDOffsets.emplace_back(numberOfConditionalEffects);
 
-				if (action->parameters.empty())
-				{
-					m_outputStream << *action << ")";
-					return;
-				}
-
-				m_outputStream << "(" << *action;
-				translateVariablesForRuleHead(m_outputStream, action->parameters, variableIDs);
-				m_outputStream << "))";
-			};
-
-		const auto printPreconditionRuleBody =
-			[&]()
-			{
-				m_outputStream << " :- " << colorlog::Function("action") << "(";
-				printActionName();
-				m_outputStream << ")";
-			};
-
-		m_outputStream << std::endl;
-
-		// Name
-		m_outputStream << colorlog::Function("action") << "(";
-		printActionName();
-		m_outputStream << ")";
+		if (action->effect)
+			numberOfConditionalEffects += countConditionalEffects(action->effect.value());
+	}
 
-		if (!action->parameters.empty())
+	translateInParallel(m_outputStream, actions.size(), m_numberOfThreads,
+		[&](auto &outputStream, size_t actionID)
 		{
-			m_outputStream << " :- ";
-			translateVariablesForRuleBody(m_outputStream, action->parameters, variableIDs);
-		}
-
-		m_outputStream << ".";
-
-		// Precondition
-		if (action->precondition)
-			translatePrecondition(m_outputStream, action->precondition.value(), printActionName,
-				printPreconditionRuleBody, variableIDs);
+			auto numberOfConditionalEffects = conditionalEffectIDOffsets[actionID];
 
-		// Effect
-		if (action->effect)
-			translateEffect(m_outputStream, action->effect.value(), printActionName,
-				numberOfConditionalEffects, variableIDs);
+			const auto *staticPredicates = m_staticPredicates.empty() ? nullptr : &m_staticPredicates;
+			const auto *multiValuedVariables = m_multiValuedVariables.get();
 
-		m_outputStream << std::endl;
-	}
+			if (!m_grounding)
+			{
+				translateAction(outputStream, *actions[actionID], numberOfConditionalEffects, nullptr, staticPredicates,
+					multiValuedVariables);
+				return;
+			}
+
+			// Actions without reachable instances are omitted altogether
+			const auto &groundInstances = m_grounding->actions[actionID];
+
+			if (!groundInstances.empty())
+				translateAction(outputStream, *actions[actionID], numberOfConditionalEffects, &groundInstances,
+					staticPredicates, multiValuedVariables);
+		});
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -423,6 +656,13 @@ void TranslatorASP::translateProblem() const
 	m_outputStream << std::endl;
 	translateInitialState();
 
+	// Mutex groups
+	if (!m_invariants.empty())
+	{
+		m_outputStream << std::endl;
+		translateMutexGroups();
+	}
+
 	// Derived predicates
 	if (!problem->derivedPredicates.empty())
 	{
@@ -448,8 +688,75 @@ void TranslatorASP::translateInitialState() const
 
 	const auto &facts = m_description.problem.value()->initialState.facts;
 
-	for (const auto &fact : facts)
-		::plasp::pddl::translateFact(m_outputStream, fact);
+	translateInParallel(m_outputStream, facts.size(), m_numberOfThreads,
+		[&](auto &outputStream, size_t factID)
+		{
+			this->translateInitialStateFact(outputStream, facts[factID]);
+		});
+
+	translateDefaultInitialState();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TranslatorASP::translateInitialStateFact(colorlog::ColorStream &outputStream, const ::pddl::normalizedAST::Fact &fact) const
+{
+	if (!m_staticPredicates.empty() || m_multiValuedVariables)
+	{
+		const auto isPositive = fact.is<::pddl::normalizedAST::AtomicFormula>();
+		const auto &atomicFormula = isPositive
+			? fact.get<::pddl::normalizedAST::AtomicFormula>()
+			: fact.get<::pddl::normalizedAST::NotPointer<::pddl::normalizedAST::AtomicFormula>>()->argument;
+
+		if (atomicFormula.is<::pddl::normalizedAST::PredicatePointer>())
+		{
+			const auto &predicate = atomicFormula.get<::pddl::normalizedAST::PredicatePointer>();
+
+			// Static facts are false unless stated otherwise
+			if (m_staticPredicates.find(predicate->declaration) != m_staticPredicates.cend())
+			{
+				if (isPositive)
+					translateStaticFact(outputStream, *predicate);
+
+				return;
+			}
+
+			// Multi-valued variables are false unless one of their atoms is stated to be true
+			if (!isPositive && m_multiValuedVariables
+				&& m_multiValuedVariables->parts.find(predicate->declaration) != m_multiValuedVariables->parts.cend())
+			{
+				return;
+			}
+		}
+	}
+
+	::plasp::pddl::translateFact(outputStream, fact, m_multiValuedVariables.get());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TranslatorASP::translateDefaultInitialState() const
+{
+	if (m_multiValuedVariables && !m_multiValuedVariables->parts.empty())
+	{
+		m_outputStream
+			<< std::endl << std::endl
+			<< colorlog::Function("initialState") << "("
+			<< colorlog::Variable("X") << ", "
+			<< colorlog::Keyword("value") << "(" << colorlog::Variable("X") << ", " << colorlog::Boolean("false") << ")) :- "
+			<< colorlog::Function("variable") << "(" << colorlog::Variable("X") << "), "
+			<< colorlog::Keyword("not") << " "
+			<< colorlog::Function("initialState") << "("
+			<< colorlog::Variable("X") << ", "
+			<< colorlog::Keyword("value") << "(" << colorlog::Variable("X") << ", " << colorlog::Variable("V") << ")) : "
+			<< colorlog::Function("contains") << "("
+			<< colorlog::Variable("X") << ", "
+			<< colorlog::Keyword("value") << "(" << colorlog::Variable("X") << ", " << colorlog::Variable("V") << ")), "
+			<< colorlog::Variable("V") << " != " << colorlog::Boolean("false") << "."
+			<< std::endl;
+
+		return;
+	}
 
 	m_outputStream
 		<< std::endl << std::endl
@@ -466,6 +773,83 @@ void TranslatorASP::translateInitialState() const
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void TranslatorASP::translateMutexGroups() const
+{
+	m_outputStream << colorlog::Heading2("mutex groups");
+
+	// Invariants translated as multi-valued variables are already enforced by the variables’ values
+	const auto isMultiValuedVariable =
+		[&](size_t invariantID)
+		{
+			if (!m_multiValuedVariables)
+				return false;
+
+			const auto &parts = m_invariants[invariantID].parts;
+			const auto matchingPart = m_multiValuedVariables->parts.find(parts.front().predicate);
+
+			return matchingPart != m_multiValuedVariables->parts.cend()
+				&& matchingPart->second.invariantID == invariantID;
+		};
+
+	for (size_t invariantID = 0; invariantID < m_invariants.size(); invariantID++)
+	{
+		if (isMultiValuedVariable(invariantID))
+			continue;
+
+		const auto &invariant = m_invariants[invariantID];
+
+		m_outputStream << std::endl;
+
+		for (const auto &part : invariant.parts)
+		{
+			const auto &predicate = *part.predicate;
+			auto variableIDs = invariantVariableIDs(predicate, part.parameterPositions, invariant.numberOfParameters);
+
+			m_outputStream
+				<< std::endl << colorlog::Function("contains") << "("
+				<< colorlog::Keyword("mutexGroup") << "(";
+
+			if (invariant.numberOfParameters == 0)
+				m_outputStream << colorlog::Number<size_t>(invariantID);
+			else
+			{
+				m_outputStream << "(" << colorlog::Number<size_t>(invariantID);
+
+				for (size_t i = 0; i < invariant.numberOfParameters; i++)
+				{
+					const auto variableName = "X" + std::to_string(i + 1);
+					m_outputStream << ", " << colorlog::Variable(variableName.c_str());
+				}
+
+				m_outputStream << ")";
+			}
+
+			m_outputStream << "), ";
+			translatePredicateDeclarationToVariable(m_outputStream, predicate, variableIDs, m_multiValuedVariables.get());
+			m_outputStream << ")";
+
+			if (!predicate.parameters.empty())
+			{
+				m_outputStream << " :- ";
+				translateVariablesForRuleBody(m_outputStream, predicate.parameters, variableIDs);
+			}
+
+			m_outputStream << ".";
+		}
+	}
+
+	m_outputStream
+		<< std::endl << std::endl
+		<< colorlog::Function("mutexGroup") << "(" << colorlog::Variable("M") << ") :- "
+		<< colorlog::Function("contains") << "("
+		<< colorlog::Variable("M") << ", "
+		<< colorlog::Variable("X") << ", "
+		<< colorlog::Variable("V") << ")."
+		<< std::endl;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void TranslatorASP::translateGoal() const
 {
 	assert(m_description.problem);
@@ -475,7 +859,7 @@ void TranslatorASP::translateGoal() const
 
 	const auto &goal = m_description.problem.value()->goal.value();
 
-	::plasp::pddl::translateGoal(m_outputStream, goal);
+	::plasp::pddl::translateGoal(m_outputStream, goal, m_multiValuedVariables.get());
 
 	m_outputStream << std::endl;
 }
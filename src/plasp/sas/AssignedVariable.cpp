@@ -14,60 +14,87 @@ namespace sas
 //
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-AssignedVariable::AssignedVariable()
-:	m_variable{nullptr},
-	m_value{nullptr}
+AssignedVariable::AssignedVariable(size_t variableID, int valueID)
+:	m_variableID{static_cast<uint32_t>(variableID)},
+	m_valueID{valueID}
 {
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-AssignedVariable::AssignedVariable(const Variable &variable, const Value &value)
-:	m_variable{&variable},
-	m_value{&value}
+AssignedVariable AssignedVariable::fromSAS(tokenize::Tokenizer<> &tokenizer, const Variables &variables)
 {
+	const auto variableID = Variable::referenceFromSAS(tokenizer, variables);
+
+	return fromSAS(tokenizer, variables, variableID);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-AssignedVariable AssignedVariable::fromSAS(tokenize::Tokenizer<> &tokenizer, const Variables &variables)
+AssignedVariable AssignedVariable::fromBinary(BinaryReader &reader, const Variables &variables)
 {
-	AssignedVariable assignedVariable;
+	const auto variableID = reader.getSize();
+	const auto valueID = reader.getInt32();
 
-	assignedVariable.m_variable = &Variable::referenceFromSAS(tokenizer, variables);
-	assignedVariable.m_value = &Value::referenceFromSAS(tokenizer, *assignedVariable.m_variable);
+	if (variableID >= variables.size()
+		|| valueID < 0 || static_cast<size_t>(valueID) >= variables[variableID].values().size())
+	{
+		throw std::runtime_error("malformed binary SAS description (variable or value index out of range)");
+	}
 
-	return assignedVariable;
+	return AssignedVariable(variableID, valueID);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-AssignedVariable AssignedVariable::fromSAS(tokenize::Tokenizer<> &tokenizer, const Variable &variable)
+AssignedVariable AssignedVariable::fromSAS(tokenize::Tokenizer<> &tokenizer, const Variables &variables, size_t variableID)
 {
-	AssignedVariable assignedVariable;
+	return AssignedVariable(variableID, Value::referenceFromSAS(tokenizer, variables[variableID]));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+size_t AssignedVariable::variableID() const
+{
+	return m_variableID;
+}
 
-	assignedVariable.m_variable = &variable;
-	assignedVariable.m_value = &Value::referenceFromSAS(tokenizer, *assignedVariable.m_variable);
+////////////////////////////////////////////////////////////////////////////////////////////////////
 
-	return assignedVariable;
+int AssignedVariable::valueID() const
+{
+	return m_valueID;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-const Variable &AssignedVariable::variable() const
+const Variable &AssignedVariable::variable(const Variables &variables) const
 {
-	assert(m_variable != nullptr);
+	assert(m_variableID < variables.size());
 
-	return *m_variable;
+	return variables[m_variableID];
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-const Value &AssignedVariable::value() const
+const Value &AssignedVariable::value(const Variables &variables) const
 {
-	assert(m_value != nullptr);
+	if (m_valueID == Value::AnyID)
+		return Value::Any;
+
+	const auto &values = variable(variables).values();
 
-	return *m_value;
+	assert(static_cast<size_t>(m_valueID) < values.size());
+
+	return values[m_valueID];
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void AssignedVariable::writeBinary(BinaryWriter &writer) const
+{
+	writer.writeUInt32(m_variableID);
+	writer.writeInt32(m_valueID);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
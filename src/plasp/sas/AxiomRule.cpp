@@ -37,12 +37,12 @@ AxiomRule AxiomRule::fromSAS(tokenize::Tokenizer<> &tokenizer, const Variables &
 
 	const auto variableTransition = VariableTransition::fromSAS(tokenizer, variables);
 
-	if (&variableTransition.valueBefore() != &Value::Any)
-		conditions.emplace_back(Condition(variableTransition.variable(), variableTransition.valueBefore()));
+	if (variableTransition.valueBeforeID() != Value::AnyID)
+		conditions.emplace_back(Condition(variableTransition.variableID(), variableTransition.valueBeforeID()));
 
 	tokenizer.expect<std::string>("end_rule");
 
-	const Condition postcondition(variableTransition.variable(), variableTransition.valueAfter());
+	const Condition postcondition(variableTransition.variableID(), variableTransition.valueAfterID());
 	const AxiomRule axiomRule(std::move(conditions), std::move(postcondition));
 
 	return axiomRule;
@@ -50,6 +50,23 @@ AxiomRule AxiomRule::fromSAS(tokenize::Tokenizer<> &tokenizer, const Variables &
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+AxiomRule AxiomRule::fromBinary(BinaryReader &reader, const Variables &variables)
+{
+	const auto numberOfConditions = reader.getNumberOfElements(8);
+
+	Conditions conditions;
+	conditions.reserve(numberOfConditions);
+
+	for (size_t j = 0; j < numberOfConditions; j++)
+		conditions.emplace_back(Condition::fromBinary(reader, variables));
+
+	const auto postcondition = Condition::fromBinary(reader, variables);
+
+	return AxiomRule(std::move(conditions), postcondition);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 const AxiomRule::Conditions &AxiomRule::conditions() const
 {
 	return m_conditions;
@@ -64,5 +81,17 @@ const AxiomRule::Condition &AxiomRule::postcondition() const
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void AxiomRule::writeBinary(BinaryWriter &writer) const
+{
+	writer.writeSize(m_conditions.size());
+
+	for (const auto &condition : m_conditions)
+		condition.writeBinary(writer);
+
+	m_postcondition.writeBinary(writer);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 }
 }
@@ -28,7 +28,7 @@ colorlog::ColorStream &operator<<(colorlog::ColorStream &stream, const Descripti
 		{
 			const auto &values = variable.values();
 
-			stream << "\t" << variable.name() << ":" << std::endl;
+			stream << "\t" << variable.name().data() << ":" << std::endl;
 			stream << "\t\tvalues: " << values.size() << std::endl;
 
 			std::for_each(values.cbegin(), values.cend(),
@@ -55,8 +55,8 @@ colorlog::ColorStream &operator<<(colorlog::ColorStream &stream, const Descripti
 			std::for_each(mutexGroup.facts().cbegin(), mutexGroup.facts().cend(),
 				[&](const auto &fact)
 				{
-					stream << "\t\t" << fact.variable().name() << " = ";
-					fact.value().printAsSAS(stream);
+					stream << "\t\t" << fact.variable(variables).name().data() << " = ";
+					fact.value(variables).printAsSAS(stream);
 					stream << std::endl;
 				});
 		});
@@ -69,8 +69,8 @@ colorlog::ColorStream &operator<<(colorlog::ColorStream &stream, const Descripti
 	std::for_each(initialState.facts().cbegin(), initialState.facts().cend(),
 		[&](const auto &fact)
 		{
-			stream << "\t" << fact.variable().name() << " = ";
-			fact.value().printAsSAS(stream);
+			stream << "\t" << fact.variable(variables).name().data() << " = ";
+			fact.value(variables).printAsSAS(stream);
 			stream << std::endl;
 		});
 
@@ -82,8 +82,8 @@ colorlog::ColorStream &operator<<(colorlog::ColorStream &stream, const Descripti
 	std::for_each(goal.facts().cbegin(), goal.facts().cend(),
 		[&](const auto &fact)
 		{
-			stream << "\t" << fact.variable().name() << " = ";
-			fact.value().printAsSAS(stream);
+			stream << "\t" << fact.variable(variables).name().data() << " = ";
+			fact.value(variables).printAsSAS(stream);
 			stream << std::endl;
 		});
 
@@ -106,8 +106,8 @@ colorlog::ColorStream &operator<<(colorlog::ColorStream &stream, const Descripti
 			std::for_each(preconditions.cbegin(), preconditions.cend(),
 				[&](const auto &precondition)
 				{
-					std::cout << "\t\t\t" << precondition.variable().name() << " = ";
-					precondition.value().printAsSAS(stream);
+					std::cout << "\t\t\t" << precondition.variable(variables).name().data() << " = ";
+					precondition.value(variables).printAsSAS(stream);
 					stream << std::endl;
 				});
 
@@ -127,14 +127,14 @@ colorlog::ColorStream &operator<<(colorlog::ColorStream &stream, const Descripti
 					std::for_each(conditions.cbegin(), conditions.cend(),
 						[&](const auto &condition)
 						{
-							stream << "\t\t\t\t\t" << condition.variable().name() << " = ";
-							condition.value().printAsSAS(stream);
+							stream << "\t\t\t\t\t" << condition.variable(variables).name().data() << " = ";
+							condition.value(variables).printAsSAS(stream);
 							stream << std::endl;
 						});
 
 					stream << "\t\t\t\tpostcondition:" << std::endl;
-					stream << "\t\t\t\t\t" << effect.postcondition().variable().name() << " = ";
-					effect.postcondition().value().printAsSAS(stream);
+					stream << "\t\t\t\t\t" << effect.postcondition().variable(variables).name().data() << " = ";
+					effect.postcondition().value(variables).printAsSAS(stream);
 					stream << std::endl;
 				});
 
@@ -158,14 +158,14 @@ colorlog::ColorStream &operator<<(colorlog::ColorStream &stream, const Descripti
 			std::for_each(conditions.cbegin(), conditions.cend(),
 				[&](const auto &condition)
 				{
-					stream << "\t\t\t" << condition.variable().name() << " = ";
-					condition.value().printAsSAS(stream);
+					stream << "\t\t\t" << condition.variable(variables).name().data() << " = ";
+					condition.value(variables).printAsSAS(stream);
 					stream << std::endl;
 				});
 
 			stream << "\t\tpostcondition:" << std::endl;
-			stream << "\t\t\t" << axiomRule.postcondition().variable().name() << " = ";
-			axiomRule.postcondition().value().printAsSAS(stream);
+			stream << "\t\t\t" << axiomRule.postcondition().variable(variables).name().data() << " = ";
+			axiomRule.postcondition().value(variables).printAsSAS(stream);
 			stream << std::endl;
 		});
 
@@ -1,12 +1,17 @@
 #include <plasp/sas/Description.h>
 
 #include <algorithm>
+#include <atomic>
+#include <cctype>
 #include <iostream>
 #include <fstream>
 #include <sstream>
+#include <thread>
 
 #include <tokenize/TokenizerException.h>
 
+#include <plasp/ParallelTranslation.h>
+
 #include <plasp/sas/VariableTransition.h>
 
 namespace plasp
@@ -20,6 +25,146 @@ namespace sas
 //
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Sections with fewer elements per thread are not worth splitting up
+constexpr size_t MinimumNumberOfElementsPerThread = 256;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Finds the positions right after the next numberOfElements occurrences of the keyword that ends
+// each element (as a separate token)
+std::vector<tokenize::StreamPosition> findElementEnds(const std::string &content,
+	tokenize::StreamPosition position, const std::string &endKeyword, size_t numberOfElements)
+{
+	std::vector<tokenize::StreamPosition> elementEnds;
+	elementEnds.reserve(numberOfElements);
+
+	const auto isWhiteSpace =
+		[&](tokenize::StreamPosition position)
+		{
+			return std::isspace(static_cast<unsigned char>(content[position]));
+		};
+
+	while (elementEnds.size() < numberOfElements)
+	{
+		position = content.find(endKeyword, position);
+
+		if (position == std::string::npos)
+			break;
+
+		const auto end = position + endKeyword.size();
+
+		if (position > 0 && isWhiteSpace(position - 1) && (end == content.size() || isWhiteSpace(end)))
+			elementEnds.emplace_back(end);
+
+		position = end;
+	}
+
+	return elementEnds;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Splits the elements of a section into contiguous slices by scanning for their end keywords, which
+// are then parsed by multiple threads with separate tokenizers and concatenated in order. Returns
+// false if the section cannot be parsed this way, which leaves it to the sequential parser to report
+// the error at the right location
+template<class Element>
+bool parseInParallel(tokenize::Tokenizer<> &tokenizer, size_t numberOfElements, const std::string &endKeyword,
+	const Variables &variables, size_t numberOfThreads, std::vector<Element> &elements)
+{
+	numberOfThreads = std::min(resolveNumberOfThreads(numberOfThreads), numberOfElements / MinimumNumberOfElementsPerThread);
+
+	if (numberOfThreads <= 1)
+		return false;
+
+	const auto &content = tokenizer.content();
+	const auto sectionStart = tokenizer.position();
+	const auto elementEnds = findElementEnds(content, sectionStart, endKeyword, numberOfElements);
+
+	if (elementEnds.size() < numberOfElements)
+		return false;
+
+	const auto numberOfSlices = std::min(numberOfElements, numberOfThreads * ChunksPerThread);
+
+	std::vector<std::vector<Element>> slices(numberOfSlices);
+	std::atomic<size_t> nextSliceID{0};
+	std::atomic<bool> hasFailed{false};
+
+	const auto parseSlices =
+		[&]()
+		{
+			while (!hasFailed)
+			{
+				const auto sliceID = nextSliceID++;
+
+				if (sliceID >= numberOfSlices)
+					return;
+
+				const auto begin = numberOfElements * sliceID / numberOfSlices;
+				const auto end = numberOfElements * (sliceID + 1) / numberOfSlices;
+
+				const auto contentBegin = (begin == 0) ? sectionStart : elementEnds[begin - 1];
+				const auto contentEnd = elementEnds[end - 1];
+
+				try
+				{
+					std::istringstream sliceStream(content.substr(contentBegin, contentEnd - contentBegin));
+					tokenize::Tokenizer<> sliceTokenizer("slice", sliceStream);
+
+					auto &slice = slices[sliceID];
+					slice.reserve(end - begin);
+
+					for (auto i = begin; i < end; i++)
+						slice.emplace_back(Element::fromSAS(sliceTokenizer, variables));
+
+					sliceTokenizer.skipWhiteSpace();
+
+					if (!sliceTokenizer.atEnd())
+						hasFailed = true;
+				}
+				catch (...)
+				{
+					hasFailed = true;
+				}
+			}
+		};
+
+	std::vector<std::thread> threads;
+	threads.reserve(numberOfThreads);
+
+	for (size_t i = 0; i < numberOfThreads; i++)
+		threads.emplace_back(parseSlices);
+
+	for (auto &thread : threads)
+		thread.join();
+
+	if (hasFailed)
+		return false;
+
+	elements.reserve(numberOfElements);
+
+	for (auto &slice : slices)
+	{
+		std::move(slice.begin(), slice.end(), std::back_inserter(elements));
+		std::vector<Element>().swap(slice);
+	}
+
+	tokenizer.seek(elementEnds.back());
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 Description::Description()
 :	m_usesActionCosts{false}
 {
@@ -27,10 +172,10 @@ Description::Description()
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-Description Description::fromTokenizer(tokenize::Tokenizer<> &&tokenizer)
+Description Description::fromTokenizer(tokenize::Tokenizer<> &&tokenizer, size_t numberOfThreads)
 {
 	Description description;
-	description.parseContent(tokenizer);
+	description.parseContent(tokenizer, numberOfThreads);
 
 	return description;
 }
@@ -66,6 +211,68 @@ Description Description::fromFile(const std::experimental::filesystem::path &pat
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+Description Description::fromBinaryFile(const std::experimental::filesystem::path &path)
+{
+	if (!std::experimental::filesystem::is_regular_file(path))
+		throw std::runtime_error("File does not exist: “" + path.string() + "”");
+
+	Description description;
+	description.m_mappedFile = std::make_unique<MappedFile>(path.string());
+
+	BinaryReader reader(description.m_mappedFile->data(), description.m_mappedFile->size());
+	reader.readHeader();
+
+	description.m_usesActionCosts = (reader.getUInt32() != 0);
+
+	const auto numberOfVariables = reader.getNumberOfElements(16);
+	description.m_variables.reserve(numberOfVariables);
+
+	for (size_t i = 0; i < numberOfVariables; i++)
+		description.m_variables.emplace_back(Variable::fromBinary(reader));
+
+	const auto &variables = description.m_variables;
+
+	const auto numberOfMutexGroups = reader.getNumberOfElements(4);
+	description.m_mutexGroups.reserve(numberOfMutexGroups);
+
+	for (size_t i = 0; i < numberOfMutexGroups; i++)
+		description.m_mutexGroups.emplace_back(MutexGroup::fromBinary(reader, variables));
+
+	description.m_initialState = std::make_unique<InitialState>(InitialState::fromBinary(reader, variables));
+	description.m_goal = std::make_unique<Goal>(Goal::fromBinary(reader, variables));
+
+	const auto numberOfOperators = reader.getNumberOfElements(28);
+	description.m_operators.reserve(numberOfOperators);
+
+	for (size_t i = 0; i < numberOfOperators; i++)
+		description.m_operators.emplace_back(Operator::fromBinary(reader, variables));
+
+	const auto numberOfAxiomRules = reader.getNumberOfElements(12);
+	description.m_axiomRules.reserve(numberOfAxiomRules);
+
+	for (size_t i = 0; i < numberOfAxiomRules; i++)
+		description.m_axiomRules.emplace_back(AxiomRule::fromBinary(reader, variables));
+
+	if (!reader.atEnd())
+		throw std::runtime_error("malformed binary SAS description (unexpected data at end of file)");
+
+	return description;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool Description::isBinaryFile(const std::experimental::filesystem::path &path)
+{
+	std::ifstream fileStream(path.string(), std::ios::in | std::ios::binary);
+
+	char header[sizeof(BinaryMagic)];
+	fileStream.read(header, sizeof(header));
+
+	return BinaryReader::hasMagic(header, static_cast<size_t>(fileStream.gcount()));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 bool Description::usesActionCosts() const
 {
 	return m_usesActionCosts;
@@ -159,7 +366,41 @@ bool Description::hasRequirements() const
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void Description::parseContent(tokenize::Tokenizer<> &tokenizer)
+void Description::writeBinary(std::ostream &ostream) const
+{
+	BinaryWriter writer;
+
+	writer.writeUInt32(m_usesActionCosts ? 1 : 0);
+
+	writer.writeSize(m_variables.size());
+
+	for (const auto &variable : m_variables)
+		variable.writeBinary(writer);
+
+	writer.writeSize(m_mutexGroups.size());
+
+	for (const auto &mutexGroup : m_mutexGroups)
+		mutexGroup.writeBinary(writer);
+
+	m_initialState->writeBinary(writer);
+	m_goal->writeBinary(writer);
+
+	writer.writeSize(m_operators.size());
+
+	for (const auto &operator_ : m_operators)
+		operator_.writeBinary(writer);
+
+	writer.writeSize(m_axiomRules.size());
+
+	for (const auto &axiomRule : m_axiomRules)
+		axiomRule.writeBinary(writer);
+
+	writer.writeTo(ostream);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void Description::parseContent(tokenize::Tokenizer<> &tokenizer, size_t numberOfThreads)
 {
 	parseVersionSection(tokenizer);
 	parseMetricSection(tokenizer);
@@ -167,8 +408,8 @@ void Description::parseContent(tokenize::Tokenizer<> &tokenizer)
 	parseMutexSection(tokenizer);
 	parseInitialStateSection(tokenizer);
 	parseGoalSection(tokenizer);
-	parseOperatorSection(tokenizer);
-	parseAxiomSection(tokenizer);
+	parseOperatorSection(tokenizer, numberOfThreads);
+	parseAxiomSection(tokenizer, numberOfThreads);
 
 	tokenizer.skipWhiteSpace();
 
@@ -209,7 +450,7 @@ void Description::parseVariablesSection(tokenize::Tokenizer<> &tokenizer)
 	m_variables.reserve(numberOfVariables);
 
 	for (size_t i = 0; i < numberOfVariables; i++)
-		m_variables.emplace_back(Variable::fromSAS(tokenizer));
+		m_variables.emplace_back(Variable::fromSAS(tokenizer, m_names));
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -239,9 +480,13 @@ void Description::parseGoalSection(tokenize::Tokenizer<> &tokenizer)
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void Description::parseOperatorSection(tokenize::Tokenizer<> &tokenizer)
+void Description::parseOperatorSection(tokenize::Tokenizer<> &tokenizer, size_t numberOfThreads)
 {
 	const auto numberOfOperators = tokenizer.get<size_t>();
+
+	if (parseInParallel(tokenizer, numberOfOperators, "end_operator", m_variables, numberOfThreads, m_operators))
+		return;
+
 	m_operators.reserve(numberOfOperators);
 
 	for (size_t i = 0; i < numberOfOperators; i++)
@@ -250,9 +495,13 @@ void Description::parseOperatorSection(tokenize::Tokenizer<> &tokenizer)
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void Description::parseAxiomSection(tokenize::Tokenizer<> &tokenizer)
+void Description::parseAxiomSection(tokenize::Tokenizer<> &tokenizer, size_t numberOfThreads)
 {
 	const auto numberOfAxiomRules = tokenizer.get<size_t>();
+
+	if (parseInParallel(tokenizer, numberOfAxiomRules, "end_rule", m_variables, numberOfThreads, m_axiomRules))
+		return;
+
 	m_axiomRules.reserve(numberOfAxiomRules);
 
 	for (size_t i = 0; i < numberOfAxiomRules; i++)
@@ -35,16 +35,33 @@ Effect Effect::fromSAS(tokenize::Tokenizer<> &tokenizer, const Variables &variab
 
 	const auto variableTransition = VariableTransition::fromSAS(tokenizer, variables);
 
-	if (&variableTransition.valueBefore() != &Value::Any)
-		preconditions.emplace_back(Condition(variableTransition.variable(), variableTransition.valueBefore()));
+	if (variableTransition.valueBeforeID() != Value::AnyID)
+		preconditions.emplace_back(Condition(variableTransition.variableID(), variableTransition.valueBeforeID()));
 
-	const Effect::Condition postcondition(variableTransition.variable(), variableTransition.valueAfter());
+	const Effect::Condition postcondition(variableTransition.variableID(), variableTransition.valueAfterID());
 
 	return Effect(std::move(conditions), std::move(postcondition));
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+Effect Effect::fromBinary(BinaryReader &reader, const Variables &variables)
+{
+	Effect::Conditions conditions;
+
+	const auto numberOfEffectConditions = reader.getNumberOfElements(8);
+	conditions.reserve(numberOfEffectConditions);
+
+	for (size_t k = 0; k < numberOfEffectConditions; k++)
+		conditions.emplace_back(Condition::fromBinary(reader, variables));
+
+	const auto postcondition = Condition::fromBinary(reader, variables);
+
+	return Effect(std::move(conditions), postcondition);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 const Effect::Conditions &Effect::conditions() const
 {
 	return m_conditions;
@@ -59,5 +76,17 @@ const Effect::Condition &Effect::postcondition() const
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void Effect::writeBinary(BinaryWriter &writer) const
+{
+	writer.writeSize(m_conditions.size());
+
+	for (const auto &condition : m_conditions)
+		condition.writeBinary(writer);
+
+	m_postcondition.writeBinary(writer);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 }
 }
@@ -0,0 +1,41 @@
+#include <plasp/sas/FactSink.h>
+
+namespace plasp
+{
+namespace sas
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// FactSink
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void FactSink::beginSection(Section)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool FactSink::supportsChunks() const
+{
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::unique_ptr<FactSink> FactSink::makeChunkSink()
+{
+	return nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void FactSink::appendChunk(FactSink &)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
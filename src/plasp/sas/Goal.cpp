@@ -32,6 +32,21 @@ Goal Goal::fromSAS(tokenize::Tokenizer<> &tokenizer, const Variables &variables)
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+Goal Goal::fromBinary(BinaryReader &reader, const Variables &variables)
+{
+	Goal goal;
+
+	const auto numberOfFacts = reader.getNumberOfElements(8);
+	goal.m_facts.reserve(numberOfFacts);
+
+	for (size_t i = 0; i < numberOfFacts; i++)
+		goal.m_facts.emplace_back(Fact::fromBinary(reader, variables));
+
+	return goal;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 const Goal::Facts &Goal::facts() const
 {
 	return m_facts;
@@ -39,5 +54,15 @@ const Goal::Facts &Goal::facts() const
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void Goal::writeBinary(BinaryWriter &writer) const
+{
+	writer.writeSize(m_facts.size());
+
+	for (const auto &fact : m_facts)
+		fact.writeBinary(writer);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 }
 }
@@ -20,7 +20,7 @@ InitialState InitialState::fromSAS(tokenize::Tokenizer<> &tokenizer, const Varia
 	initialState.m_facts.reserve(variables.size());
 
 	for (size_t i = 0; i < variables.size(); i++)
-		initialState.m_facts.emplace_back(Fact::fromSAS(tokenizer, variables[i]));
+		initialState.m_facts.emplace_back(Fact::fromSAS(tokenizer, variables, i));
 
 	tokenizer.expect<std::string>("end_state");
 
@@ -29,6 +29,21 @@ InitialState InitialState::fromSAS(tokenize::Tokenizer<> &tokenizer, const Varia
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+InitialState InitialState::fromBinary(BinaryReader &reader, const Variables &variables)
+{
+	InitialState initialState;
+
+	const auto numberOfFacts = reader.getNumberOfElements(8);
+	initialState.m_facts.reserve(numberOfFacts);
+
+	for (size_t i = 0; i < numberOfFacts; i++)
+		initialState.m_facts.emplace_back(Fact::fromBinary(reader, variables));
+
+	return initialState;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 const InitialState::Facts &InitialState::facts() const
 {
 	return m_facts;
@@ -36,5 +51,15 @@ const InitialState::Facts &InitialState::facts() const
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void InitialState::writeBinary(BinaryWriter &writer) const
+{
+	writer.writeSize(m_facts.size());
+
+	for (const auto &fact : m_facts)
+		fact.writeBinary(writer);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 }
 }
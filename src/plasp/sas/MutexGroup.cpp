@@ -28,7 +28,7 @@ MutexGroup MutexGroup::fromSAS(tokenize::Tokenizer<> &tokenizer, const Variables
 	{
 		mutexGroup.m_facts.emplace_back(Fact::fromSAS(tokenizer, variables));
 
-		if (mutexGroup.m_facts[j].value() == Value::None)
+		if (mutexGroup.m_facts[j].value(variables) == Value::None)
 			throw tokenize::TokenizerException(tokenizer.location(), "mutex groups must not contain <none of those> values");
 	}
 
@@ -39,6 +39,21 @@ MutexGroup MutexGroup::fromSAS(tokenize::Tokenizer<> &tokenizer, const Variables
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+MutexGroup MutexGroup::fromBinary(BinaryReader &reader, const Variables &variables)
+{
+	MutexGroup mutexGroup;
+
+	const auto numberOfFacts = reader.getNumberOfElements(8);
+	mutexGroup.m_facts.reserve(numberOfFacts);
+
+	for (size_t i = 0; i < numberOfFacts; i++)
+		mutexGroup.m_facts.emplace_back(Fact::fromBinary(reader, variables));
+
+	return mutexGroup;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 const MutexGroup::Facts &MutexGroup::facts() const
 {
 	return m_facts;
@@ -46,5 +61,15 @@ const MutexGroup::Facts &MutexGroup::facts() const
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void MutexGroup::writeBinary(BinaryWriter &writer) const
+{
+	writer.writeSize(m_facts.size());
+
+	for (const auto &fact : m_facts)
+		fact.writeBinary(writer);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 }
 }
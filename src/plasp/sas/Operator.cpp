@@ -47,6 +47,32 @@ Operator Operator::fromSAS(tokenize::Tokenizer<> &tokenizer, const Variables &va
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+Operator Operator::fromBinary(BinaryReader &reader, const Variables &variables)
+{
+	Operator operator_;
+
+	operator_.m_predicate = Predicate::fromBinary(reader);
+
+	// The preconditions of effects are stored along with the prevail conditions
+	const auto numberOfPreconditions = reader.getNumberOfElements(8);
+	operator_.m_preconditions.reserve(numberOfPreconditions);
+
+	for (size_t j = 0; j < numberOfPreconditions; j++)
+		operator_.m_preconditions.emplace_back(Condition::fromBinary(reader, variables));
+
+	const auto numberOfEffects = reader.getNumberOfElements(12);
+	operator_.m_effects.reserve(numberOfEffects);
+
+	for (size_t j = 0; j < numberOfEffects; j++)
+		operator_.m_effects.emplace_back(Effect::fromBinary(reader, variables));
+
+	operator_.m_costs = reader.getUInt64();
+
+	return operator_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void Operator::printPredicateAsASP(colorlog::ColorStream &stream) const
 {
 	stream << colorlog::Keyword("action") << "(";
@@ -84,5 +110,24 @@ size_t Operator::costs() const
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void Operator::writeBinary(BinaryWriter &writer) const
+{
+	m_predicate.writeBinary(writer);
+
+	writer.writeSize(m_preconditions.size());
+
+	for (const auto &precondition : m_preconditions)
+		precondition.writeBinary(writer);
+
+	writer.writeSize(m_effects.size());
+
+	for (const auto &effect : m_effects)
+		effect.writeBinary(writer);
+
+	writer.writeUInt64(m_costs);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 }
 }
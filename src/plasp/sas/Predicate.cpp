@@ -52,6 +52,23 @@ Predicate Predicate::fromSAS(tokenize::Tokenizer<> &tokenizer)
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+Predicate Predicate::fromBinary(BinaryReader &reader)
+{
+	Predicate predicate;
+
+	predicate.m_name = reader.getString();
+
+	const auto numberOfArguments = reader.getNumberOfElements(8);
+	predicate.m_arguments.reserve(numberOfArguments);
+
+	for (size_t i = 0; i < numberOfArguments; i++)
+		predicate.m_arguments.emplace_back(reader.getString());
+
+	return predicate;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 const std::string &Predicate::name() const
 {
 	return m_name;
@@ -102,5 +119,16 @@ void Predicate::printAsASP(colorlog::ColorStream &stream) const
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void Predicate::writeBinary(BinaryWriter &writer) const
+{
+	writer.writeString(m_name);
+	writer.writeSize(m_arguments.size());
+
+	for (const auto &argument : m_arguments)
+		writer.writeString(argument);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 }
 }
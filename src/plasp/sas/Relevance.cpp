@@ -0,0 +1,449 @@
+#include <plasp/sas/Relevance.h>
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+
+namespace plasp
+{
+namespace sas
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Relevance
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Relevance::Relevance(const Description &description)
+:	m_description(description)
+{
+	const auto &variables = description.variables();
+
+	m_factIDOffsets.reserve(variables.size());
+
+	size_t numberOfFacts = 0;
+
+	for (const auto &variable : variables)
+	{
+		m_factIDOffsets.emplace_back(numberOfFacts);
+		numberOfFacts += variable.values().size();
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Relevance Relevance::analyze(const Description &description, PruningMode pruningMode)
+{
+	Relevance relevance(description);
+
+	const auto &variables = description.variables();
+	const auto &operators = description.operators();
+	const auto &axiomRules = description.axiomRules();
+
+	const auto numberOfFacts = variables.empty()
+		? size_t(0)
+		: relevance.m_factIDOffsets.back() + variables.back().values().size();
+
+	const auto usesForwardChaining = (pruningMode == PruningMode::Forward || pruningMode == PruningMode::Both);
+	const auto usesBackwardRegression = (pruningMode == PruningMode::Backward || pruningMode == PruningMode::Both)
+		&& !description.usesAxiomRules();
+
+	const auto postsFact =
+		[&](const Operator &operator_, size_t factID)
+		{
+			const auto &effects = operator_.effects();
+
+			return std::any_of(effects.cbegin(), effects.cend(),
+				[&](const auto &effect)
+				{
+					return relevance.factID(effect.postcondition()) == factID;
+				});
+		};
+
+	// Operators assigning different values to a variable can never be applied, and operators that
+	// do not change any variable are never needed
+	const auto isUseful =
+		[&](const Operator &operator_)
+		{
+			constexpr auto NoFact = std::numeric_limits<size_t>::max();
+
+			std::vector<size_t> preconditionFacts(variables.size(), NoFact);
+			std::vector<size_t> postconditionFacts(variables.size(), NoFact);
+
+			const auto assign =
+				[&](std::vector<size_t> &facts, const AssignedVariable &assignedVariable)
+				{
+					auto &fact = facts[assignedVariable.variableID()];
+					const auto factID = relevance.factID(assignedVariable);
+
+					if (fact != NoFact && fact != factID)
+						return false;
+
+					fact = factID;
+					return true;
+				};
+
+			for (const auto &precondition : operator_.preconditions())
+				if (!assign(preconditionFacts, precondition))
+					return false;
+
+			bool changesVariable = false;
+
+			for (const auto &effect : operator_.effects())
+			{
+				if (effect.conditions().empty() && !assign(postconditionFacts, effect.postcondition()))
+					return false;
+
+				const auto &postcondition = effect.postcondition();
+
+				if (preconditionFacts[postcondition.variableID()] != relevance.factID(postcondition))
+					changesVariable = true;
+			}
+
+			return changesVariable;
+		};
+
+	std::vector<bool> isPossible(operators.size());
+
+	for (size_t operatorID = 0; operatorID < operators.size(); operatorID++)
+		isPossible[operatorID] = isUseful(operators[operatorID]);
+
+	// Forward chaining of effects with respect to the initial state
+	std::vector<bool> isFeasible(numberOfFacts, !usesForwardChaining);
+
+	if (usesForwardChaining)
+	{
+		// Effects of operators and axiom rules make their postconditions feasible once all their
+		// conditions are
+		std::vector<size_t> ruleHeads;
+		std::vector<size_t> numberOfUnsatisfiedConditions;
+		std::vector<std::vector<size_t>> rulesWithCondition(numberOfFacts);
+		std::vector<size_t> queue;
+
+		const auto makeFeasible =
+			[&](size_t factID)
+			{
+				if (isFeasible[factID])
+					return;
+
+				isFeasible[factID] = true;
+				queue.emplace_back(factID);
+			};
+
+		const auto addRule =
+			[&](const AssignedVariables &conditions1, const AssignedVariables &conditions2,
+				const AssignedVariable &postcondition)
+			{
+				const auto ruleID = ruleHeads.size();
+
+				ruleHeads.emplace_back(relevance.factID(postcondition));
+				numberOfUnsatisfiedConditions.emplace_back(conditions1.size() + conditions2.size());
+
+				for (const auto &condition : conditions1)
+					rulesWithCondition[relevance.factID(condition)].emplace_back(ruleID);
+
+				for (const auto &condition : conditions2)
+					rulesWithCondition[relevance.factID(condition)].emplace_back(ruleID);
+
+				if (numberOfUnsatisfiedConditions.back() == 0)
+					makeFeasible(ruleHeads.back());
+			};
+
+		for (const auto &fact : description.initialState().facts())
+			makeFeasible(relevance.factID(fact));
+
+		for (size_t operatorID = 0; operatorID < operators.size(); operatorID++)
+		{
+			if (!isPossible[operatorID])
+				continue;
+
+			const auto &operator_ = operators[operatorID];
+
+			for (const auto &effect : operator_.effects())
+				addRule(operator_.preconditions(), effect.conditions(), effect.postcondition());
+		}
+
+		for (const auto &axiomRule : axiomRules)
+			addRule(axiomRule.conditions(), {}, axiomRule.postcondition());
+
+		while (!queue.empty())
+		{
+			const auto factID = queue.back();
+			queue.pop_back();
+
+			for (const auto ruleID : rulesWithCondition[factID])
+			{
+				numberOfUnsatisfiedConditions[ruleID]--;
+
+				if (numberOfUnsatisfiedConditions[ruleID] == 0)
+					makeFeasible(ruleHeads[ruleID]);
+			}
+		}
+
+		for (size_t operatorID = 0; operatorID < operators.size(); operatorID++)
+		{
+			const auto &preconditions = operators[operatorID].preconditions();
+
+			isPossible[operatorID] = isPossible[operatorID]
+				&& std::all_of(preconditions.cbegin(), preconditions.cend(),
+					[&](const auto &precondition)
+					{
+						return isFeasible[relevance.factID(precondition)];
+					});
+		}
+	}
+
+	// Backward regression of effects with respect to the goal
+	std::vector<bool> isActive(operators.size(), !usesBackwardRegression);
+
+	if (usesBackwardRegression)
+	{
+		constexpr auto NoFact = std::numeric_limits<size_t>::max();
+
+		std::vector<size_t> initialFacts(variables.size(), NoFact);
+
+		for (const auto &fact : description.initialState().facts())
+			initialFacts[fact.variableID()] = relevance.factID(fact);
+
+		// Operators that may assign each fact and variable
+		std::vector<std::vector<size_t>> producers(numberOfFacts);
+		std::vector<std::vector<size_t>> modifiers(variables.size());
+
+		for (size_t operatorID = 0; operatorID < operators.size(); operatorID++)
+		{
+			if (!isPossible[operatorID])
+				continue;
+
+			for (const auto &effect : operators[operatorID].effects())
+			{
+				const auto &postcondition = effect.postcondition();
+
+				producers[relevance.factID(postcondition)].emplace_back(operatorID);
+				modifiers[postcondition.variableID()].emplace_back(operatorID);
+			}
+		}
+
+		std::vector<bool> isProduced(numberOfFacts, false);
+		std::vector<bool> isPersisted(variables.size(), false);
+		std::vector<size_t> queue;
+
+		const auto activate =
+			[&](size_t operatorID)
+			{
+				if (isActive[operatorID])
+					return;
+
+				isActive[operatorID] = true;
+				queue.emplace_back(operatorID);
+			};
+
+		const auto produce =
+			[&](size_t factID)
+			{
+				if (isProduced[factID])
+					return;
+
+				isProduced[factID] = true;
+
+				for (const auto operatorID : producers[factID])
+					activate(operatorID);
+			};
+
+		// Initial values are needed to persist, which requires producing them again after active
+		// operators change them
+		const auto reproduceInitialFact =
+			[&](size_t operatorID, size_t variableID)
+			{
+				const auto initialFact = initialFacts[variableID];
+
+				if (initialFact != NoFact && !postsFact(operators[operatorID], initialFact))
+					produce(initialFact);
+			};
+
+		const auto need =
+			[&](const AssignedVariable &fact)
+			{
+				const auto variableID = fact.variableID();
+				const auto factID = relevance.factID(fact);
+
+				if (factID != initialFacts[variableID])
+				{
+					produce(factID);
+					return;
+				}
+
+				if (isPersisted[variableID])
+					return;
+
+				isPersisted[variableID] = true;
+
+				for (const auto operatorID : modifiers[variableID])
+					if (isActive[operatorID])
+						reproduceInitialFact(operatorID, variableID);
+			};
+
+		for (const auto &fact : description.goal().facts())
+			need(fact);
+
+		while (!queue.empty())
+		{
+			const auto operatorID = queue.back();
+			queue.pop_back();
+
+			const auto &operator_ = operators[operatorID];
+
+			for (const auto &precondition : operator_.preconditions())
+				need(precondition);
+
+			for (const auto &effect : operator_.effects())
+			{
+				for (const auto &condition : effect.conditions())
+					need(condition);
+
+				const auto variableID = effect.postcondition().variableID();
+
+				if (isPersisted[variableID])
+					reproduceInitialFact(operatorID, variableID);
+			}
+		}
+	}
+
+	relevance.m_relevantOperators.resize(operators.size());
+
+	for (size_t operatorID = 0; operatorID < operators.size(); operatorID++)
+		relevance.m_relevantOperators[operatorID] = isPossible[operatorID] && isActive[operatorID];
+
+	// Without backward regression, all variables are relevant, and otherwise only those referred to
+	// by the goal and the conditions of relevant operators
+	relevance.m_relevantVariables.assign(variables.size(), !usesBackwardRegression);
+
+	const auto markRelevantVariable =
+		[&](const AssignedVariable &fact)
+		{
+			relevance.m_relevantVariables[fact.variableID()] = true;
+		};
+
+	for (const auto &fact : description.goal().facts())
+		markRelevantVariable(fact);
+
+	for (size_t operatorID = 0; operatorID < operators.size(); operatorID++)
+	{
+		if (!relevance.m_relevantOperators[operatorID])
+			continue;
+
+		const auto &operator_ = operators[operatorID];
+
+		std::for_each(operator_.preconditions().cbegin(), operator_.preconditions().cend(), markRelevantVariable);
+
+		for (const auto &effect : operator_.effects())
+			std::for_each(effect.conditions().cbegin(), effect.conditions().cend(), markRelevantVariable);
+	}
+
+	relevance.m_relevantFacts.resize(numberOfFacts);
+
+	for (size_t variableID = 0; variableID < variables.size(); variableID++)
+		for (size_t valueID = 0; valueID < variables[variableID].values().size(); valueID++)
+		{
+			const auto factID = relevance.m_factIDOffsets[variableID] + valueID;
+
+			relevance.m_relevantFacts[factID] = relevance.m_relevantVariables[variableID] && isFeasible[factID];
+		}
+
+	// Infeasible goal facts are kept, so that the goal still refers to declared values
+	for (const auto &fact : description.goal().facts())
+		relevance.m_relevantFacts[relevance.factID(fact)] = true;
+
+	relevance.m_relevantAxiomRules.resize(axiomRules.size());
+
+	for (size_t axiomRuleID = 0; axiomRuleID < axiomRules.size(); axiomRuleID++)
+	{
+		const auto &axiomRule = axiomRules[axiomRuleID];
+		const auto &conditions = axiomRule.conditions();
+
+		relevance.m_relevantAxiomRules[axiomRuleID] = relevance.isRelevant(axiomRule.postcondition())
+			&& std::all_of(conditions.cbegin(), conditions.cend(),
+				[&](const auto &condition)
+				{
+					return relevance.isRelevant(condition);
+				});
+	}
+
+	return relevance;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+size_t Relevance::variableID(const Variable &variable) const
+{
+	return &variable - m_description.variables().data();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+size_t Relevance::factID(const AssignedVariable &assignedVariable) const
+{
+	assert(assignedVariable.valueID() != Value::AnyID);
+
+	return m_factIDOffsets[assignedVariable.variableID()] + assignedVariable.valueID();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool Relevance::isRelevant(const Variable &variable) const
+{
+	return m_relevantVariables[variableID(variable)];
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool Relevance::isRelevant(const AssignedVariable &assignedVariable) const
+{
+	return m_relevantFacts[factID(assignedVariable)];
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool Relevance::isRelevant(const Operator &operator_) const
+{
+	return m_relevantOperators[&operator_ - m_description.operators().data()];
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool Relevance::isRelevant(const Effect &effect) const
+{
+	const auto &conditions = effect.conditions();
+
+	return isRelevant(effect.postcondition())
+		&& std::all_of(conditions.cbegin(), conditions.cend(),
+			[&](const auto &condition)
+			{
+				return this->isRelevant(condition);
+			});
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool Relevance::isRelevant(const AxiomRule &axiomRule) const
+{
+	return m_relevantAxiomRules[&axiomRule - m_description.axiomRules().data()];
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool Relevance::isRelevant(const MutexGroup &mutexGroup) const
+{
+	const auto &facts = mutexGroup.facts();
+
+	return std::any_of(facts.cbegin(), facts.cend(),
+		[&](const auto &fact)
+		{
+			return this->isRelevant(fact);
+		});
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
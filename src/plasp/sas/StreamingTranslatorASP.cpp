@@ -0,0 +1,123 @@
+#include <plasp/sas/StreamingTranslatorASP.h>
+
+#include <algorithm>
+
+#include <tokenize/TokenizerException.h>
+
+#include <plasp/StreamingOutput.h>
+
+#include <plasp/sas/Description.h>
+#include <plasp/sas/TextFactSink.h>
+#include <plasp/sas/TranslatorASP.h>
+
+namespace plasp
+{
+namespace sas
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// StreamingTranslatorASP
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+StreamingTranslatorASP::StreamingTranslatorASP(tokenize::Tokenizer<> &&tokenizer, colorlog::ColorStream &outputStream)
+:	m_tokenizer(std::move(tokenizer)),
+	m_outputStream(outputStream),
+	m_numberOfOperators{0},
+	m_numberOfAxiomRules{0}
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void StreamingTranslatorASP::translate()
+{
+	Description description;
+
+	description.parseVersionSection(m_tokenizer);
+	description.parseMetricSection(m_tokenizer);
+	description.parseVariablesSection(m_tokenizer);
+	description.parseMutexSection(m_tokenizer);
+	description.parseInitialStateSection(m_tokenizer);
+	description.parseGoalSection(m_tokenizer);
+
+	const auto &variables = description.variables();
+
+	StreamingOutput output(m_outputStream);
+	TextFactSink sink(description, output.stream());
+
+	TranslatorASP translator(description, sink);
+
+	translator.translateVariables();
+	sink.beginSection(FactSink::Section::Actions);
+
+	// Write everything up to the actions right away
+	output.flush();
+
+	bool usesConditionalEffects = false;
+	size_t currentEffectID = 0;
+
+	m_numberOfOperators = m_tokenizer.get<size_t>();
+
+	for (size_t i = 0; i < m_numberOfOperators; i++)
+	{
+		const auto operator_ = Operator::fromSAS(m_tokenizer, variables);
+		const auto &effects = operator_.effects();
+
+		usesConditionalEffects |= std::any_of(effects.cbegin(), effects.cend(),
+			[&](const auto &effect)
+			{
+				return !effect.conditions().empty();
+			});
+
+		translator.translateOperator(sink, operator_, currentEffectID);
+		output.commit();
+	}
+
+	if (!description.mutexGroups().empty())
+		translator.translateMutexes();
+
+	m_numberOfAxiomRules = m_tokenizer.get<size_t>();
+
+	const auto usesAxiomRules = m_numberOfAxiomRules > 0 || std::any_of(variables.cbegin(), variables.cend(),
+		[&](const auto &variable)
+		{
+			return variable.axiomLayer() != -1;
+		});
+
+	if (usesAxiomRules)
+		sink.beginSection(FactSink::Section::AxiomRules);
+
+	for (size_t i = 0; i < m_numberOfAxiomRules; i++)
+	{
+		translator.translateAxiomRule(AxiomRule::fromSAS(m_tokenizer, variables), i);
+		output.commit();
+	}
+
+	m_tokenizer.skipWhiteSpace();
+
+	if (!m_tokenizer.atEnd())
+		throw tokenize::TokenizerException(m_tokenizer.location(), "expected end of SAS description (perhaps, input contains two SAS descriptions?)");
+
+	translator.translateInitialState();
+	translator.translateGoal();
+
+	if (description.usesActionCosts() || usesAxiomRules || usesConditionalEffects)
+		translator.translateRequirements(description.usesActionCosts(), usesAxiomRules, usesConditionalEffects);
+
+	output.finish();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void StreamingTranslatorASP::collectStatistics(Statistics &statistics) const
+{
+	statistics.count("actions", m_numberOfOperators);
+	statistics.count("derived predicates", m_numberOfAxiomRules);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
@@ -0,0 +1,53 @@
+#include <plasp/sas/StringPool.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace plasp
+{
+namespace sas
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// StringPool
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+constexpr size_t StringPoolBlockSize = 64 * 1024;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+StringPool::StringPool()
+:	m_blockSize{0},
+	m_blockPosition{0}
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::string_view StringPool::add(std::string_view string)
+{
+	const auto size = string.size() + 1;
+
+	if (m_blocks.empty() || m_blockPosition + size > m_blockSize)
+	{
+		// Strings longer than a block get a block of their own
+		m_blockSize = std::max(StringPoolBlockSize, size);
+		m_blockPosition = 0;
+		m_blocks.emplace_back(std::make_unique<char[]>(m_blockSize));
+	}
+
+	auto *data = m_blocks.back().get() + m_blockPosition;
+	std::memcpy(data, string.data(), string.size());
+	data[string.size()] = '\0';
+
+	m_blockPosition += size;
+
+	return std::string_view(data, string.size());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
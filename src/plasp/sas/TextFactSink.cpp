@@ -0,0 +1,351 @@
+#include <plasp/sas/TextFactSink.h>
+
+#include <cassert>
+
+#include <colorlog/Formatting.h>
+
+#include <plasp/ParallelTranslation.h>
+#include <plasp/TranslatorException.h>
+
+namespace plasp
+{
+namespace sas
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TextFactSink
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TextFactSink::ChunkOutput::ChunkOutput(const colorlog::ColorStream &outputStream)
+:	stream(stringStream)
+{
+	const auto colorPolicy = outputStream.supportsColor()
+		? colorlog::ColorStream::ColorPolicy::Always
+		: colorlog::ColorStream::ColorPolicy::Never;
+
+	stream.setColorPolicy(colorPolicy);
+	stream.setSymbolTable(outputStream.symbolTable());
+
+	if (colorPolicy == colorlog::ColorStream::ColorPolicy::Never)
+		stream.enableOutputBuffer(ChunkBufferCapacity);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TextFactSink::TextFactSink(const Description &description, colorlog::ColorStream &outputStream)
+:	m_description(description),
+	m_outputStream(outputStream),
+	m_isFirstSection{true}
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TextFactSink::TextFactSink(const Description &description, std::unique_ptr<ChunkOutput> &&chunkOutput,
+	std::shared_ptr<const RenderedFacts> renderedFacts)
+:	m_description(description),
+	m_chunkOutput(std::move(chunkOutput)),
+	m_outputStream(m_chunkOutput->stream),
+	m_renderedFacts(std::move(renderedFacts)),
+	m_isFirstSection{false}
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TextFactSink::beginSection(Section section)
+{
+	// The symbol table is only complete once the output starts
+	if (!m_renderedFacts)
+		renderFacts();
+
+	if (!m_isFirstSection)
+		m_outputStream << std::endl;
+
+	m_isFirstSection = false;
+
+	switch (section)
+	{
+		case Section::Requirements:
+			m_outputStream << colorlog::Heading2("feature requirements") << std::endl;
+			return;
+		case Section::Variables:
+			m_outputStream << colorlog::Heading2("variables");
+			return;
+		case Section::Actions:
+			m_outputStream << colorlog::Heading2("actions");
+			return;
+		case Section::MutexGroups:
+			m_outputStream << colorlog::Heading2("mutex groups");
+			return;
+		case Section::AxiomRules:
+			m_outputStream << colorlog::Heading2("axiom rules");
+			return;
+		case Section::InitialState:
+			m_outputStream << colorlog::Heading2("initial state") << std::endl;
+			return;
+		case Section::Goal:
+			m_outputStream << colorlog::Heading2("goal") << std::endl;
+			return;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TextFactSink::requiresFeature(Feature feature)
+{
+	const auto featureName =
+		[&]()
+		{
+			switch (feature)
+			{
+				case Feature::ActionCosts:
+					return "actionCosts";
+				case Feature::AxiomRules:
+					return "axiomRules";
+				case Feature::ConditionalEffects:
+					return "conditionalEffects";
+			}
+
+			return "";
+		}();
+
+	m_outputStream << colorlog::Function("requires") << "(" << colorlog::Keyword("feature") << "(" << colorlog::Reserved(featureName) << "))." << std::endl;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TextFactSink::variable(std::size_t variableID)
+{
+	m_outputStream << std::endl << colorlog::Function("variable") << "(";
+	m_description.variables()[variableID].printNameAsASPPredicate(m_outputStream);
+	m_outputStream << ")." << std::endl;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TextFactSink::contains(const AssignedVariable &fact)
+{
+	m_outputStream << colorlog::Function("contains") << "(";
+	writeFact(fact);
+	m_outputStream << ")." << std::endl;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TextFactSink::action(const Operator &operator_)
+{
+	m_outputStream << std::endl << colorlog::Function("action") << "(";
+	operator_.printPredicateAsASP(m_outputStream);
+	m_outputStream << ")." << std::endl;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TextFactSink::precondition(const Operator &operator_, const AssignedVariable &fact)
+{
+	m_outputStream << colorlog::Function("precondition") << "(";
+	operator_.printPredicateAsASP(m_outputStream);
+	m_outputStream << ", ";
+	writeFact(fact);
+	m_outputStream << ")." << std::endl;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TextFactSink::postcondition(const Operator &operator_, std::size_t effectID, const AssignedVariable &fact)
+{
+	m_outputStream << colorlog::Function("postcondition") << "(";
+	operator_.printPredicateAsASP(m_outputStream);
+
+	if (effectID == UnconditionalEffect)
+		m_outputStream << ", " << colorlog::Keyword("effect") << "(" << colorlog::Reserved("unconditional") << "), ";
+	else
+		m_outputStream << ", " << colorlog::Keyword("effect") << "(" << colorlog::Number<decltype(effectID)>(effectID) << "), ";
+
+	writeFact(fact);
+	m_outputStream << ")." << std::endl;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TextFactSink::effectCondition(std::size_t effectID, const AssignedVariable &fact)
+{
+	m_outputStream
+		<< colorlog::Function("precondition") << "("
+		<< colorlog::Keyword("effect") << "(" << colorlog::Number<decltype(effectID)>(effectID) << "), ";
+	writeFact(fact);
+	m_outputStream << ")." << std::endl;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TextFactSink::costs(const Operator &operator_)
+{
+	m_outputStream << colorlog::Function("costs") << "(";
+	operator_.printPredicateAsASP(m_outputStream);
+	m_outputStream << ", " << colorlog::Number<decltype(operator_.costs())>(operator_.costs()) << ")." << std::endl;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TextFactSink::mutexGroup(std::size_t mutexGroupID)
+{
+	m_outputStream
+		<< std::endl
+		<< colorlog::Function("mutexGroup") << "("
+		<< colorlog::Keyword("mutexGroup") << "("
+		<< colorlog::Number<decltype(mutexGroupID)>(mutexGroupID)
+		<< "))." << std::endl;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TextFactSink::mutexGroupContains(std::size_t mutexGroupID, const AssignedVariable &fact)
+{
+	m_outputStream << colorlog::Function("contains") << "(" << colorlog::Keyword("mutexGroup") << "(" << colorlog::Number<decltype(mutexGroupID)>(mutexGroupID) << "), ";
+	writeFact(fact);
+	m_outputStream << ")." << std::endl;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TextFactSink::axiomRule(std::size_t axiomRuleID)
+{
+	m_outputStream
+		<< std::endl
+		<< colorlog::Function("axiomRule") << "("
+		<< colorlog::Keyword("axiomRule") << "("
+		<< colorlog::Number<decltype(axiomRuleID)>(axiomRuleID)
+		<< "))." << std::endl;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TextFactSink::axiomRulePrecondition(std::size_t axiomRuleID, const AssignedVariable &fact)
+{
+	m_outputStream
+		<< colorlog::Function("precondition") << "("
+		<< colorlog::Keyword("axiomRule") << "(" << colorlog::Number<decltype(axiomRuleID)>(axiomRuleID) << "), ";
+	writeFact(fact);
+	m_outputStream << ")." << std::endl;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TextFactSink::axiomRulePostcondition(std::size_t axiomRuleID, const AssignedVariable &fact)
+{
+	m_outputStream
+		<< colorlog::Function("postcondition") << "("
+		<< colorlog::Keyword("axiomRule") << "(" << colorlog::Number<decltype(axiomRuleID)>(axiomRuleID) << "), "
+		<< colorlog::Keyword("effect") << "(" << colorlog::Reserved("unconditional") << "), ";
+	writeFact(fact);
+	m_outputStream << ")." << std::endl;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TextFactSink::initialState(const AssignedVariable &fact)
+{
+	m_outputStream << colorlog::Function("initialState") << "(";
+	writeFact(fact);
+	m_outputStream << ")." << std::endl;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TextFactSink::goal(const AssignedVariable &fact)
+{
+	m_outputStream << colorlog::Function("goal") << "(";
+	writeFact(fact);
+	m_outputStream << ")." << std::endl;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool TextFactSink::supportsChunks() const
+{
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::unique_ptr<FactSink> TextFactSink::makeChunkSink()
+{
+	assert(m_renderedFacts);
+
+	return std::unique_ptr<FactSink>(new TextFactSink(m_description,
+		std::make_unique<ChunkOutput>(m_outputStream), m_renderedFacts));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TextFactSink::appendChunk(FactSink &chunkSink)
+{
+	auto &chunkOutput = *static_cast<TextFactSink &>(chunkSink).m_chunkOutput;
+	chunkOutput.stream.flush();
+
+	const auto text = chunkOutput.stringStream.str();
+	m_outputStream.write(text.data(), text.size());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TextFactSink::renderFacts()
+{
+	const auto &variables = m_description.variables();
+
+	// Render with the same colors and symbol IDs as the output stream
+	std::ostringstream renderedFactsStream;
+	colorlog::ColorStream renderStream(renderedFactsStream);
+	renderStream.setColorPolicy(m_outputStream.supportsColor()
+		? colorlog::ColorStream::ColorPolicy::Always
+		: colorlog::ColorStream::ColorPolicy::Never);
+	renderStream.setSymbolTable(m_outputStream.symbolTable());
+
+	auto renderedFacts = std::make_shared<RenderedFacts>();
+	renderedFacts->factIDOffsets.reserve(variables.size());
+
+	for (const auto &variable : variables)
+	{
+		renderedFacts->factIDOffsets.emplace_back(renderedFacts->textOffsets.size());
+
+		for (const auto &value : variable.values())
+		{
+			renderedFacts->textOffsets.emplace_back(renderedFactsStream.tellp());
+
+			variable.printNameAsASPPredicate(renderStream);
+			renderStream << ", ";
+			value.printAsASPPredicate(renderStream);
+		}
+	}
+
+	renderedFacts->textOffsets.emplace_back(renderedFactsStream.tellp());
+	renderedFacts->text = renderedFactsStream.str();
+
+	m_renderedFacts = std::move(renderedFacts);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TextFactSink::writeFact(const AssignedVariable &fact)
+{
+	// Facts matching any value have no pre-rendered text
+	if (fact.valueID() == Value::AnyID)
+		throw TranslatorException("cannot translate fact of variable “"
+			+ std::string(m_description.variables()[fact.variableID()].name()) + "” without a value");
+
+	const auto &renderedFacts = *m_renderedFacts;
+
+	const auto factID = renderedFacts.factIDOffsets[fact.variableID()] + fact.valueID();
+	const auto begin = renderedFacts.textOffsets[factID];
+
+	m_outputStream.write(renderedFacts.text.data() + begin, renderedFacts.textOffsets[factID + 1] - begin);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
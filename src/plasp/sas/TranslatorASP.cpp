@@ -1,6 +1,8 @@
 #include <plasp/sas/TranslatorASP.h>
 
-#include <colorlog/Formatting.h>
+#include <algorithm>
+
+#include <plasp/ParallelTranslation.h>
 
 namespace plasp
 {
@@ -15,75 +17,184 @@ namespace sas
 
 TranslatorASP::TranslatorASP(const Description &description, colorlog::ColorStream &outputStream)
 :	m_description(description),
-	m_outputStream(outputStream)
+	m_textSink(std::make_unique<TextFactSink>(description, outputStream)),
+	m_sink(*m_textSink),
+	m_numberOfThreads{1}
 {
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+TranslatorASP::TranslatorASP(const Description &description, FactSink &sink)
+:	m_description(description),
+	m_sink(sink),
+	m_numberOfThreads{1}
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TranslatorASP::setNumberOfThreads(size_t numberOfThreads)
+{
+	m_numberOfThreads = numberOfThreads;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TranslatorASP::collectSymbols(colorlog::SymbolTable &symbolTable) const
+{
+	const auto &variables = m_description.variables();
+
+	std::for_each(variables.cbegin(), variables.cend(),
+		[&](const auto &variable)
+		{
+			const auto &values = variable.values();
+
+			std::for_each(values.cbegin(), values.cend(),
+				[&](const auto &value)
+				{
+					// Variables store copies of Value::None, which are recognized by value
+					if (value == Value::None)
+						return;
+
+					symbolTable.add(std::string(value.name()));
+				});
+		});
+
+	const auto &operators = m_description.operators();
+
+	std::for_each(operators.cbegin(), operators.cend(),
+		[&](const auto &operator_)
+		{
+			const auto &predicate = operator_.predicate();
+
+			symbolTable.add(predicate.name());
+
+			for (const auto &argument : predicate.arguments())
+				symbolTable.add(argument);
+		});
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TranslatorASP::collectStatistics(Statistics &statistics) const
+{
+	const auto &operators = m_description.operators();
+	const auto &axiomRules = m_description.axiomRules();
+
+	statistics.count("actions", std::count_if(operators.cbegin(), operators.cend(),
+		[&](const auto &operator_)
+		{
+			return this->isRelevant(operator_);
+		}));
+
+	statistics.count("derived predicates", std::count_if(axiomRules.cbegin(), axiomRules.cend(),
+		[&](const auto &axiomRule)
+		{
+			return this->isRelevant(axiomRule);
+		}));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TranslatorASP::prune(PruningMode pruningMode)
+{
+	m_relevance = std::make_unique<Relevance>(Relevance::analyze(m_description, pruningMode));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<class TranslateElement>
+void TranslatorASP::translateInParallel(size_t numberOfElements, TranslateElement translateElement) const
+{
+	const auto numberOfThreads = std::min(resolveNumberOfThreads(m_numberOfThreads), numberOfElements);
+
+	if (numberOfThreads <= 1 || !m_sink.supportsChunks())
+	{
+		for (size_t i = 0; i < numberOfElements; i++)
+			translateElement(m_sink, i);
+
+		return;
+	}
+
+	translateChunksInParallel(numberOfElements, numberOfThreads,
+		[&](size_t begin, size_t end)
+		{
+			auto chunkSink = m_sink.makeChunkSink();
+
+			for (auto i = begin; i < end; i++)
+				translateElement(*chunkSink, i);
+
+			return chunkSink;
+		},
+		[&](std::unique_ptr<FactSink> &chunkSink)
+		{
+			m_sink.appendChunk(*chunkSink);
+		});
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void TranslatorASP::translate() const
 {
 	// TODO: remove double computation of requirements
 	if (m_description.hasRequirements())
-	{
-		translateRequirements();
-		m_outputStream << std::endl;
-	}
+		translateRequirements(m_description.usesActionCosts(), m_description.usesAxiomRules(),
+			m_description.usesConditionalEffects());
 
 	translateVariables();
-	m_outputStream << std::endl;
 	translateActions();
 
-	if (!m_description.mutexGroups().empty())
-	{
-		m_outputStream << std::endl;
+	const auto &mutexGroups = m_description.mutexGroups();
+
+	if (std::any_of(mutexGroups.cbegin(), mutexGroups.cend(),
+		[&](const auto &mutexGroup)
+		{
+			return this->isRelevant(mutexGroup);
+		}))
 		translateMutexes();
-	}
 
 	if (m_description.usesAxiomRules())
-	{
-		m_outputStream << std::endl;
 		translateAxiomRules();
-	}
 
-	m_outputStream << std::endl;
 	translateInitialState();
-	m_outputStream << std::endl;
 	translateGoal();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void TranslatorASP::translateRequirements() const
+void TranslatorASP::translateRequirements(bool usesActionCosts, bool usesAxiomRules,
+	bool usesConditionalEffects) const
 {
-	m_outputStream << colorlog::Heading2("feature requirements") << std::endl;
+	m_sink.beginSection(FactSink::Section::Requirements);
 
-	if (m_description.usesActionCosts())
-		m_outputStream << colorlog::Function("requires") << "(" << colorlog::Keyword("feature") << "(" << colorlog::Reserved("actionCosts") << "))." << std::endl;
+	if (usesActionCosts)
+		m_sink.requiresFeature(FactSink::Feature::ActionCosts);
 
-	if (m_description.usesAxiomRules())
-		m_outputStream << colorlog::Function("requires") << "(" << colorlog::Keyword("feature") << "(" << colorlog::Reserved("axiomRules") << "))." << std::endl;
+	if (usesAxiomRules)
+		m_sink.requiresFeature(FactSink::Feature::AxiomRules);
 
-	if (m_description.usesConditionalEffects())
-		m_outputStream << colorlog::Function("requires") << "(" << colorlog::Keyword("feature") << "(" << colorlog::Reserved("conditionalEffects") << "))." << std::endl;
+	if (usesConditionalEffects)
+		m_sink.requiresFeature(FactSink::Feature::ConditionalEffects);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 void TranslatorASP::translateInitialState() const
 {
-	m_outputStream << colorlog::Heading2("initial state") << std::endl;
+	m_sink.beginSection(FactSink::Section::InitialState);
 
 	const auto &initialStateFacts = m_description.initialState().facts();
 
-	std::for_each(initialStateFacts.cbegin(), initialStateFacts.cend(),
-		[&](const auto &fact)
+	translateInParallel(initialStateFacts.size(),
+		[&](auto &sink, size_t factID)
 		{
-			m_outputStream << colorlog::Function("initialState") << "(";
-			fact.variable().printNameAsASPPredicate(m_outputStream);
-			m_outputStream << ", ";
-			fact.value().printAsASPPredicate(m_outputStream);
-			m_outputStream << ")." << std::endl;
+			const auto &fact = initialStateFacts[factID];
+
+			if (!this->isRelevant(fact.variable(m_description.variables())))
+				return;
+
+			sink.initialState(fact);
 		});
 }
 
@@ -91,18 +202,14 @@ void TranslatorASP::translateInitialState() const
 
 void TranslatorASP::translateGoal() const
 {
-	m_outputStream << colorlog::Heading2("goal") << std::endl;
+	m_sink.beginSection(FactSink::Section::Goal);
 
 	const auto &goalFacts = m_description.goal().facts();
 
 	std::for_each(goalFacts.cbegin(), goalFacts.cend(),
 		[&](const auto &fact)
 		{
-			m_outputStream << colorlog::Function("goal") << "(";
-			fact.variable().printNameAsASPPredicate(m_outputStream);
-			m_outputStream << ", ";
-			fact.value().printAsASPPredicate(m_outputStream);
-			m_outputStream << ")." << std::endl;
+			m_sink.goal(fact);
 		});
 }
 
@@ -110,7 +217,7 @@ void TranslatorASP::translateGoal() const
 
 void TranslatorASP::translateVariables() const
 {
-	m_outputStream << colorlog::Heading2("variables");
+	m_sink.beginSection(FactSink::Section::Variables);
 
 	const auto &variables = m_description.variables();
 
@@ -121,18 +228,22 @@ void TranslatorASP::translateVariables() const
 
 			assert(!values.empty());
 
-			m_outputStream << std::endl << colorlog::Function("variable") << "(";
-			variable.printNameAsASPPredicate(m_outputStream);
-			m_outputStream << ")." << std::endl;
+			if (!this->isRelevant(variable))
+				return;
+
+			const auto variableID = &variable - variables.data();
+
+			m_sink.variable(variableID);
 
 			std::for_each(values.cbegin(), values.cend(),
 				[&](const auto &value)
 				{
-					m_outputStream << colorlog::Function("contains") << "(";
-					variable.printNameAsASPPredicate(m_outputStream);
-					m_outputStream << ", ";
-					value.printAsASPPredicate(m_outputStream);
-					m_outputStream << ")." << std::endl;
+					const AssignedVariable assignedVariable(variableID, &value - values.data());
+
+					if (!this->isRelevant(assignedVariable))
+						return;
+
+					m_sink.contains(assignedVariable);
 				});
 		});
 }
@@ -141,81 +252,94 @@ void TranslatorASP::translateVariables() const
 
 void TranslatorASP::translateActions() const
 {
-	m_outputStream << colorlog::Heading2("actions");
+	m_sink.beginSection(FactSink::Section::Actions);
 
 	const auto &operators = m_description.operators();
 
-	size_t currentEffectID = 0;
+	// Conditional effects are numbered consecutively across all operators, so the first effect ID of
+	// each operator is fixed up front to translate the operators independently
+	std::vector<size_t> effectIDOffsets;
+	effectIDOffsets.reserve(operators.size());
 
-	std::for_each(operators.cbegin(), operators.cend(),
-		[&](const auto &operator_)
+	size_t numberOfConditionalEffects = 0;
+
+	for (const auto &operator_ : operators)
+	{
+		effectIDOffsets.emplace_back(numberOfConditionalEffects);
+
+		if (!isRelevant(operator_))
+			continue;
+
+		const auto &effects = operator_.effects();
+
+		numberOfConditionalEffects += std::count_if(effects.cbegin(), effects.cend(),
+			[&](const auto &effect)
+			{
+				return !effect.conditions().empty() && this->isRelevant(effect);
+			});
+	}
+
+	translateInParallel(operators.size(),
+		[&](auto &sink, size_t operatorID)
 		{
-			m_outputStream << std::endl << colorlog::Function("action") << "(";
-			operator_.printPredicateAsASP(m_outputStream);
-			m_outputStream << ")." << std::endl;
+			if (!this->isRelevant(operators[operatorID]))
+				return;
 
-			const auto &preconditions = operator_.preconditions();
+			auto currentEffectID = effectIDOffsets[operatorID];
 
-			std::for_each(preconditions.cbegin(), preconditions.cend(),
-				[&](const auto &precondition)
-				{
-					m_outputStream << colorlog::Function("precondition") << "(";
-					operator_.printPredicateAsASP(m_outputStream);
-					m_outputStream << ", ";
-					precondition.variable().printNameAsASPPredicate(m_outputStream);
-					m_outputStream << ", ";
-					precondition.value().printAsASPPredicate(m_outputStream);
-					m_outputStream << ")." << std::endl;
-				});
+			this->translateOperator(sink, operators[operatorID], currentEffectID);
+		});
+}
 
-			const auto &effects = operator_.effects();
+////////////////////////////////////////////////////////////////////////////////////////////////////
 
-			std::for_each(effects.cbegin(), effects.cend(),
-				[&](const auto &effect)
+void TranslatorASP::translateOperator(FactSink &sink, const Operator &operator_, size_t &currentEffectID) const
+{
+	sink.action(operator_);
+
+	const auto &preconditions = operator_.preconditions();
+
+	std::for_each(preconditions.cbegin(), preconditions.cend(),
+		[&](const auto &precondition)
+		{
+			sink.precondition(operator_, precondition);
+		});
+
+	const auto &effects = operator_.effects();
+
+	std::for_each(effects.cbegin(), effects.cend(),
+		[&](const auto &effect)
+		{
+			if (!this->isRelevant(effect))
+				return;
+
+			const auto &conditions = effect.conditions();
+
+			if (conditions.empty())
+			{
+				sink.postcondition(operator_, FactSink::UnconditionalEffect, effect.postcondition());
+				return;
+			}
+
+			sink.postcondition(operator_, currentEffectID, effect.postcondition());
+
+			std::for_each(conditions.cbegin(), conditions.cend(),
+				[&](const auto &condition)
 				{
-					const auto &conditions = effect.conditions();
-
-					m_outputStream << colorlog::Function("postcondition") << "(";
-					operator_.printPredicateAsASP(m_outputStream);
-
-					if (conditions.empty())
-						m_outputStream << ", " << colorlog::Keyword("effect") << "(" << colorlog::Reserved("unconditional") << "), ";
-					else
-						m_outputStream << ", " << colorlog::Keyword("effect") << "(" << colorlog::Number<decltype(currentEffectID)>(currentEffectID) << "), ";
-
-					effect.postcondition().variable().printNameAsASPPredicate(m_outputStream);
-					m_outputStream << ", ";
-					effect.postcondition().value().printAsASPPredicate(m_outputStream);
-					m_outputStream << ")." << std::endl;
-
-					std::for_each(conditions.cbegin(), conditions.cend(),
-						[&](const auto &condition)
-						{
-							// Conditions of conditional effects
-							m_outputStream
-								<< colorlog::Function("precondition") << "("
-								<< colorlog::Keyword("effect") << "(" << colorlog::Number<decltype(currentEffectID)>(currentEffectID) << "), ";
-							condition.variable().printNameAsASPPredicate(m_outputStream);
-							m_outputStream << ", ";
-							condition.value().printAsASPPredicate(m_outputStream);
-							m_outputStream << ")." << std::endl;
-						});
-
-					if (!conditions.empty())
-						currentEffectID++;
+					sink.effectCondition(currentEffectID, condition);
 				});
 
-			m_outputStream << colorlog::Function("costs") << "(";
-			operator_.printPredicateAsASP(m_outputStream);
-			m_outputStream << ", " << colorlog::Number<decltype(operator_.costs())>(operator_.costs()) << ")." << std::endl;
+			currentEffectID++;
 		});
+
+	sink.costs(operator_);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 void TranslatorASP::translateMutexes() const
 {
-	m_outputStream << colorlog::Heading2("mutex groups");
+	m_sink.beginSection(FactSink::Section::MutexGroups);
 
 	const auto &mutexGroups = m_description.mutexGroups();
 
@@ -224,26 +348,24 @@ void TranslatorASP::translateMutexes() const
 	std::for_each(mutexGroups.cbegin(), mutexGroups.cend(),
 		[&](const auto &mutexGroup)
 		{
-			const auto mutexGroupID = std::to_string(currentMutexGroupID);
+			// Mutex groups without relevant facts are omitted altogether
+			if (!this->isRelevant(mutexGroup))
+				return;
+
+			const auto mutexGroupID = currentMutexGroupID;
 			currentMutexGroupID++;
 
-			m_outputStream
-				<< std::endl
-				<< colorlog::Function("mutexGroup") << "("
-				<< colorlog::Keyword("mutexGroup") << "("
-				<< colorlog::Number<decltype(mutexGroupID)>(mutexGroupID)
-				<< "))." << std::endl;
+			m_sink.mutexGroup(mutexGroupID);
 
 			const auto &facts = mutexGroup.facts();
 
 			std::for_each(facts.cbegin(), facts.cend(),
 				[&](const auto &fact)
 				{
-					m_outputStream << colorlog::Function("contains") << "(" << colorlog::Keyword("mutexGroup") << "(" << colorlog::Number<decltype(mutexGroupID)>(mutexGroupID) << "), ";
-					fact.variable().printNameAsASPPredicate(m_outputStream);
-					m_outputStream << ", ";
-					fact.value().printAsASPPredicate(m_outputStream);
-					m_outputStream << ")." << std::endl;
+					if (!this->isRelevant(fact))
+						return;
+
+					m_sink.mutexGroupContains(mutexGroupID, fact);
 				});
 		});
 }
@@ -252,7 +374,7 @@ void TranslatorASP::translateMutexes() const
 
 void TranslatorASP::translateAxiomRules() const
 {
-	m_outputStream << colorlog::Heading2("axiom rules");
+	m_sink.beginSection(FactSink::Section::AxiomRules);
 
 	const auto &axiomRules = m_description.axiomRules();
 
@@ -261,43 +383,31 @@ void TranslatorASP::translateAxiomRules() const
 	std::for_each(axiomRules.cbegin(), axiomRules.cend(),
 		[&](const auto &axiomRule)
 		{
-			const auto axiomRuleID = std::to_string(currentAxiomRuleID);
-			currentAxiomRuleID++;
+			if (!this->isRelevant(axiomRule))
+				return;
 
-			m_outputStream
-				<< std::endl
-				<< colorlog::Function("axiomRule") << "("
-				<< colorlog::Keyword("axiomRule") << "("
-				<< colorlog::Number<decltype(axiomRuleID)>(axiomRuleID)
-				<< "))." << std::endl;
+			this->translateAxiomRule(axiomRule, currentAxiomRuleID);
+			currentAxiomRuleID++;
+		});
+}
 
-			// TODO: Translate axiom rule layer
+////////////////////////////////////////////////////////////////////////////////////////////////////
 
-			const auto &conditions = axiomRule.conditions();
+void TranslatorASP::translateAxiomRule(const AxiomRule &axiomRule, size_t axiomRuleID) const
+{
+	m_sink.axiomRule(axiomRuleID);
 
-			std::for_each(conditions.cbegin(), conditions.cend(),
-				[&](const auto &condition)
-				{
-					m_outputStream
-						<< colorlog::Function("precondition") << "("
-						<< colorlog::Keyword("axiomRule") << "(" << colorlog::Number<decltype(axiomRuleID)>(axiomRuleID) << "), ";
-					condition.variable().printNameAsASPPredicate(m_outputStream);
-					m_outputStream << ", ";
-					condition.value().printAsASPPredicate(m_outputStream);
-					m_outputStream << ")." << std::endl;
-				});
+	// TODO: Translate axiom rule layer
 
-			const auto &postcondition = axiomRule.postcondition();
+	const auto &conditions = axiomRule.conditions();
 
-			m_outputStream
-				<< colorlog::Function("postcondition") << "("
-				<< colorlog::Keyword("axiomRule") << "(" << colorlog::Number<decltype(axiomRuleID)>(axiomRuleID) << "), "
-				<< colorlog::Keyword("effect") << "(" << colorlog::Reserved("unconditional") << "), ";
-			postcondition.variable().printNameAsASPPredicate(m_outputStream);
-			m_outputStream << ", ";
-			postcondition.value().printAsASPPredicate(m_outputStream);
-			m_outputStream << ")." << std::endl;
+	std::for_each(conditions.cbegin(), conditions.cend(),
+		[&](const auto &condition)
+		{
+			m_sink.axiomRulePrecondition(axiomRuleID, condition);
 		});
+
+	m_sink.axiomRulePostcondition(axiomRuleID, axiomRule.postcondition());
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,331 @@
+#include <plasp/sas/TranslatorAspif.h>
+
+#include <string>
+#include <vector>
+
+#include <plasp/TranslatorException.h>
+
+namespace plasp
+{
+namespace sas
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TranslatorAspif
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using Literal = long;
+using Literals = std::vector<Literal>;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Statements of the aspif format (see the clingo documentation)
+class AspifWriter
+{
+	public:
+		explicit AspifWriter(colorlog::ColorStream &outputStream)
+		:	m_outputStream(outputStream)
+		{
+		}
+
+		void writeHeader()
+		{
+			m_outputStream << "asp 1 0 0\n";
+		}
+
+		void writeFooter()
+		{
+			m_outputStream << "0\n";
+		}
+
+		void writeFact(Literal atom)
+		{
+			m_outputStream << "1 0 1 " << atom << " 0 0\n";
+		}
+
+		void writeChoiceRule(const Literals &head)
+		{
+			m_outputStream << "1 1 " << head.size();
+			writeLiterals(head);
+			m_outputStream << " 0 0\n";
+		}
+
+		void writeRule(Literal head, const Literals &body)
+		{
+			m_outputStream << "1 0 1 " << head << " 0 " << body.size();
+			writeLiterals(body);
+			m_outputStream << "\n";
+		}
+
+		void writeIntegrityConstraint(const Literals &body)
+		{
+			m_outputStream << "1 0 0 0 " << body.size();
+			writeLiterals(body);
+			m_outputStream << "\n";
+		}
+
+		// Integrity constraint violated if at least lowerBound of the literals hold
+		void writeCardinalityConstraint(size_t lowerBound, const Literals &body)
+		{
+			m_outputStream << "1 0 0 1 " << lowerBound << " " << body.size();
+
+			for (const auto literal : body)
+				m_outputStream << " " << literal << " 1";
+
+			m_outputStream << "\n";
+		}
+
+		void writeOutput(const std::string &symbol, Literal literal)
+		{
+			m_outputStream << "4 " << symbol.size() << " " << symbol.c_str() << " 1 " << literal << "\n";
+		}
+
+	private:
+		void writeLiterals(const Literals &literals)
+		{
+			for (const auto literal : literals)
+				m_outputStream << " " << literal;
+		}
+
+		colorlog::ColorStream &m_outputStream;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::string quote(const std::string &string)
+{
+	std::string quotedString = "\"";
+
+	for (const auto character : string)
+	{
+		if (character == '"' || character == '\\')
+			quotedString += '\\';
+
+		quotedString += character;
+	}
+
+	return quotedString + "\"";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// The same term as printed by clingo for the translated facts
+std::string actionSymbol(const Operator &operator_)
+{
+	const auto &predicate = operator_.predicate();
+
+	if (predicate.arguments().empty())
+		return "action(" + quote(predicate.name()) + ")";
+
+	auto symbol = "action((" + quote(predicate.name());
+
+	for (const auto &argument : predicate.arguments())
+		symbol += "," + quote(argument);
+
+	return symbol + "))";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TranslatorAspif::TranslatorAspif(const Description &description, colorlog::ColorStream &outputStream)
+:	m_description(description),
+	m_outputStream(outputStream),
+	m_horizon{1}
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TranslatorAspif::setHorizon(size_t horizon)
+{
+	m_horizon = horizon;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TranslatorAspif::collectStatistics(Statistics &statistics) const
+{
+	statistics.count("actions", m_description.operators().size());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TranslatorAspif::translate() const
+{
+	if (m_description.usesAxiomRules())
+		throw TranslatorException("aspif output is not supported for SAS descriptions with axiom rules");
+
+	const auto &variables = m_description.variables();
+	const auto &operators = m_description.operators();
+
+	// Facts are numbered consecutively by variable and value
+	std::vector<size_t> factIDOffsets;
+	factIDOffsets.reserve(variables.size());
+
+	size_t numberOfFacts = 0;
+
+	for (const auto &variable : variables)
+	{
+		factIDOffsets.emplace_back(numberOfFacts);
+		numberOfFacts += variable.values().size();
+	}
+
+	const auto factID =
+		[&](const AssignedVariable &assignedVariable) -> size_t
+		{
+			return factIDOffsets[assignedVariable.variableID()] + assignedVariable.valueID();
+		};
+
+	// Atoms of the ground program: holds/3 for time steps 0 to the horizon, and occurs/2, caused/3,
+	// and modified/2 for time steps 1 to the horizon
+	const auto holdsOffset = Literal(1);
+	const auto occursOffset = holdsOffset + Literal((m_horizon + 1) * numberOfFacts);
+	const auto causedOffset = occursOffset + Literal(m_horizon * operators.size());
+	const auto modifiedOffset = causedOffset + Literal(m_horizon * numberOfFacts);
+
+	const auto holds =
+		[&](size_t factID, size_t t)
+		{
+			return holdsOffset + Literal(t * numberOfFacts + factID);
+		};
+
+	const auto occurs =
+		[&](size_t operatorID, size_t t)
+		{
+			return occursOffset + Literal((t - 1) * operators.size() + operatorID);
+		};
+
+	const auto caused =
+		[&](size_t factID, size_t t)
+		{
+			return causedOffset + Literal((t - 1) * numberOfFacts + factID);
+		};
+
+	const auto modified =
+		[&](size_t variableID, size_t t)
+		{
+			return modifiedOffset + Literal((t - 1) * variables.size() + variableID);
+		};
+
+	AspifWriter writer(m_outputStream);
+
+	writer.writeHeader();
+
+	// Establish initial state
+	for (const auto &fact : m_description.initialState().facts())
+		writer.writeFact(holds(factID(fact), 0));
+
+	Literals literals;
+
+	for (size_t t = 1; t <= m_horizon; t++)
+	{
+		// Perform exactly one action per time step
+		literals.clear();
+
+		for (size_t operatorID = 0; operatorID < operators.size(); operatorID++)
+			literals.emplace_back(occurs(operatorID, t));
+
+		writer.writeChoiceRule(literals);
+
+		if (literals.size() > 1)
+			writer.writeCardinalityConstraint(2, literals);
+
+		for (auto &literal : literals)
+			literal = -literal;
+
+		writer.writeIntegrityConstraint(literals);
+
+		for (size_t operatorID = 0; operatorID < operators.size(); operatorID++)
+		{
+			const auto &operator_ = operators[operatorID];
+
+			// Check preconditions
+			for (const auto &precondition : operator_.preconditions())
+				writer.writeIntegrityConstraint({occurs(operatorID, t), -holds(factID(precondition), t - 1)});
+
+			// Apply effects
+			for (const auto &effect : operator_.effects())
+			{
+				literals = {occurs(operatorID, t)};
+
+				for (const auto &condition : effect.conditions())
+					literals.emplace_back(holds(factID(condition), t - 1));
+
+				writer.writeRule(caused(factID(effect.postcondition()), t), literals);
+			}
+		}
+
+		// Inertia rules
+		for (size_t variableID = 0; variableID < variables.size(); variableID++)
+			for (size_t valueID = 0; valueID < variables[variableID].values().size(); valueID++)
+			{
+				const auto currentFactID = factIDOffsets[variableID] + valueID;
+
+				writer.writeRule(modified(variableID, t), {caused(currentFactID, t)});
+				writer.writeRule(holds(currentFactID, t), {caused(currentFactID, t)});
+				writer.writeRule(holds(currentFactID, t), {holds(currentFactID, t - 1), -modified(variableID, t)});
+			}
+	}
+
+	for (size_t t = 0; t <= m_horizon; t++)
+	{
+		// Check that variables have unique values
+		for (size_t variableID = 0; variableID < variables.size(); variableID++)
+		{
+			literals.clear();
+
+			for (size_t valueID = 0; valueID < variables[variableID].values().size(); valueID++)
+				literals.emplace_back(holds(factIDOffsets[variableID] + valueID, t));
+
+			if (literals.size() > 1)
+				writer.writeCardinalityConstraint(2, literals);
+
+			for (auto &literal : literals)
+				literal = -literal;
+
+			writer.writeIntegrityConstraint(literals);
+		}
+
+		// Check mutexes
+		for (const auto &mutexGroup : m_description.mutexGroups())
+		{
+			literals.clear();
+
+			for (const auto &fact : mutexGroup.facts())
+				literals.emplace_back(holds(factID(fact), t));
+
+			if (literals.size() > 1)
+				writer.writeCardinalityConstraint(2, literals);
+		}
+	}
+
+	// Verify that goal is met
+	for (const auto &fact : m_description.goal().facts())
+		writer.writeIntegrityConstraint({-holds(factID(fact), m_horizon)});
+
+	for (size_t operatorID = 0; operatorID < operators.size(); operatorID++)
+	{
+		const auto symbol = actionSymbol(operators[operatorID]);
+
+		for (size_t t = 1; t <= m_horizon; t++)
+			writer.writeOutput("occurs(" + symbol + "," + std::to_string(t) + ")", occurs(operatorID, t));
+	}
+
+	writer.writeFooter();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
@@ -19,7 +19,7 @@ namespace sas
 //
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-const Value Value::reserved(const std::string &name)
+const Value Value::reserved(const char *name)
 {
 	Value any;
 
@@ -56,7 +56,7 @@ Value Value::negated() const
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-Value Value::fromSAS(tokenize::Tokenizer<> &tokenizer)
+Value Value::fromSAS(tokenize::Tokenizer<> &tokenizer, StringPool &names)
 {
 	const auto sasSign = tokenizer.get<std::string>();
 
@@ -81,14 +81,16 @@ Value Value::fromSAS(tokenize::Tokenizer<> &tokenizer)
 	try
 	{
 		tokenizer.skipWhiteSpace();
-		value.m_name = tokenizer.getLine();
+		auto name = tokenizer.getLine();
 
 		// Remove trailing ()
-		if (value.m_name.find("()") != std::string::npos)
+		if (name.find("()") != std::string::npos)
 		{
 			value.m_hasArguments = false;
-			value.m_name.resize(value.m_name.size() - 2);
+			name.resize(name.size() - 2);
 		}
+
+		value.m_name = names.add(name);
 	}
 	catch (const std::exception &e)
 	{
@@ -100,17 +102,38 @@ Value Value::fromSAS(tokenize::Tokenizer<> &tokenizer)
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-const Value &Value::referenceFromSAS(tokenize::Tokenizer<> &tokenizer, const Variable &variable)
+Value Value::fromBinary(BinaryReader &reader)
+{
+	const auto kind = reader.getUInt32();
+
+	if (kind == 2)
+		return Value::None;
+
+	if (kind > 2)
+		throw std::runtime_error("malformed binary SAS description (invalid value sign)");
+
+	Value value;
+
+	value.m_sign = (kind == 0 ? Sign::Positive : Sign::Negative);
+	value.m_name = reader.getString();
+	value.m_hasArguments = (reader.getUInt32() != 0);
+
+	return value;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int Value::referenceFromSAS(tokenize::Tokenizer<> &tokenizer, const Variable &variable)
 {
 	const auto valueID = tokenizer.get<int>();
 
-	if (valueID == -1)
-		return Value::Any;
+	if (valueID == AnyID)
+		return AnyID;
 
 	if (valueID < 0 || static_cast<size_t>(valueID) >= variable.values().size())
-		throw tokenize::TokenizerException(tokenizer.location(), "value index out of range (variable " + variable.name() + ", index " + std::to_string(valueID) + ")");
+		throw tokenize::TokenizerException(tokenizer.location(), "value index out of range (variable " + std::string(variable.name()) + ", index " + std::to_string(valueID) + ")");
 
-	return variable.values()[valueID];
+	return valueID;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -122,7 +145,7 @@ Value::Sign Value::sign() const
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-const std::string &Value::name() const
+std::string_view Value::name() const
 {
 	return m_name;
 }
@@ -138,7 +161,7 @@ void Value::printAsASPPredicate(colorlog::ColorStream &stream) const
 		return;
 	}
 
-	stream << colorlog::Keyword("value") << "(" << colorlog::String(m_name.c_str()) << ", "
+	stream << colorlog::Keyword("value") << "(" << colorlog::String(m_name.data()) << ", "
 		<< (m_sign == Sign::Positive ? colorlog::Boolean("true") : colorlog::Boolean("false")) << ")";
 }
 
@@ -151,7 +174,7 @@ void Value::printAsSAS(colorlog::ColorStream &stream) const
 	else
 		stream << "NegatedAtom ";
 
-	stream << m_name;
+	stream << m_name.data();
 
 	if (!m_hasArguments)
 		stream << "()";
@@ -167,5 +190,21 @@ bool operator ==(const Value &value1, const Value &value2)
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void Value::writeBinary(BinaryWriter &writer) const
+{
+	// Variables store copies of Value::None, which are recognized by the reserved name
+	if (*this == Value::None)
+	{
+		writer.writeUInt32(2);
+		return;
+	}
+
+	writer.writeUInt32(m_sign == Sign::Positive ? 0 : 1);
+	writer.writeString(m_name);
+	writer.writeUInt32(m_hasArguments ? 1 : 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 }
 }
@@ -24,14 +24,14 @@ Variable::Variable()
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-Variable Variable::fromSAS(tokenize::Tokenizer<> &tokenizer)
+Variable Variable::fromSAS(tokenize::Tokenizer<> &tokenizer, StringPool &names)
 {
 	Variable variable;
 
 	tokenizer.expect<std::string>("begin_variable");
 	tokenizer.expect<std::string>("var");
 
-	variable.m_name = tokenizer.get<std::string>();
+	variable.m_name = names.add(tokenizer.get<std::string>());
 	variable.m_axiomLayer = tokenizer.get<int>();
 
 	const auto numberOfValues = tokenizer.get<size_t>();
@@ -39,7 +39,7 @@ Variable Variable::fromSAS(tokenize::Tokenizer<> &tokenizer)
 
 	for (size_t j = 0; j < numberOfValues; j++)
 	{
-		variable.m_values.emplace_back(Value::fromSAS(tokenizer));
+		variable.m_values.emplace_back(Value::fromSAS(tokenizer, names));
 
 		// <none of those> values are only allowed at the end
 		if (j < numberOfValues - 1 && variable.m_values[j] == Value::None)
@@ -53,27 +53,45 @@ Variable Variable::fromSAS(tokenize::Tokenizer<> &tokenizer)
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+Variable Variable::fromBinary(BinaryReader &reader)
+{
+	Variable variable;
+
+	variable.m_name = reader.getString();
+	variable.m_axiomLayer = reader.getInt32();
+
+	const auto numberOfValues = reader.getNumberOfElements(4);
+	variable.m_values.reserve(numberOfValues);
+
+	for (size_t j = 0; j < numberOfValues; j++)
+		variable.m_values.emplace_back(Value::fromBinary(reader));
+
+	return variable;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void Variable::printNameAsASPPredicate(colorlog::ColorStream &stream) const
 {
 	// TODO: assert that name is a number indeed
-	stream << colorlog::Keyword("variable") << "(" << colorlog::Number<std::string>(m_name) << ")";
+	stream << colorlog::Keyword("variable") << "(" << colorlog::Number<const char *>(m_name.data()) << ")";
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-const Variable &Variable::referenceFromSAS(tokenize::Tokenizer<> &tokenizer, const Variables &variables)
+size_t Variable::referenceFromSAS(tokenize::Tokenizer<> &tokenizer, const Variables &variables)
 {
 	const auto variableID = tokenizer.get<size_t>();
 
 	if (variableID >= variables.size())
 		throw tokenize::TokenizerException(tokenizer.location(), "variable index out of range (index " + std::to_string(variableID) + ")");
 
-	return variables[variableID];
+	return variableID;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-const std::string &Variable::name() const
+std::string_view Variable::name() const
 {
 	return m_name;
 }
@@ -94,5 +112,17 @@ const Values &Variable::values() const
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void Variable::writeBinary(BinaryWriter &writer) const
+{
+	writer.writeString(m_name);
+	writer.writeInt32(m_axiomLayer);
+	writer.writeSize(m_values.size());
+
+	for (const auto &value : m_values)
+		value.writeBinary(writer);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 }
 }
@@ -15,9 +15,9 @@ namespace sas
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 VariableTransition::VariableTransition()
-:	m_variable{nullptr},
-	m_valueBefore{nullptr},
-	m_valueAfter{nullptr}
+:	m_variableID{0},
+	m_valueBeforeID{Value::AnyID},
+	m_valueAfterID{Value::AnyID}
 {
 }
 
@@ -27,38 +27,35 @@ VariableTransition VariableTransition::fromSAS(tokenize::Tokenizer<> &tokenizer,
 {
 	VariableTransition variableTransition;
 
-	variableTransition.m_variable = &Variable::referenceFromSAS(tokenizer, variables);
-	variableTransition.m_valueBefore = &Value::referenceFromSAS(tokenizer, *variableTransition.m_variable);
-	variableTransition.m_valueAfter = &Value::referenceFromSAS(tokenizer, *variableTransition.m_variable);
+	variableTransition.m_variableID = Variable::referenceFromSAS(tokenizer, variables);
+
+	const auto &variable = variables[variableTransition.m_variableID];
+
+	variableTransition.m_valueBeforeID = Value::referenceFromSAS(tokenizer, variable);
+	variableTransition.m_valueAfterID = Value::referenceFromSAS(tokenizer, variable);
 
 	return variableTransition;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-const Variable &VariableTransition::variable() const
+size_t VariableTransition::variableID() const
 {
-	assert(m_variable != nullptr);
-
-	return *m_variable;
+	return m_variableID;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-const Value &VariableTransition::valueBefore() const
+int VariableTransition::valueBeforeID() const
 {
-	assert(m_valueBefore != nullptr);
-
-	return *m_valueBefore;
+	return m_valueBeforeID;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-const Value &VariableTransition::valueAfter() const
+int VariableTransition::valueAfterID() const
 {
-	assert(m_valueAfter != nullptr);
-
-	return *m_valueAfter;
+	return m_valueAfterID;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
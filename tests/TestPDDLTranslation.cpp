@@ -1,6 +1,9 @@
 #include <catch.hpp>
 
+#include <algorithm>
+#include <fstream>
 #include <iostream>
+#include <sstream>
 
 #include <colorlog/Logger.h>
 
@@ -8,6 +11,11 @@
 #include <pddl/Normalize.h>
 #include <pddl/Parse.h>
 
+#include <plasp/Symbols.h>
+#include <plasp/TranslatorException.h>
+#include <plasp/pddl/DomainCache.h>
+#include <plasp/pddl/IncrementalTranslatorASP.h>
+#include <plasp/pddl/StreamingTranslatorASP.h>
 #include <plasp/pddl/TranslatorASP.h>
 
 #include "NullOutputStream.h"
@@ -40,3 +48,829 @@ TEST_CASE("[PDDL translation] Former issues are fixed", "[PDDL translation]")
 		CHECK_NOTHROW(translator.translate());
 	}
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("[PDDL translation] Buffered output matches unbuffered output", "[PDDL translation]")
+{
+	const auto translate =
+		[](bool isBuffered, bool isAsynchronous = false)
+		{
+			std::stringstream outputStream;
+
+			{
+				colorlog::ColorStream colorStream(outputStream);
+
+				if (isBuffered)
+					colorStream.enableOutputBuffer(64);
+
+				// Small buffers are handed to the writer thread many times
+				if (isAsynchronous)
+					colorStream.enableAsynchronousOutput(2);
+
+				pddl::Tokenizer tokenizer;
+				pddl::Context context(std::move(tokenizer), ignoreWarnings);
+				context.tokenizer.read("data/blocksworld-domain.pddl");
+				context.tokenizer.read("data/blocksworld-problem.pddl");
+				auto description = pddl::normalize(pddl::parseDescription(context));
+				const auto translator = plasp::pddl::TranslatorASP(std::move(description), colorStream);
+				translator.translate();
+			}
+
+			return outputStream.str();
+		};
+
+	const auto unbufferedOutput = translate(false);
+
+	CHECK(!unbufferedOutput.empty());
+	CHECK(translate(true) == unbufferedOutput);
+	CHECK(translate(true, true) == unbufferedOutput);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("[PDDL translation] Multithreaded output matches sequential output", "[PDDL translation]")
+{
+	const auto translate =
+		[](size_t numberOfThreads)
+		{
+			std::stringstream outputStream;
+
+			{
+				colorlog::ColorStream colorStream(outputStream);
+				colorStream.enableOutputBuffer();
+
+				pddl::Tokenizer tokenizer;
+				pddl::Context context(std::move(tokenizer), ignoreWarnings);
+				context.tokenizer.read("data/blocksworld-domain.pddl");
+				context.tokenizer.read("data/blocksworld-problem.pddl");
+				auto description = pddl::normalize(pddl::parseDescription(context));
+				auto translator = plasp::pddl::TranslatorASP(std::move(description), colorStream);
+				translator.setNumberOfThreads(numberOfThreads);
+				translator.translate();
+			}
+
+			return outputStream.str();
+		};
+
+	const auto sequentialOutput = translate(1);
+
+	CHECK(!sequentialOutput.empty());
+	CHECK(translate(4) == sequentialOutput);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("[PDDL translation] Streaming output matches regular output", "[PDDL translation]")
+{
+	const auto translate =
+		[](bool isStreaming)
+		{
+			std::stringstream outputStream;
+
+			{
+				colorlog::ColorStream colorStream(outputStream);
+				colorStream.enableOutputBuffer();
+
+				pddl::Tokenizer tokenizer;
+				pddl::Context context(std::move(tokenizer), ignoreWarnings);
+				context.tokenizer.read("data/blocksworld-domain.pddl");
+				context.tokenizer.read("data/blocksworld-problem.pddl");
+
+				if (isStreaming)
+				{
+					auto translator = plasp::pddl::StreamingTranslatorASP(context, colorStream);
+					translator.translate();
+				}
+				else
+				{
+					auto description = pddl::normalize(pddl::parseDescription(context));
+					const auto translator = plasp::pddl::TranslatorASP(std::move(description), colorStream);
+					translator.translate();
+				}
+			}
+
+			return outputStream.str();
+		};
+
+	const auto regularOutput = translate(false);
+
+	CHECK(!regularOutput.empty());
+	CHECK(translate(true) == regularOutput);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("[PDDL translation] Problems of cached domains are translated like complete descriptions", "[PDDL translation]")
+{
+	const auto readFile =
+		[](const std::string &path)
+		{
+			std::ifstream stream(path);
+			std::stringstream content;
+			content << stream.rdbuf();
+
+			return content.str();
+		};
+
+	const auto translate =
+		[](const pddl::normalizedAST::Description &description)
+		{
+			std::stringstream outputStream;
+
+			{
+				colorlog::ColorStream colorStream(outputStream);
+				colorStream.enableOutputBuffer();
+
+				plasp::pddl::TranslatorASP(description, colorStream).translate();
+			}
+
+			return outputStream.str();
+		};
+
+	const auto makeContext =
+		[](const std::string &problem, pddl::Mode mode = pddl::Mode::Strict)
+		{
+			std::istringstream problemStream(problem);
+
+			pddl::Context context(pddl::Tokenizer(), ignoreWarnings, mode);
+			context.tokenizer.read("problem", problemStream);
+
+			return context;
+		};
+
+	const auto domain = readFile("data/blocksworld-domain.pddl");
+	const auto problem = readFile("data/blocksworld-problem.pddl");
+
+	pddl::Context context(pddl::Tokenizer(), ignoreWarnings);
+	context.tokenizer.read("data/blocksworld-domain.pddl");
+	context.tokenizer.read("data/blocksworld-problem.pddl");
+	const auto regularOutput = translate(pddl::normalize(pddl::parseDescription(context)));
+
+	plasp::pddl::DomainCache domainCache(4);
+
+	SECTION("cached domains are reused")
+	{
+		for (int i = 0; i < 3; i++)
+		{
+			auto lease = domainCache.lease(domain, pddl::Mode::Strict, ignoreWarnings);
+			auto problemContext = makeContext(problem);
+			CHECK(translate(lease.parseProblem(problemContext)) == regularOutput);
+		}
+
+		CHECK(domainCache.numberOfMisses() == 1);
+		CHECK(domainCache.numberOfHits() == 2);
+	}
+
+	SECTION("concurrently leased domains are separate copies")
+	{
+		auto lease1 = domainCache.lease(domain, pddl::Mode::Strict, ignoreWarnings);
+		auto lease2 = domainCache.lease(domain, pddl::Mode::Strict, ignoreWarnings);
+
+		CHECK(lease1.description().domain.get() != lease2.description().domain.get());
+		CHECK(domainCache.numberOfMisses() == 2);
+	}
+
+	SECTION("failing problems leave the cached domain intact")
+	{
+		{
+			auto lease = domainCache.lease(domain, pddl::Mode::Compatibility, ignoreWarnings);
+			auto problemContext = makeContext("(define (problem p) (:domain blocks) (:objects a - crate) (:init (foo a)))",
+				pddl::Mode::Compatibility);
+			CHECK_THROWS(lease.parseProblem(problemContext));
+		}
+
+		auto lease = domainCache.lease(domain, pddl::Mode::Compatibility, ignoreWarnings);
+		auto problemContext = makeContext(problem, pddl::Mode::Compatibility);
+		CHECK(translate(lease.parseProblem(problemContext)) == regularOutput);
+		CHECK(domainCache.numberOfHits() == 1);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("[PDDL translation] Incrementally translated descriptions match complete translations", "[PDDL translation]")
+{
+	const auto readFile =
+		[](const std::string &path)
+		{
+			std::ifstream stream(path);
+			std::stringstream content;
+			content << stream.rdbuf();
+
+			return content.str();
+		};
+
+	const auto makeContext =
+		[](const std::string &domain, const std::string &problem)
+		{
+			std::istringstream domainStream(domain);
+			std::istringstream problemStream(problem);
+
+			pddl::Context context(pddl::Tokenizer(), ignoreWarnings);
+			context.tokenizer.read("domain", domainStream);
+			context.tokenizer.read("problem", problemStream);
+
+			return context;
+		};
+
+	const auto translate =
+		[&](const std::string &domain, const std::string &problem)
+		{
+			auto context = makeContext(domain, problem);
+			std::stringstream outputStream;
+
+			{
+				colorlog::ColorStream colorStream(outputStream);
+				colorStream.enableOutputBuffer();
+
+				plasp::pddl::TranslatorASP(pddl::normalize(pddl::parseDescription(context)), colorStream).translate();
+			}
+
+			return outputStream.str();
+		};
+
+	const auto replace =
+		[](std::string text, const std::string &from, const std::string &to)
+		{
+			return text.replace(text.find(from), from.size(), to);
+		};
+
+	auto domain = readFile("data/blocksworld-domain.pddl");
+	auto problem = readFile("data/blocksworld-problem.pddl");
+
+	plasp::pddl::IncrementalTranslatorASP translator;
+
+	const auto update =
+		[&]()
+		{
+			auto context = makeContext(domain, problem);
+			return translator.update(context);
+		};
+
+	const auto output =
+		[&]()
+		{
+			std::stringstream outputStream;
+			translator.write(outputStream);
+
+			return outputStream.str();
+		};
+
+	auto result = update();
+	CHECK(result.isComplete);
+	CHECK(output() == translate(domain, problem));
+
+	SECTION("only changed actions are parsed again")
+	{
+		domain = replace(domain, "(:action stack", "(:action stack-block");
+		domain = replace(domain, "(:action put-down", "(:action unstack-all :parameters () :effect (when (handempty) (not (handempty))))\n(:action put-down");
+		result = update();
+		CHECK(!result.isComplete);
+		CHECK(result.numberOfParsedActions == 2);
+		CHECK(!result.isProblemParsed);
+		CHECK(output() == translate(domain, problem));
+
+		result = update();
+		CHECK(result.numberOfParsedActions == 0);
+	}
+
+	SECTION("changed problems are parsed against the kept domain")
+	{
+		problem = replace(problem, "(:INIT", "(:INIT (ON A B)");
+		result = update();
+		CHECK(!result.isComplete);
+		CHECK(result.numberOfParsedActions == 0);
+		CHECK(result.isProblemParsed);
+		CHECK(output() == translate(domain, problem));
+	}
+
+	SECTION("changed declarations lead to complete translations")
+	{
+		domain = replace(domain, "(handempty)\n", "(handempty)\n(broken)\n");
+		result = update();
+		CHECK(result.isComplete);
+		CHECK(output() == translate(domain, problem));
+	}
+
+	SECTION("failing versions leave the previous translation intact")
+	{
+		const auto previousOutput = output();
+
+		domain = replace(domain, "(:action stack", "(:action stack (");
+		CHECK_THROWS(update());
+		CHECK(output() == previousOutput);
+
+		domain = replace(domain, "(:action stack (", "(:action stack-block");
+		result = update();
+		CHECK(result.numberOfParsedActions == 1);
+		CHECK(output() == translate(domain, problem));
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("[PDDL translation] Symbol IDs are mapped back to the original names", "[PDDL translation]")
+{
+	std::stringstream symbolTableStream;
+
+	const auto translate =
+		[&](bool useSymbolIDs)
+		{
+			std::stringstream outputStream;
+
+			{
+				colorlog::ColorStream colorStream(outputStream);
+				colorStream.enableOutputBuffer();
+
+				pddl::Tokenizer tokenizer;
+				pddl::Context context(std::move(tokenizer), ignoreWarnings);
+				context.tokenizer.read("data/blocksworld-domain.pddl");
+				context.tokenizer.read("data/blocksworld-problem.pddl");
+				auto description = pddl::normalize(pddl::parseDescription(context));
+				const auto translator = plasp::pddl::TranslatorASP(std::move(description), colorStream);
+
+				if (useSymbolIDs)
+				{
+					auto symbolTable = std::make_shared<colorlog::SymbolTable>();
+					translator.collectSymbols(*symbolTable);
+					plasp::printSymbolTable(symbolTableStream, *symbolTable, plasp::Language::Type::PDDL);
+					colorStream.setSymbolTable(symbolTable);
+				}
+
+				translator.translate();
+			}
+
+			return outputStream.str();
+		};
+
+	const auto output = translate(false);
+	std::stringstream outputWithSymbolIDs(translate(true));
+
+	CHECK(outputWithSymbolIDs.str().size() < output.size());
+	CHECK(outputWithSymbolIDs.str().find('"') == std::string::npos);
+
+	tokenize::Tokenizer<> tokenizer;
+	tokenizer.read("symbol table", symbolTableStream);
+	const auto symbolDecoder = plasp::SymbolDecoder::fromTokenizer(std::move(tokenizer));
+
+	CHECK(symbolDecoder.language() == plasp::Language::Type::PDDL);
+
+	std::stringstream decodedOutput;
+	symbolDecoder.decode(outputWithSymbolIDs, decodedOutput);
+
+	CHECK(decodedOutput.str() == output);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("[PDDL translation] Grounding omits unreachable actions and variables", "[PDDL translation]")
+{
+	std::stringstream domainStream(
+		"(define (domain rooms)"
+		"	(:requirements :strips :typing)"
+		"	(:types room)"
+		"	(:predicates (at ?r - room) (connected ?r1 ?r2 - room) (locked))"
+		"	(:action move"
+		"		:parameters (?from ?to - room)"
+		"		:precondition (and (at ?from) (connected ?from ?to))"
+		"		:effect (and (at ?to) (not (at ?from))))"
+		"	(:action unlock"
+		"		:parameters (?r - room)"
+		"		:precondition (and (at ?r) (locked))"
+		"		:effect (not (locked))))");
+
+	std::stringstream problemStream(
+		"(define (problem rooms-1)"
+		"	(:domain rooms)"
+		"	(:objects a b c - room)"
+		"	(:init (at a) (connected a b) (connected c a))"
+		"	(:goal (at b)))");
+
+	std::stringstream outputStream;
+
+	{
+		colorlog::ColorStream colorStream(outputStream);
+		colorStream.enableOutputBuffer();
+
+		pddl::Tokenizer tokenizer;
+		pddl::Context context(std::move(tokenizer), ignoreWarnings);
+		context.tokenizer.read("domain", domainStream);
+		context.tokenizer.read("problem", problemStream);
+		auto description = pddl::normalize(pddl::parseDescription(context));
+		auto translator = plasp::pddl::TranslatorASP(std::move(description), colorStream);
+		translator.ground();
+		translator.translate();
+	}
+
+	const auto output = outputStream.str();
+
+	const auto contains =
+		[&](const std::string &text)
+		{
+			return output.find(text) != std::string::npos;
+		};
+
+	CHECK(contains("action(action((\"move\", constant(\"a\"), constant(\"b\")))).\n"));
+	CHECK(!contains("action(action((\"move\", constant(\"c\"), constant(\"a\"))))"));
+	CHECK(!contains("action(action((\"move\", X1, X2))) :- "));
+	CHECK(!contains("\"unlock\""));
+	CHECK(contains("variable(variable((\"at\", constant(\"b\")))).\n"));
+	CHECK(!contains("variable(variable((\"at\", constant(\"c\"))))"));
+	CHECK(!contains("variable(variable(\"locked\"))"));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("[PDDL translation] Grounding applies conditional effects of earlier action instances", "[PDDL translation]")
+{
+	// Each room is only lit after the previous one, which requires conditional effects of action
+	// instances found in earlier rounds of the reachability analysis
+	std::stringstream domainStream(
+		"(define (domain lights)"
+		"	(:requirements :typing :conditional-effects)"
+		"	(:types room)"
+		"	(:predicates (at ?r - room) (connected ?r1 ?r2 - room) (lit ?r - room) (visited ?r - room)"
+		"		(switch ?r - room))"
+		"	(:action move"
+		"		:parameters (?from ?to - room)"
+		"		:precondition (and (at ?from) (connected ?from ?to))"
+		"		:effect (and (at ?to) (not (at ?from)) (when (lit ?from) (visited ?to))))"
+		"	(:action light"
+		"		:parameters (?r - room)"
+		"		:precondition (switch ?r)"
+		"		:effect (and (lit ?r) (forall (?s - room) (when (and (at ?s) (visited ?s)) (switch ?s))))))");
+
+	std::stringstream problemStream(
+		"(define (problem lights-1)"
+		"	(:domain lights)"
+		"	(:objects a b c d - room)"
+		"	(:init (at a) (switch a) (connected a b) (connected b c) (connected c d))"
+		"	(:goal (lit d)))");
+
+	std::stringstream outputStream;
+
+	{
+		colorlog::ColorStream colorStream(outputStream);
+		colorStream.enableOutputBuffer();
+
+		pddl::Tokenizer tokenizer;
+		pddl::Context context(std::move(tokenizer), ignoreWarnings);
+		context.tokenizer.read("domain", domainStream);
+		context.tokenizer.read("problem", problemStream);
+		auto description = pddl::normalize(pddl::parseDescription(context));
+		auto translator = plasp::pddl::TranslatorASP(std::move(description), colorStream);
+		translator.ground();
+		translator.translate();
+	}
+
+	const auto output = outputStream.str();
+
+	const auto contains =
+		[&](const std::string &text)
+		{
+			return output.find(text) != std::string::npos;
+		};
+
+	CHECK(contains("action(action((\"light\", constant(\"d\")))).\n"));
+	CHECK(contains("variable(variable((\"lit\", constant(\"d\")))).\n"));
+	CHECK(!contains("action(action((\"move\", constant(\"b\"), constant(\"a\"))))"));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("[PDDL translation] Ground fact sinks receive the instantiated facts", "[PDDL translation]")
+{
+	std::stringstream domainStream(
+		"(define (domain rooms)"
+		"	(:requirements :typing :conditional-effects)"
+		"	(:types room)"
+		"	(:predicates (at ?r - room) (connected ?r1 ?r2 - room) (lit ?r - room))"
+		"	(:action move"
+		"		:parameters (?from ?to - room)"
+		"		:precondition (and (at ?from) (connected ?from ?to))"
+		"		:effect (and (at ?to) (not (at ?from)) (when (lit ?from) (lit ?to)))))");
+
+	std::stringstream problemStream(
+		"(define (problem rooms-1)"
+		"	(:domain rooms)"
+		"	(:objects a b c - room)"
+		"	(:init (at a) (lit a) (connected a b) (connected c a))"
+		"	(:goal (lit b)))");
+
+	using plasp::pddl::GroundArguments;
+	using plasp::pddl::GroundAtom;
+	using plasp::pddl::GroundFactSink;
+
+	class RecordingSink : public GroundFactSink
+	{
+		public:
+			void variable(const GroundAtom &atom) override
+			{
+				facts.emplace_back("variable(" + name(atom) + ")");
+			}
+
+			void action(const pddl::normalizedAST::Action &action, const GroundArguments &arguments) override
+			{
+				facts.emplace_back("action(" + name(action.name, arguments) + ")");
+			}
+
+			void precondition(const pddl::normalizedAST::Action &action, const GroundArguments &arguments,
+				const GroundAtom &atom, bool value) override
+			{
+				facts.emplace_back("precondition(" + name(action.name, arguments) + ", " + name(atom) + ", "
+					+ (value ? "true" : "false") + ")");
+			}
+
+			void postcondition(const pddl::normalizedAST::Action &action, const GroundArguments &arguments,
+				std::size_t effectID, const GroundAtom &atom, bool value) override
+			{
+				const auto effect = (effectID == UnconditionalEffect) ? "unconditional" : std::to_string(effectID);
+
+				facts.emplace_back("postcondition(" + name(action.name, arguments) + ", " + effect + ", "
+					+ name(atom) + ", " + (value ? "true" : "false") + ")");
+			}
+
+			void effectCondition(std::size_t effectID, const GroundAtom &atom, bool value) override
+			{
+				facts.emplace_back("effectCondition(" + std::to_string(effectID) + ", " + name(atom) + ", "
+					+ (value ? "true" : "false") + ")");
+			}
+
+			void initialState(const GroundAtom &atom, bool value) override
+			{
+				facts.emplace_back("initialState(" + name(atom) + ", " + (value ? "true" : "false") + ")");
+			}
+
+			void goal(const GroundAtom &atom, bool value) override
+			{
+				facts.emplace_back("goal(" + name(atom) + ", " + (value ? "true" : "false") + ")");
+			}
+
+			bool contains(const std::string &fact) const
+			{
+				return std::find(facts.cbegin(), facts.cend(), fact) != facts.cend();
+			}
+
+			std::vector<std::string> facts;
+
+		private:
+			static std::string name(const std::string &name, const GroundArguments &arguments)
+			{
+				auto result = name;
+
+				for (const auto *argument : arguments)
+					result += " " + argument->name;
+
+				return result;
+			}
+
+			static std::string name(const GroundAtom &atom)
+			{
+				return name(atom.predicate->name, atom.arguments);
+			}
+	};
+
+	RecordingSink sink;
+
+	pddl::Tokenizer tokenizer;
+	pddl::Context context(std::move(tokenizer), ignoreWarnings);
+	context.tokenizer.read("domain", domainStream);
+	context.tokenizer.read("problem", problemStream);
+	auto description = pddl::normalize(pddl::parseDescription(context));
+
+	NullOutputStream nullOutputStream;
+	colorlog::ColorStream colorStream(nullOutputStream);
+
+	auto translator = plasp::pddl::TranslatorASP(std::move(description), colorStream);
+	CHECK_THROWS_AS(translator.translate(sink), plasp::TranslatorException);
+
+	translator.ground();
+	translator.translate(sink);
+
+	CHECK(sink.contains("variable(at b)"));
+	CHECK(!sink.contains("variable(at c)"));
+	CHECK(sink.contains("action(move a b)"));
+	CHECK(!sink.contains("action(move c a)"));
+	CHECK(sink.contains("precondition(move a b, at a, true)"));
+	CHECK(sink.contains("precondition(move a b, connected a b, true)"));
+	CHECK(sink.contains("postcondition(move a b, unconditional, at b, true)"));
+	CHECK(sink.contains("postcondition(move a b, unconditional, at a, false)"));
+	CHECK(sink.contains("effectCondition(0, lit a, true)"));
+	CHECK(sink.contains("postcondition(move a b, 0, lit b, true)"));
+	CHECK(sink.contains("initialState(at a, true)"));
+	CHECK(sink.contains("initialState(at b, false)"));
+	CHECK(sink.contains("goal(lit b, true)"));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("[PDDL translation] Static predicates are translated as static facts", "[PDDL translation]")
+{
+	std::stringstream domainStream(
+		"(define (domain rooms)"
+		"	(:requirements :strips :typing :negative-preconditions)"
+		"	(:types room)"
+		"	(:predicates (at ?r - room) (connected ?r1 ?r2 - room) (dark ?r - room) (open))"
+		"	(:action move"
+		"		:parameters (?from ?to - room)"
+		"		:precondition (and (at ?from) (connected ?from ?to) (not (dark ?to)))"
+		"		:effect (and (at ?to) (not (at ?from)))))");
+
+	std::stringstream problemStream(
+		"(define (problem rooms-1)"
+		"	(:domain rooms)"
+		"	(:objects a b c - room)"
+		"	(:init (at a) (connected a b) (connected b c) (dark c) (open))"
+		"	(:goal (and (at b) (open))))");
+
+	std::stringstream outputStream;
+
+	{
+		colorlog::ColorStream colorStream(outputStream);
+		colorStream.enableOutputBuffer();
+
+		pddl::Tokenizer tokenizer;
+		pddl::Context context(std::move(tokenizer), ignoreWarnings);
+		context.tokenizer.read("domain", domainStream);
+		context.tokenizer.read("problem", problemStream);
+		auto description = pddl::normalize(pddl::parseDescription(context));
+		auto translator = plasp::pddl::TranslatorASP(std::move(description), colorStream);
+		translator.compileStaticPredicates();
+		translator.translate();
+	}
+
+	const auto output = outputStream.str();
+
+	const auto contains =
+		[&](const std::string &text)
+		{
+			return output.find(text) != std::string::npos;
+		};
+
+	CHECK(contains("action(action((\"move\", X1, X2))) :- has(X1, type(\"room\")), has(X2, type(\"room\")), "
+		"static(variable((\"connected\", X1, X2))), not static(variable((\"dark\", X2))).\n"));
+	CHECK(contains("static(variable((\"connected\", constant(\"a\"), constant(\"b\")))).\n"));
+	CHECK(contains("static(variable((\"dark\", constant(\"c\")))).\n"));
+	CHECK(!contains("variable(variable((\"connected\""));
+	CHECK(!contains("initialState(variable((\"connected\""));
+	CHECK(!contains("precondition(action((\"move\", X1, X2)), variable((\"connected\""));
+
+	// Static predicates referred to by the goal remain variables
+	CHECK(contains("variable(variable(\"open\")).\n"));
+	CHECK(contains("initialState(variable(\"open\"), value(variable(\"open\"), true)).\n"));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("[PDDL translation] Invariants are translated as mutex groups", "[PDDL translation]")
+{
+	std::stringstream outputStream;
+
+	{
+		colorlog::ColorStream colorStream(outputStream);
+		colorStream.enableOutputBuffer();
+
+		pddl::Tokenizer tokenizer;
+		pddl::Context context(std::move(tokenizer), ignoreWarnings);
+		context.tokenizer.read("data/blocksworld-domain.pddl");
+		context.tokenizer.read("data/blocksworld-problem.pddl");
+		auto description = pddl::normalize(pddl::parseDescription(context));
+		auto translator = plasp::pddl::TranslatorASP(std::move(description), colorStream);
+		translator.synthesizeMutexGroups();
+		translator.translate();
+	}
+
+	const auto output = outputStream.str();
+
+	const auto contains =
+		[&](const std::string &text)
+		{
+			return output.find(text) != std::string::npos;
+		};
+
+	// The hand holds at most one block
+	CHECK(contains("contains(mutexGroup(0), variable(\"handempty\"), value(variable(\"handempty\"), true)).\n"));
+	CHECK(contains("contains(mutexGroup(0), variable((\"holding\", X1)), value(variable((\"holding\", X1)), true)) :- "
+		"has(X1, type(\"block\")).\n"));
+
+	// At most one block is on each block
+	CHECK(contains("contains(mutexGroup((1, X1)), variable((\"on\", X2, X1)), value(variable((\"on\", X2, X1)), true)) :- "
+		"has(X2, type(\"block\")), has(X1, type(\"block\")).\n"));
+	CHECK(contains("contains(mutexGroup((1, X1)), variable((\"clear\", X1)), value(variable((\"clear\", X1)), true)) :- "
+		"has(X1, type(\"block\")).\n"));
+
+	// Each block is at one place at most
+	CHECK(contains("contains(mutexGroup((2, X1)), variable((\"ontable\", X1)), value(variable((\"ontable\", X1)), true)) :- "
+		"has(X1, type(\"block\")).\n"));
+
+	CHECK(contains("mutexGroup(M) :- contains(M, X, V).\n"));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("[PDDL translation] Invariants without counted arguments are not translated", "[PDDL translation]")
+{
+	std::stringstream domainStream(
+		"(define (domain machines)"
+		"	(:requirements :typing)"
+		"	(:types machine)"
+		"	(:predicates (broken ?m - machine) (handempty) (holding ?m - machine))"
+		"	(:action repair"
+		"		:parameters (?m - machine)"
+		"		:precondition (broken ?m)"
+		"		:effect (not (broken ?m)))"
+		"	(:action pick-up"
+		"		:parameters (?m - machine)"
+		"		:precondition (handempty)"
+		"		:effect (and (holding ?m) (not (handempty)))))");
+
+	std::stringstream problemStream(
+		"(define (problem machines-1)"
+		"	(:domain machines)"
+		"	(:objects a b - machine)"
+		"	(:init (broken a) (broken b) (handempty))"
+		"	(:goal (holding a)))");
+
+	std::stringstream outputStream;
+
+	{
+		colorlog::ColorStream colorStream(outputStream);
+		colorStream.enableOutputBuffer();
+
+		pddl::Tokenizer tokenizer;
+		pddl::Context context(std::move(tokenizer), ignoreWarnings);
+		context.tokenizer.read("domain", domainStream);
+		context.tokenizer.read("problem", problemStream);
+		auto description = pddl::normalize(pddl::parseDescription(context));
+		auto translator = plasp::pddl::TranslatorASP(std::move(description), colorStream);
+		translator.synthesizeMutexGroups();
+		translator.translate();
+	}
+
+	const auto output = outputStream.str();
+
+	const auto contains =
+		[&](const std::string &text)
+		{
+			return output.find(text) != std::string::npos;
+		};
+
+	// Atoms that actions only delete and the single atom of handempty would otherwise form one mutex
+	// group each
+	CHECK(!contains("contains(mutexGroup((0, X1)), variable((\"broken\", X1))"));
+	CHECK(contains("contains(mutexGroup(0), variable(\"handempty\"), value(variable(\"handempty\"), true)).\n"));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("[PDDL translation] Invariants are translated as multi-valued variables", "[PDDL translation]")
+{
+	std::stringstream outputStream;
+
+	{
+		colorlog::ColorStream colorStream(outputStream);
+		colorStream.enableOutputBuffer();
+
+		pddl::Tokenizer tokenizer;
+		pddl::Context context(std::move(tokenizer), ignoreWarnings);
+		context.tokenizer.read("data/blocksworld-domain.pddl");
+		context.tokenizer.read("data/blocksworld-problem.pddl");
+		auto description = pddl::normalize(pddl::parseDescription(context));
+		auto translator = plasp::pddl::TranslatorASP(std::move(description), colorStream);
+		translator.synthesizeMutexGroups();
+		translator.useMultiValuedVariables();
+		translator.translate();
+	}
+
+	const auto output = outputStream.str();
+
+	const auto contains =
+		[&](const std::string &text)
+		{
+			return output.find(text) != std::string::npos;
+		};
+
+	// “on,” “clear,” and “holding” are merged into one variable per block
+	CHECK(contains("variable(variable(mutexGroup((1, X1)))) :- has(X1, type(\"block\")).\n"));
+	CHECK(contains("contains(variable(mutexGroup((1, X1))), value(variable(mutexGroup((1, X1))), variable((\"clear\", X1)))) :- "
+		"has(X1, type(\"block\")).\n"));
+	CHECK(!contains("variable(variable((\"clear\", X1)))"));
+	CHECK(contains("contains(variable((\"ontable\", X1)), value(variable((\"ontable\", X1)), true)) :- "
+		"variable(variable((\"ontable\", X1))).\n"));
+
+	// Deleting the previous value is implied by assigning the new one
+	CHECK(contains("postcondition(action((\"pick-up\", X1)), effect(unconditional), variable(mutexGroup((1, X1))), "
+		"value(variable(mutexGroup((1, X1))), variable((\"holding\", X1)))) :- action(action((\"pick-up\", X1))).\n"));
+	CHECK(!contains("value(variable(mutexGroup((1, X1))), false)) :- action("));
+
+	CHECK(contains("initialState(variable(mutexGroup((1, constant(\"a\")))), "
+		"value(variable(mutexGroup((1, constant(\"a\")))), variable((\"clear\", constant(\"a\"))))).\n"));
+	CHECK(contains("goal(variable(mutexGroup((1, constant(\"a\")))), "
+		"value(variable(mutexGroup((1, constant(\"a\")))), variable((\"on\", constant(\"b\"), constant(\"a\"))))).\n"));
+
+	// Mutex groups already enforced by the variables are omitted
+	CHECK(!contains("contains(mutexGroup((1, X1))"));
+	CHECK(contains("contains(mutexGroup(0), variable(mutexGroup((1, X1))), "
+		"value(variable(mutexGroup((1, X1))), variable((\"holding\", X1)))) :- has(X1, type(\"block\")).\n"));
+}
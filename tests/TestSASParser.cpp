@@ -1,11 +1,18 @@
 #include <catch.hpp>
 
+#include <algorithm>
+#include <experimental/filesystem>
 #include <fstream>
 #include <iostream>
 #include <sstream>
 #include <stdexcept>
 
+#include <lz/CompressingStreamBuffer.h>
+
+#include <tokenize/TokenizerException.h>
+
 #include <plasp/sas/Description.h>
+#include <plasp/sas/TranslatorASP.h>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -60,17 +67,17 @@ TEST_CASE_METHOD(SASParserTestsFixture, "[SAS parser] A valid SAS file is parsed
 
 		REQUIRE(description.mutexGroups().size() == 8u);
 		REQUIRE(description.mutexGroups()[0].facts().size() == 9u);
-		CHECK(&description.mutexGroups()[0].facts()[0].value() == &description.variables()[0].values()[0]);
+		CHECK(&description.mutexGroups()[0].facts()[0].value(description.variables()) == &description.variables()[0].values()[0]);
 		REQUIRE(description.mutexGroups()[7].facts().size() == 2u);
-		CHECK(&description.mutexGroups()[7].facts()[1].value() == &description.variables()[34].values()[1]);
+		CHECK(&description.mutexGroups()[7].facts()[1].value(description.variables()) == &description.variables()[34].values()[1]);
 
 		REQUIRE(description.initialState().facts().size() == 37u);
-		CHECK(&description.initialState().facts()[0].value() == &description.variables()[0].values()[8]);
-		CHECK(&description.initialState().facts()[36].value() == &description.variables()[36].values()[1]);
+		CHECK(&description.initialState().facts()[0].value(description.variables()) == &description.variables()[0].values()[8]);
+		CHECK(&description.initialState().facts()[36].value(description.variables()) == &description.variables()[36].values()[1]);
 
 		REQUIRE(description.goal().facts().size() == 2u);
-		CHECK(&description.goal().facts()[0].value() == &description.variables()[6].values()[0]);
-		CHECK(&description.goal().facts()[1].value() == &description.variables()[7].values()[0]);
+		CHECK(&description.goal().facts()[0].value(description.variables()) == &description.variables()[6].values()[0]);
+		CHECK(&description.goal().facts()[1].value(description.variables()) == &description.variables()[7].values()[0]);
 
 		REQUIRE(description.operators().size() == 34u);
 		CHECK(description.operators()[0].predicate().name() == "activate-trans");
@@ -78,34 +85,34 @@ TEST_CASE_METHOD(SASParserTestsFixture, "[SAS parser] A valid SAS file is parsed
 		CHECK(description.operators()[0].predicate().arguments()[0] == "philosopher-0");
 		CHECK(description.operators()[0].predicate().arguments()[4] == "state-3");
 		REQUIRE(description.operators()[0].preconditions().size() == 3u);
-		CHECK(&description.operators()[0].preconditions()[0].value() == &description.variables()[4].values()[4]);
-		CHECK(&description.operators()[0].preconditions()[1].value() == &description.variables()[16].values()[1]);
-		CHECK(&description.operators()[0].preconditions()[2].value() == &description.variables()[0].values()[8]);
+		CHECK(&description.operators()[0].preconditions()[0].value(description.variables()) == &description.variables()[4].values()[4]);
+		CHECK(&description.operators()[0].preconditions()[1].value(description.variables()) == &description.variables()[16].values()[1]);
+		CHECK(&description.operators()[0].preconditions()[2].value(description.variables()) == &description.variables()[0].values()[8]);
 		REQUIRE(description.operators()[0].effects().size() == 1u);
 		REQUIRE(description.operators()[0].effects()[0].conditions().size() == 0u);
-		CHECK(&description.operators()[0].effects()[0].postcondition().value() == &description.variables()[0].values()[0]);
+		CHECK(&description.operators()[0].effects()[0].postcondition().value(description.variables()) == &description.variables()[0].values()[0]);
 		CHECK(description.operators()[33].predicate().name() == "queue-write");
 		REQUIRE(description.operators()[33].predicate().arguments().size() == 4u);
 		CHECK(description.operators()[33].predicate().arguments()[0] == "philosopher-1");
 		CHECK(description.operators()[33].predicate().arguments()[3] == "fork");
 		REQUIRE(description.operators()[33].preconditions().size() == 2u);
-		CHECK(&description.operators()[33].preconditions()[0].value() == &description.variables()[1].values()[3]);
-		CHECK(&description.operators()[33].preconditions()[1].value() == &description.variables()[2].values()[2]);
+		CHECK(&description.operators()[33].preconditions()[0].value(description.variables()) == &description.variables()[1].values()[3]);
+		CHECK(&description.operators()[33].preconditions()[1].value(description.variables()) == &description.variables()[2].values()[2]);
 		REQUIRE(description.operators()[33].effects().size() == 3u);
 		REQUIRE(description.operators()[33].effects()[0].conditions().size() == 0u);
-		CHECK(&description.operators()[33].effects()[0].postcondition().value() == &description.variables()[1].values()[7]);
-		CHECK(&description.operators()[33].effects()[2].postcondition().value() == &description.variables()[35].values()[0]);
+		CHECK(&description.operators()[33].effects()[0].postcondition().value(description.variables()) == &description.variables()[1].values()[7]);
+		CHECK(&description.operators()[33].effects()[2].postcondition().value(description.variables()) == &description.variables()[35].values()[0]);
 
 		REQUIRE(description.axiomRules().size() == 33u);
 		REQUIRE(description.axiomRules()[0].conditions().size() == 4u);
-		CHECK(&description.axiomRules()[0].conditions()[0].value() == &description.variables()[0].values()[0]);
-		CHECK(&description.axiomRules()[0].conditions()[2].value() == &description.variables()[27].values()[0]);
-		CHECK(&description.axiomRules()[0].conditions()[3].value() == &description.variables()[8].values()[1]);
-		CHECK(&description.axiomRules()[0].postcondition().value() == &description.variables()[8].values()[0]);
+		CHECK(&description.axiomRules()[0].conditions()[0].value(description.variables()) == &description.variables()[0].values()[0]);
+		CHECK(&description.axiomRules()[0].conditions()[2].value(description.variables()) == &description.variables()[27].values()[0]);
+		CHECK(&description.axiomRules()[0].conditions()[3].value(description.variables()) == &description.variables()[8].values()[1]);
+		CHECK(&description.axiomRules()[0].postcondition().value(description.variables()) == &description.variables()[8].values()[0]);
 		REQUIRE(description.axiomRules()[32].conditions().size() == 2u);
-		CHECK(&description.axiomRules()[32].conditions()[0].value() == &description.variables()[15].values()[0]);
-		CHECK(&description.axiomRules()[32].conditions()[1].value() == &description.variables()[25].values()[0]);
-		CHECK(&description.axiomRules()[32].postcondition().value() == &description.variables()[25].values()[1]);
+		CHECK(&description.axiomRules()[32].conditions()[0].value(description.variables()) == &description.variables()[15].values()[0]);
+		CHECK(&description.axiomRules()[32].conditions()[1].value(description.variables()) == &description.variables()[25].values()[0]);
+		CHECK(&description.axiomRules()[32].postcondition().value(description.variables()) == &description.variables()[25].values()[1]);
 	}
 	catch (const std::exception &e)
 	{
@@ -170,7 +177,7 @@ TEST_CASE_METHOD(SASParserTestsFixture, "[SAS parser] SAS requirements are parse
 
 		REQUIRE(description.operators()[172].effects().size() == 3u);
 		REQUIRE(description.operators()[172].effects()[1].conditions().size() == 1u);
-		CHECK(&description.operators()[172].effects()[1].conditions()[0].value() == &description.variables()[1].values()[4]);
+		CHECK(&description.operators()[172].effects()[1].conditions()[0].value(description.variables()) == &description.variables()[1].values()[4]);
 	}
 	catch (const std::exception &e)
 	{
@@ -180,6 +187,194 @@ TEST_CASE_METHOD(SASParserTestsFixture, "[SAS parser] SAS requirements are parse
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+TEST_CASE_METHOD(SASParserTestsFixture, "[SAS parser] Operators are parsed in parallel correctly", "[SAS parser]")
+{
+	const auto parse =
+		[](const std::string &content, size_t numberOfThreads)
+		{
+			std::stringstream stream(content);
+			tokenize::Tokenizer<> tokenizer("freecell.sas", stream);
+
+			return plasp::sas::Description::fromTokenizer(std::move(tokenizer), numberOfThreads);
+		};
+
+	const auto content = m_freecellTestFile.str();
+
+	SECTION("parallel parsing yields the same operators in the same order")
+	{
+		const auto sequentialDescription = parse(content, 1);
+		const auto parallelDescription = parse(content, 4);
+
+		const auto &sequentialOperators = sequentialDescription.operators();
+		const auto &parallelOperators = parallelDescription.operators();
+
+		REQUIRE(parallelOperators.size() == sequentialOperators.size());
+
+		const auto isEqual =
+			[&](const auto &operator1, const auto &operator2)
+			{
+				return operator1.predicate().name() == operator2.predicate().name()
+					&& operator1.predicate().arguments() == operator2.predicate().arguments()
+					&& operator1.costs() == operator2.costs()
+					&& std::equal(operator1.effects().cbegin(), operator1.effects().cend(),
+						operator2.effects().cbegin(), operator2.effects().cend(),
+						[&](const auto &effect1, const auto &effect2)
+						{
+							return effect1.postcondition().variableID() == effect2.postcondition().variableID()
+								&& effect1.postcondition().valueID() == effect2.postcondition().valueID();
+						});
+			};
+
+		CHECK(std::equal(parallelOperators.cbegin(), parallelOperators.cend(), sequentialOperators.cbegin(), isEqual));
+	}
+
+	SECTION("errors are reported at the same location as by the sequential parser")
+	{
+		// Corrupt the precondition count of an operator in the middle of the section
+		auto corruptedContent = content;
+		const auto position = corruptedContent.find("begin_operator", corruptedContent.size() / 2);
+		const auto predicateEnd = corruptedContent.find('\n', position + 15);
+		corruptedContent.insert(predicateEnd + 1, "x");
+
+		const auto errorRow =
+			[&](size_t numberOfThreads) -> size_t
+			{
+				try
+				{
+					parse(corruptedContent, numberOfThreads);
+				}
+				catch (const tokenize::TokenizerException &e)
+				{
+					return e.location().rowStart;
+				}
+
+				return 0;
+			};
+
+		const auto sequentialErrorRow = errorRow(1);
+
+		CHECK(sequentialErrorRow > 0u);
+		CHECK(errorRow(4) == sequentialErrorRow);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE_METHOD(SASParserTestsFixture, "[SAS parser] Binary descriptions are loaded correctly", "[SAS parser]")
+{
+	const auto binaryFile = std::experimental::filesystem::temp_directory_path() / "plasp-test.sasb";
+
+	const auto translate =
+		[](const plasp::sas::Description &description)
+		{
+			std::stringstream outputStream;
+
+			{
+				colorlog::ColorStream colorStream(outputStream);
+				colorStream.enableOutputBuffer();
+
+				plasp::sas::TranslatorASP(description, colorStream).translate();
+			}
+
+			return outputStream.str();
+		};
+
+	const auto convert =
+		[&](const std::string &content)
+		{
+			std::stringstream stream(content);
+			const auto description = plasp::sas::Description::fromStream(stream);
+
+			std::ofstream binaryStream(binaryFile.string(), std::ios::out | std::ios::binary);
+			description.writeBinary(binaryStream);
+
+			return translate(description);
+		};
+
+	SECTION("binary descriptions translate to the same output as the text descriptions")
+	{
+		for (const auto *testFile : {&m_blocksworldTestFile, &m_cavedivingTestFile, &m_freecellTestFile, &m_philosophersTestFile})
+		{
+			const auto output = convert(testFile->str());
+
+			CHECK(plasp::sas::Description::isBinaryFile(binaryFile));
+			CHECK(translate(plasp::sas::Description::fromBinaryFile(binaryFile)) == output);
+		}
+
+		CHECK(!plasp::sas::Description::isBinaryFile("data/freecell.sas"));
+	}
+
+	SECTION("truncated binary descriptions are rejected")
+	{
+		convert(m_philosophersTestFile.str());
+
+		std::experimental::filesystem::resize_file(binaryFile, std::experimental::filesystem::file_size(binaryFile) - 1);
+
+		CHECK_THROWS_AS(plasp::sas::Description::fromBinaryFile(binaryFile), std::runtime_error);
+	}
+
+	std::experimental::filesystem::remove(binaryFile);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE_METHOD(SASParserTestsFixture, "[SAS parser] Compressed descriptions are read correctly", "[SAS parser]")
+{
+	const auto translate =
+		[](std::istream &stream)
+		{
+			const auto description = plasp::sas::Description::fromStream(stream);
+
+			std::stringstream outputStream;
+
+			{
+				colorlog::ColorStream colorStream(outputStream);
+				colorStream.enableOutputBuffer();
+
+				plasp::sas::TranslatorASP(description, colorStream).translate();
+			}
+
+			return outputStream.str();
+		};
+
+	const auto compress =
+		[](const std::string &content, std::size_t blockSize)
+		{
+			std::stringstream compressedStream;
+
+			{
+				lz::CompressingStreamBuffer compressingStreamBuffer(compressedStream.rdbuf(), blockSize);
+				std::ostream(&compressingStreamBuffer) << content;
+			}
+
+			return compressedStream.str();
+		};
+
+	for (const auto *testFile : {&m_blocksworldTestFile, &m_cavedivingTestFile, &m_freecellTestFile, &m_philosophersTestFile})
+	{
+		std::stringstream stream(testFile->str());
+		const auto output = translate(stream);
+
+		for (const auto blockSize : {lz::DefaultBlockSize, static_cast<std::size_t>(4096)})
+		{
+			const auto compressed = compress(testFile->str(), blockSize);
+
+			CHECK(compressed.size() < testFile->str().size());
+
+			std::stringstream compressedStream(compressed);
+			CHECK(translate(compressedStream) == output);
+		}
+	}
+
+	auto truncated = compress(m_philosophersTestFile.str(), lz::DefaultBlockSize);
+	truncated.resize(truncated.size() / 2);
+
+	std::stringstream truncatedStream(truncated);
+	CHECK_THROWS_AS(plasp::sas::Description::fromStream(truncatedStream), std::runtime_error);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 TEST_CASE("[SAS parser] Former issues are fixed", "[SAS parser]")
 {
 	// Check issue where unexpected whitespaces in SAS files led to a parsing error
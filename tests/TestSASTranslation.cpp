@@ -0,0 +1,367 @@
+#include <catch.hpp>
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <tokenize/Tokenizer.h>
+
+#include <plasp/TranslatorException.h>
+#include <plasp/sas/Description.h>
+#include <plasp/sas/FactSink.h>
+#include <plasp/sas/StreamingTranslatorASP.h>
+#include <plasp/sas/TextFactSink.h>
+#include <plasp/sas/TranslatorASP.h>
+#include <plasp/sas/TranslatorAspif.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("[SAS translation] Irrelevant operators and variables are pruned", "[SAS translation]")
+{
+	const auto description = plasp::sas::Description::fromFile("data/relevance.sas");
+
+	const auto translate =
+		[&](plasp::sas::PruningMode pruningMode)
+		{
+			std::stringstream outputStream;
+
+			{
+				colorlog::ColorStream colorStream(outputStream);
+				colorStream.enableOutputBuffer();
+
+				auto translator = plasp::sas::TranslatorASP(description, colorStream);
+				translator.prune(pruningMode);
+				translator.translate();
+			}
+
+			return outputStream.str();
+		};
+
+	const auto contains =
+		[](const std::string &output, const std::string &text)
+		{
+			return output.find(text) != std::string::npos;
+		};
+
+	SECTION("operators without changes are always pruned")
+	{
+		const auto output = translate(plasp::sas::PruningMode::None);
+
+		CHECK(!contains(output, "action(action(\"wait\"))."));
+		CHECK(contains(output, "action(action((\"move\", \"c\", \"a\")))."));
+		CHECK(contains(output, "action(action(\"switch-light\"))."));
+	}
+
+	SECTION("forward chaining prunes unreachable operators and values")
+	{
+		const auto output = translate(plasp::sas::PruningMode::Forward);
+
+		CHECK(!contains(output, "action(action((\"move\", \"c\", \"a\")))."));
+		CHECK(!contains(output, "contains(variable(0), value(\"at(c)\", true))."));
+		CHECK(contains(output, "contains(variable(0), value(\"at(b)\", true))."));
+		CHECK(contains(output, "action(action(\"switch-light\"))."));
+	}
+
+	SECTION("backward regression prunes operators and variables irrelevant for the goal")
+	{
+		const auto output = translate(plasp::sas::PruningMode::Backward);
+
+		CHECK(!contains(output, "action(action(\"switch-light\"))."));
+		CHECK(!contains(output, "variable(variable(2))."));
+		CHECK(!contains(output, "initialState(variable(2),"));
+		CHECK(!contains(output, "mutexGroup(mutexGroup(0))."));
+		CHECK(contains(output, "action(action((\"move\", \"c\", \"a\")))."));
+		CHECK(contains(output, "action(action(\"take-key\"))."));
+		CHECK(contains(output, "action(action((\"move\", \"b\", \"a\")))."));
+	}
+
+	SECTION("both analyses can be combined")
+	{
+		const auto output = translate(plasp::sas::PruningMode::Both);
+
+		CHECK(!contains(output, "action(action((\"move\", \"c\", \"a\")))."));
+		CHECK(!contains(output, "action(action(\"switch-light\"))."));
+		CHECK(contains(output, "action(action(\"finish\"))."));
+		CHECK(contains(output, "goal(variable(3), value(\"done\", true))."));
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("[SAS translation] Ground programs are written in aspif format", "[SAS translation]")
+{
+	const auto description = plasp::sas::Description::fromFile("data/relevance.sas");
+
+	std::stringstream outputStream;
+
+	{
+		colorlog::ColorStream colorStream(outputStream);
+		colorStream.enableOutputBuffer();
+
+		auto translator = plasp::sas::TranslatorAspif(description, colorStream);
+		translator.setHorizon(2);
+		translator.translate();
+	}
+
+	const auto output = outputStream.str();
+
+	CHECK(output.substr(0, 10) == "asp 1 0 0\n");
+	CHECK(output.substr(output.size() - 3) == "\n0\n");
+
+	// 9 facts at time steps 0 to 2 precede the occurs/2 atoms of the 7 operators
+	CHECK(output.find("4 26 occurs(action(\"finish\"),1) 1 32\n") != std::string::npos);
+	CHECK(output.find("4 34 occurs(action((\"move\",\"a\",\"b\")),2) 1 35\n") != std::string::npos);
+
+	// The goal must hold at the horizon
+	CHECK(output.find("\n1 0 0 0 1 -26\n") != std::string::npos);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("[SAS translation] Streaming output contains the same facts as regular output", "[SAS translation]")
+{
+	const auto translate =
+		[](bool isStreaming)
+		{
+			std::stringstream outputStream;
+
+			{
+				colorlog::ColorStream colorStream(outputStream);
+				colorStream.enableOutputBuffer();
+
+				tokenize::Tokenizer<> tokenizer;
+				tokenizer.read("data/cavediving.sas");
+
+				if (isStreaming)
+				{
+					auto translator = plasp::sas::StreamingTranslatorASP(std::move(tokenizer), colorStream);
+					translator.translate();
+				}
+				else
+				{
+					const auto description = plasp::sas::Description::fromTokenizer(std::move(tokenizer));
+					auto translator = plasp::sas::TranslatorASP(description, colorStream);
+					translator.translate();
+				}
+			}
+
+			return outputStream.str();
+		};
+
+	const auto sortedLines =
+		[](const std::string &output)
+		{
+			std::vector<std::string> lines;
+			std::stringstream stream(output);
+
+			for (std::string line; std::getline(stream, line);)
+				lines.emplace_back(line);
+
+			std::sort(lines.begin(), lines.end());
+
+			return lines;
+		};
+
+	const auto regularOutput = translate(false);
+	const auto streamingOutput = translate(true);
+
+	CHECK(sortedLines(streamingOutput) == sortedLines(regularOutput));
+
+	// The feature requirements depend on all operators and are written last
+	const std::string lastLine = "requires(feature(conditionalEffects)).\n";
+
+	REQUIRE(streamingOutput.size() > lastLine.size());
+	CHECK(streamingOutput.substr(streamingOutput.size() - lastLine.size()) == lastLine);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("[SAS translation] Fact sinks receive the translated facts", "[SAS translation]")
+{
+	using plasp::sas::FactSink;
+
+	class RecordingSink : public FactSink
+	{
+		public:
+			void beginSection(Section section) override
+			{
+				sections.emplace_back(section);
+			}
+
+			void requiresFeature(Feature feature) override
+			{
+				features.emplace_back(feature);
+			}
+
+			void variable(std::size_t) override
+			{
+				numberOfVariables++;
+			}
+
+			void contains(const plasp::sas::AssignedVariable &) override
+			{
+			}
+
+			void action(const plasp::sas::Operator &) override
+			{
+				numberOfActions++;
+			}
+
+			void precondition(const plasp::sas::Operator &, const plasp::sas::AssignedVariable &) override
+			{
+			}
+
+			void postcondition(const plasp::sas::Operator &, std::size_t effectID, const plasp::sas::AssignedVariable &) override
+			{
+				if (effectID != UnconditionalEffect)
+					effectIDs.emplace_back(effectID);
+			}
+
+			void effectCondition(std::size_t, const plasp::sas::AssignedVariable &) override
+			{
+			}
+
+			void costs(const plasp::sas::Operator &) override
+			{
+			}
+
+			void mutexGroup(std::size_t) override
+			{
+				numberOfMutexGroups++;
+			}
+
+			void mutexGroupContains(std::size_t, const plasp::sas::AssignedVariable &) override
+			{
+			}
+
+			void axiomRule(std::size_t) override
+			{
+			}
+
+			void axiomRulePrecondition(std::size_t, const plasp::sas::AssignedVariable &) override
+			{
+			}
+
+			void axiomRulePostcondition(std::size_t, const plasp::sas::AssignedVariable &) override
+			{
+			}
+
+			void initialState(const plasp::sas::AssignedVariable &) override
+			{
+				numberOfInitialStateFacts++;
+			}
+
+			void goal(const plasp::sas::AssignedVariable &fact) override
+			{
+				goalFacts.emplace_back(fact.variableID(), fact.valueID());
+			}
+
+			std::vector<Section> sections;
+			std::vector<Feature> features;
+			std::size_t numberOfVariables = 0;
+			std::size_t numberOfActions = 0;
+			std::vector<std::size_t> effectIDs;
+			std::size_t numberOfMutexGroups = 0;
+			std::size_t numberOfInitialStateFacts = 0;
+			std::vector<std::pair<std::size_t, int>> goalFacts;
+	};
+
+	const auto description = plasp::sas::Description::fromFile("data/cavediving.sas");
+
+	RecordingSink sink;
+
+	{
+		auto translator = plasp::sas::TranslatorASP(description, sink);
+		// Sinks without chunk support receive all facts sequentially
+		translator.setNumberOfThreads(4);
+		translator.translate();
+	}
+
+	CHECK(sink.sections == std::vector<FactSink::Section>{FactSink::Section::Requirements,
+		FactSink::Section::Variables, FactSink::Section::Actions, FactSink::Section::MutexGroups,
+		FactSink::Section::InitialState, FactSink::Section::Goal});
+	CHECK(sink.features == std::vector<FactSink::Feature>{FactSink::Feature::ActionCosts,
+		FactSink::Feature::ConditionalEffects});
+
+	CHECK(sink.numberOfVariables == description.variables().size());
+	CHECK(sink.numberOfActions == description.operators().size());
+	CHECK(sink.numberOfMutexGroups == description.mutexGroups().size());
+	CHECK(sink.numberOfInitialStateFacts == description.initialState().facts().size());
+
+	// Conditional effects are numbered consecutively
+	REQUIRE(!sink.effectIDs.empty());
+
+	for (std::size_t i = 0; i < sink.effectIDs.size(); i++)
+		CHECK(sink.effectIDs[i] == i);
+
+	const auto &goalFacts = description.goal().facts();
+
+	REQUIRE(sink.goalFacts.size() == goalFacts.size());
+
+	for (std::size_t i = 0; i < goalFacts.size(); i++)
+	{
+		CHECK(sink.goalFacts[i].first == goalFacts[i].variableID());
+		CHECK(sink.goalFacts[i].second == goalFacts[i].valueID());
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("[SAS translation] Colored output only differs by escape sequences", "[SAS translation]")
+{
+	const auto description = plasp::sas::Description::fromFile("data/blocksworld.sas");
+
+	const auto translate =
+		[&](colorlog::ColorStream::ColorPolicy colorPolicy)
+		{
+			std::stringstream outputStream;
+
+			colorlog::ColorStream colorStream(outputStream);
+			colorStream.setColorPolicy(colorPolicy);
+
+			auto translator = plasp::sas::TranslatorASP(description, colorStream);
+			translator.translate();
+
+			return outputStream.str();
+		};
+
+	const auto plainOutput = translate(colorlog::ColorStream::ColorPolicy::Never);
+	const auto coloredOutput = translate(colorlog::ColorStream::ColorPolicy::Always);
+
+	CHECK(plainOutput.find('\033') == std::string::npos);
+	CHECK(coloredOutput.find("\033[21;97mvariable\033[0m(") != std::string::npos);
+	CHECK(coloredOutput.find("\033[1;34m% variables\033[0m") != std::string::npos);
+
+	std::string strippedOutput;
+
+	for (std::size_t i = 0; i < coloredOutput.size(); i++)
+	{
+		if (coloredOutput[i] != '\033')
+		{
+			strippedOutput.push_back(coloredOutput[i]);
+			continue;
+		}
+
+		// Escape sequences end with the first m
+		i = std::min(coloredOutput.find('m', i), coloredOutput.size());
+	}
+
+	CHECK(strippedOutput == plainOutput);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("[SAS translation] Facts without a value are rejected", "[SAS translation]")
+{
+	const auto description = plasp::sas::Description::fromFile("data/blocksworld.sas");
+
+	std::stringstream outputStream;
+	colorlog::ColorStream colorStream(outputStream);
+
+	plasp::sas::TextFactSink sink(description, colorStream);
+	sink.beginSection(plasp::sas::FactSink::Section::InitialState);
+
+	CHECK_THROWS_AS(sink.initialState(plasp::sas::AssignedVariable(0, plasp::sas::Value::AnyID)),
+		plasp::TranslatorException);
+}